@@ -0,0 +1,182 @@
+/* UTF-8 encoding
+* minimal benchmark harness for ConsoleUtil, no external dependencies.
+* usage:
+	BENCH_CASE(my_case) {
+		double ns = bench::measure([&]{ bench::do_not_optimize(func()); });
+		bench::report("func", ns, bytes_per_call);
+	}
+	run `Bench [filter...]` to run the cases whose name contains any of the filters,
+	`--csv <file>` also writes every row to a CSV file, to keep as a baseline.
+* targets that link `string_util/alloc_hooks.cpp` (StringBench) also count heap use:
+	bench::measure_and_report("func", calls, bytes, [&]{ ... });	// ns/call, ns/byte, allocations/call, peak heap
+*/
+#ifndef CONSOLEUTIL_BENCH_HPP__
+#define CONSOLEUTIL_BENCH_HPP__
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace bench {
+	struct bench_case {
+		const char* name;
+		void (*func)();
+	};
+	
+	inline std::vector<bench_case>& registry() {
+		static std::vector<bench_case> cases;
+		return cases;
+	}
+	
+	struct registrar {
+		registrar(const char* name, void (*func)()) {
+			registry().push_back({name, func});
+		}
+	};
+	
+	//* keep the compiler from optimizing away a computed value
+	template<typename T>
+	inline void do_not_optimize(const T& value) {
+	#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+	#else
+		static volatile const void* sink;
+		sink = &value;
+	#endif
+	}
+	
+	//* runs `func` repeatedly for at least `min_ms` milliseconds, returns nanoseconds per call
+	template<typename Func>
+	inline double measure(Func&& func, double min_ms = 100.0) {
+		using clock = std::chrono::steady_clock;
+		func(); // warm up
+		for (size_t iters = 1; ; iters *= 2) {
+			const auto start = clock::now();
+			for (size_t i = 0; i < iters; ++i) {
+				func();
+			}
+			const double ns = std::chrono::duration<double, std::nano>(clock::now() - start).count();
+			if (ns >= min_ms * 1e6) {
+				return ns / static_cast<double>(iters);
+			}
+		}
+	}
+	
+	//* name of the running case, and where `--csv` sends the rows
+	inline const char*& current_case() {
+		static const char* name = "";
+		return name;
+	}
+	inline std::FILE*& csv_file() {
+		static std::FILE* file = nullptr;
+		return file;
+	}
+	//* `name` as a quoted CSV field, embedded `"` doubled per RFC 4180
+	inline std::string csv_quoted(const std::string& name) {
+		std::string out = "\"";
+		for (const char c : name) {
+			if (c == '"') {
+				out += '"';
+			}
+			out += c;
+		}
+		out += '"';
+		return out;
+	}
+	
+	//* prints one result row, with throughput if `bytes` processed per call is known
+	inline void report(const std::string& name, double ns, size_t bytes = 0) {
+		if (bytes > 0) {
+			std::printf("  %-56s %14.1f ns %10.1f MB/s\n", name.c_str(), ns, static_cast<double>(bytes) * 1e3 / ns);
+		} else {
+			std::printf("  %-56s %14.1f ns\n", name.c_str(), ns);
+		}
+		if (csv_file() != nullptr) {
+			std::fprintf(csv_file(), "%s,%s,%.2f,%zu,,\n", current_case(), csv_quoted(name).c_str(), ns, bytes);
+		}
+	}
+	
+	
+	//* heap use of a call: allocations made, and the most bytes live at once above what was live before
+	struct memory_stats {
+		double allocations = 0;
+		size_t peak_bytes = 0;
+	};
+	
+	namespace detail {
+		//* updated by the replaced `operator new` / `operator delete` in alloc_hooks.cpp, only while `enabled`
+		struct alloc_counters {
+			std::atomic<bool> enabled{false};
+			std::atomic<size_t> allocations{0};
+			std::atomic<int64_t> live{0};
+			std::atomic<int64_t> peak{0};
+			bool hooked = false;	// alloc_hooks.cpp is linked
+		};
+		inline alloc_counters counters;
+	}
+	
+	//* one warm-up call, then one counted call; `allocations` is divided by `calls`, the work items inside `func`
+	template<typename Func>
+	inline memory_stats measure_memory(Func&& func, size_t calls = 1) {
+		auto& c = detail::counters;
+		func();
+		c.allocations = 0;
+		c.live = 0;
+		c.peak = 0;
+		c.enabled = true;
+		func();
+		c.enabled = false;
+		return {static_cast<double>(c.allocations.load()) / static_cast<double>(calls), static_cast<size_t>(c.peak.load())};
+	}
+	
+	//* prints one result row: per call time, time per byte, and the heap use if it is counted
+	inline void report(const std::string& name, double ns, size_t bytes, const memory_stats& mem) {
+		const double ns_per_byte = bytes > 0 ? ns / static_cast<double>(bytes) : 0.0;
+		if (detail::counters.hooked) {
+			std::printf("  %-56s %12.1f ns %8.3f ns/B %9.2f allocs %10.1f KB peak\n", name.c_str(), ns, ns_per_byte,
+				mem.allocations, static_cast<double>(mem.peak_bytes) / 1024.0);
+		} else {
+			std::printf("  %-56s %12.1f ns %8.3f ns/B\n", name.c_str(), ns, ns_per_byte);
+		}
+		if (csv_file() != nullptr) {
+			std::fprintf(csv_file(), "%s,%s,%.2f,%zu,%.2f,%zu\n", current_case(), csv_quoted(name).c_str(), ns, bytes, mem.allocations, mem.peak_bytes);
+		}
+	}
+	
+	//* `func` does `calls` work items of `bytes` bytes in total: reports the time and heap use per item
+	template<typename Func>
+	inline void measure_and_report(const std::string& name, size_t calls, size_t bytes, Func&& func) {
+		const double ns = measure(func) / static_cast<double>(calls);
+		const memory_stats mem = measure_memory(func, calls);
+		report(name, ns, bytes / calls, mem);
+	}
+	
+	//* fixed seed, so every run measures the same data
+	inline std::mt19937_64& rng() {
+		static std::mt19937_64 gen(20240601);
+		return gen;
+	}
+	
+	inline size_t random_int(size_t min, size_t max) {
+		return std::uniform_int_distribution<size_t>(min, max)(rng());
+	}
+	
+	inline std::string random_word(size_t min_len, size_t max_len) {
+		std::string result(random_int(min_len, max_len), ' ');
+		for (auto& c : result) {
+			c = static_cast<char>('a' + random_int(0, 25));
+		}
+		return result;
+	}
+} // namespace bench
+
+#define BENCH_CASE(_NAME)												\
+	static void _NAME();												\
+	static ::bench::registrar _NAME##_registrar(#_NAME, &_NAME);		\
+	static void _NAME()
+
+#endif /* CONSOLEUTIL_BENCH_HPP__ */
@@ -0,0 +1,48 @@
+#include <map>
+
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+//* header lookups in any case: `std::map` on lowercased copies vs. `ci_less` / `ci_hash` without a copy
+BENCH_CASE(ci_map)
+{
+	const char* const names[] = {"Content-Type", "Content-Length", "Host", "Accept", "Accept-Encoding", "User-Agent",
+		"Connection", "Cache-Control", "Authorization", "X-Forwarded-For", "If-None-Match", "Cookie"};
+	std::vector<std::string> queries;
+	for (size_t i = 0; i < 1000; ++i) {
+		std::string name = names[bench::random_int(0, std::size(names) - 1)];
+		for (char& c : name) {
+			if (bench::random_int(0, 1) != 0) {
+				c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+			}
+		}
+		queries.push_back(std::move(name));
+	}
+	const double n = static_cast<double>(queries.size());
+	
+	std::map<std::string, int> lowered;
+	std::map<std::string, int, cutil::str::ci_less> ordered;
+	cutil::str::ci_flat_map<int> flat;
+	for (int i = 0; i < static_cast<int>(std::size(names)); ++i) {
+		lowered[cutil::str::to_lower(names[i])] = i;
+		ordered[names[i]] = i;
+		flat[names[i]] = i;
+	}
+	
+	bench::report("std::map + to_lower copy, per lookup", bench::measure([&]{
+		for (const auto& query : queries) {
+			bench::do_not_optimize(lowered.find(cutil::str::to_lower(query))->second);
+		}
+	}) / n);
+	bench::report("std::map<ci_less>, per lookup", bench::measure([&]{
+		for (const auto& query : queries) {
+			bench::do_not_optimize(ordered.find(query)->second);
+		}
+	}) / n);
+	bench::report("ci_flat_map, per lookup", bench::measure([&]{
+		for (const auto& query : queries) {
+			bench::do_not_optimize(flat.find(query)->second);
+		}
+	}) / n);
+}
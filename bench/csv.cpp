@@ -0,0 +1,80 @@
+
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppCsvReader.hpp"
+
+namespace {
+	//* the usual hand-written parser: a state machine appending every byte to a `std::string` field
+	size_t parse_csv_state_machine(const std::string& text) {
+		std::vector<std::string> row;
+		std::string field;
+		size_t count = 0;
+		bool quoted = false;
+		for (size_t i = 0; i < text.size(); ++i) {
+			const char c = text[i];
+			if (quoted) {
+				if (c == '"') {
+					if (i + 1 < text.size() && text[i + 1] == '"') {
+						field += '"';
+						++i;
+					} else {
+						quoted = false;
+					}
+				} else {
+					field += c;
+				}
+			} else if (c == '"') {
+				quoted = true;
+			} else if (c == ',') {
+				row.push_back(std::move(field));
+				field.clear();
+			} else if (c == '\n') {
+				row.push_back(std::move(field));
+				field.clear();
+				count += row.size();
+				row.clear();
+			} else if (c != '\r') {
+				field += c;
+			}
+		}
+		return count;
+	}
+}
+
+//* 8 MB of CSV, some fields quoted with commas, doubled quotes and line breaks
+BENCH_CASE(csv_reader)
+{
+	std::string text;
+	while (text.size() < (size_t(8) << 20)) {
+		text += std::to_string(bench::random_int(0, 1u << 30)) + ',' + bench::random_word(3, 12) + ',';
+		switch (bench::random_int(0, 9)) {
+			case 0: text += "\"" + bench::random_word(5, 20) + ", " + bench::random_word(5, 20) + "\""; break;
+			case 1: text += "\"said \"\"" + bench::random_word(2, 8) + "\"\"\""; break;
+			case 2: text += "\"" + bench::random_word(5, 20) + "\n" + bench::random_word(5, 20) + "\""; break;
+			default: text += bench::random_word(5, 30); break;
+		}
+		text += ',' + std::to_string(bench::random_int(0, 1000)) + '\n';
+	}
+
+	bench::report("state machine into std::string fields", bench::measure([&]{
+		bench::do_not_optimize(parse_csv_state_machine(text));
+	}), text.size());
+	bench::report("csv_reader, string_view fields", bench::measure([&]{
+		cutil::str::csv_reader reader(text);
+		std::vector<std::string_view> fields;
+		size_t count = 0;
+		while (reader.next_row(fields)) {
+			count += fields.size();
+		}
+		bench::do_not_optimize(count);
+	}), text.size());
+	bench::report("split(line, ',') per getline, wrong on quotes", bench::measure([&]{
+		std::vector<std::string_view> fields;
+		size_t count = 0;
+		cutil::str::for_each_record(text, '\n', [&](std::string_view line) {
+			cutil::str::split_view(line, ',', fields);
+			count += fields.size();
+		});
+		bench::do_not_optimize(count);
+	}), text.size());
+}
@@ -0,0 +1,41 @@
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+//* sort + unique `drop_duplicate()` vs. the order-preserving hash based `drop_duplicate_stable()` / `_par()`
+BENCH_CASE(drop_duplicate)
+{
+	std::vector<std::string> distinct;
+	for (size_t i = 0; i < 100000; ++i) {
+		distinct.push_back(bench::random_word(4, 16));
+	}
+	std::vector<std::string> values;
+	for (size_t i = 0; i < 1000000; ++i) {
+		values.push_back(distinct[bench::random_int(0, distinct.size() - 1)]);
+	}
+	const double n = static_cast<double>(values.size());
+	
+	// every run dedups a fresh copy, the copy alone is the baseline
+	bench::report("copy only, per element", bench::measure([&]{
+		std::vector<std::string> copy = values;
+		bench::do_not_optimize(copy.size());
+	}) / n);
+	bench::report("drop_duplicate (sort + unique), per element", bench::measure([&]{
+		std::vector<std::string> copy = values;
+		cutil::str::drop_duplicate(copy);
+		bench::do_not_optimize(copy.size());
+	}) / n);
+	bench::report("drop_duplicate_stable, per element", bench::measure([&]{
+		std::vector<std::string> copy = values;
+		cutil::str::drop_duplicate_stable(copy);
+		bench::do_not_optimize(copy.size());
+	}) / n);
+	bench::report("drop_duplicate_stable_par, per element", bench::measure([&]{
+		std::vector<std::string> copy = values;
+		cutil::str::drop_duplicate_stable_par(copy);
+		bench::do_not_optimize(copy.size());
+	}) / n);
+	bench::report("unique_indices, per element", bench::measure([&]{
+		bench::do_not_optimize(cutil::str::unique_indices(values).size());
+	}) / n);
+}
@@ -0,0 +1,64 @@
+
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+namespace {
+	//* the O(n·m) two-row table it replaces
+	size_t naive_edit_distance(std::string_view a, std::string_view b)
+	{
+		std::vector<size_t> row(b.size() + 1);
+		for (size_t j = 0; j <= b.size(); ++j) {
+			row[j] = j;
+		}
+		for (size_t i = 1; i <= a.size(); ++i) {
+			size_t diag = row[0];
+			row[0] = i;
+			for (size_t j = 1; j <= b.size(); ++j) {
+				const size_t up = row[j];
+				row[j] = std::min({row[j] + 1, row[j - 1] + 1, diag + (a[i - 1] != b[j - 1])});
+				diag = up;
+			}
+		}
+		return row[b.size()];
+	}
+}
+
+//* "did you mean" over 100k keys: naive table vs. bit-parallel distance, bounded top-k, and the parallel top-k
+BENCH_CASE(edit_distance)
+{
+	std::vector<std::string> keys;
+	for (size_t i = 0; i < 100000; ++i) {
+		keys.push_back(bench::random_word(8, 24));
+	}
+	const std::vector<std::string_view> views(keys.begin(), keys.end());
+	const std::string query = keys[12345].substr(0, keys[12345].size() - 2) + "xy";
+	const std::string long_a = bench::random_word(500, 500), long_b = long_a.substr(10) + bench::random_word(10, 10);
+	
+	bench::report("naive table, 100k keys", bench::measure([&]{
+		size_t best = static_cast<size_t>(-1);
+		for (auto key : views) {
+			best = std::min(best, naive_edit_distance(query, key));
+		}
+		bench::do_not_optimize(best);
+	}));
+	bench::report("edit_distance, 100k keys", bench::measure([&]{
+		size_t best = static_cast<size_t>(-1);
+		for (auto key : views) {
+			best = std::min(best, cutil::str::edit_distance(query, key));
+		}
+		bench::do_not_optimize(best);
+	}));
+	bench::report("closest_matches k=5, 100k keys", bench::measure([&]{
+		bench::do_not_optimize(cutil::str::closest_matches(query, views, 5).size());
+	}));
+	bench::report("closest_matches_par k=5 max=4, 100k keys", bench::measure([&]{
+		bench::do_not_optimize(cutil::str::closest_matches_par(query, views, 5, 4).size());
+	}));
+	bench::report("naive table, 500 x 500 chars", bench::measure([&]{
+		bench::do_not_optimize(naive_edit_distance(long_a, long_b));
+	}));
+	bench::report("edit_distance (8 blocks), 500 x 500 chars", bench::measure([&]{
+		bench::do_not_optimize(cutil::str::edit_distance(long_a, long_b));
+	}));
+}
@@ -0,0 +1,65 @@
+
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppEncoding.hpp"
+
+namespace {
+	//* about 1 MB of text: ASCII words, with a share of CJK characters taken from the code page
+	std::string make_corpus(size_t cjk_percent) {
+		// a few common characters every one of the three code pages has
+		const char* const cjk[] = {"\xE4\xB8\xAD", "\xE6\x96\x87", "\xE6\x97\xA5", "\xE6\x9C\xAC", "\xE4\xBA\xBA", "\xE5\xA4\xA7", "\xE5\xAD\x97", "\xE5\xB9\xB4"};
+		std::string text;
+		while (text.size() < (1 << 20)) {
+			if (bench::random_int(0, 99) < cjk_percent) {
+				for (size_t i = bench::random_int(1, 8); i > 0; --i) {
+					text += cjk[bench::random_int(0, 7)];
+				}
+			} else {
+				text += bench::random_word(2, 10);
+			}
+			text += ' ';
+		}
+		return text;
+	}
+}
+
+//* validation of pure ASCII and of mixed CJK text: the scalar loop vs. the SSSE3 lookup tables
+BENCH_CASE(validate_utf8)
+{
+	for (size_t cjk_percent : {0, 30, 100}) {
+		const std::string text = make_corpus(cjk_percent);
+		const char* first = text.data();
+		const char* last = first + text.size();
+		const std::string suffix = " (" + std::to_string(cjk_percent) + "% CJK)";
+
+		bench::report("validate_utf8_scalar" + suffix, bench::measure([&]{
+			bench::do_not_optimize(cutil::str::internal::validate_utf8_scalar(first, last));
+		}), text.size());
+	#ifdef _CUTIL_ENCODING_USE_SSSE3
+		if (cutil::str::internal::cpu_has_ssse3()) {
+			bench::report("validate_utf8_ssse3" + suffix, bench::measure([&]{
+				bench::do_not_optimize(cutil::str::internal::validate_utf8_ssse3(first, last));
+			}), text.size());
+		}
+	#endif
+	}
+}
+
+//* the three code pages both ways, on text with 30% CJK words; MB/s of the UTF-8 side
+BENCH_CASE(transcode)
+{
+	using cutil::str::codepage;
+	const std::pair<codepage, const char*> pages[] = {{codepage::gbk, "GBK"}, {codepage::big5, "Big5"}, {codepage::shift_jis, "Shift_JIS"}};
+	for (const auto& page : pages) {
+		const std::string utf8 = make_corpus(30);
+		const std::string encoded = cutil::str::from_utf8(page.first, utf8);
+		std::string buf(cutil::str::max_utf8_size(utf8.size()), '\0');
+
+		bench::report(std::string("from_utf8 -> ") + page.second, bench::measure([&]{
+			bench::do_not_optimize(cutil::str::from_utf8(page.first, utf8.data(), utf8.size(), &buf[0], buf.size()).written);
+		}), utf8.size());
+		bench::report(std::string("to_utf8 <- ") + page.second, bench::measure([&]{
+			bench::do_not_optimize(cutil::str::to_utf8(page.first, encoded.data(), encoded.size(), &buf[0], buf.size()).written);
+		}), utf8.size());
+	}
+}
@@ -0,0 +1,38 @@
+#include <regex>
+
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+//* filtering file names: `matches()` with a `std::regex` vs. a compiled `glob_matcher`
+BENCH_CASE(glob)
+{
+	const char* const extensions[] = {".log", ".txt", ".cpp", ".json", ".log.1"};
+	std::vector<std::string> names;
+	size_t total_bytes = 0;
+	for (size_t i = 0; i < 10000; ++i) {
+		std::string name = bench::random_int(0, 3) == 0 ? "user-" + std::to_string(bench::random_int(10, 99)) + '-' : "";
+		name += bench::random_word(5, 30) + extensions[bench::random_int(0, std::size(extensions) - 1)];
+		total_bytes += name.size();
+		names.push_back(std::move(name));
+	}
+	const std::vector<std::string_view> views(names.begin(), names.end());
+	const double n = static_cast<double>(names.size());
+	
+	for (const auto& [glob, regex] : {std::pair<const char*, const char*>{"*.log", ".*\\.log"}, {"user-[0-9][0-9]-*", "user-[0-9][0-9]-.*"}}) {
+		const std::regex compiled(regex);
+		bench::report(std::string("regex   ") + regex + ", per name", bench::measure([&]{
+			size_t count = 0;
+			for (const auto& name : names) {
+				count += cutil::str::matches(name, compiled);
+			}
+			bench::do_not_optimize(count);
+		}) / n, total_bytes / names.size());
+		const cutil::str::glob_matcher matcher(glob);
+		std::vector<std::string_view> kept;
+		bench::report(std::string("glob    ") + glob + ", per name", bench::measure([&]{
+			matcher.filter(views, kept);
+			bench::do_not_optimize(kept.size());
+		}) / n, total_bytes / names.size());
+	}
+}
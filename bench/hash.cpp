@@ -0,0 +1,53 @@
+#include "bench.hpp"
+
+#include <unordered_map>
+
+#include "ConsoleUtil/CppHash.hpp"
+
+//* one key of 4 B - 1 MB: std::hash of the standard library vs. FNV-1a vs. hash_bytes()
+BENCH_CASE(hash_bytes)
+{
+	for (size_t size : {4, 8, 16, 32, 64, 256, 4 << 10, 1 << 20}) {
+		std::string key;
+		while (key.size() < size) {
+			key += bench::random_word(3, 10);
+		}
+		key.resize(size);
+		const std::string_view view = key;
+		const std::string suffix = " (" + std::to_string(size) + " B)";
+
+		bench::report("std::hash<string_view>" + suffix, bench::measure([&]{ bench::do_not_optimize(std::hash<std::string_view>()(view)); }), size);
+		bench::report("fnv1a_64" + suffix, bench::measure([&]{ bench::do_not_optimize(cutil::fnv1a_64(view)); }), size);
+		bench::report("hash_bytes" + suffix, bench::measure([&]{ bench::do_not_optimize(cutil::hash_bytes(view.data(), view.size())); }), size);
+	}
+}
+
+//* lookups of 10k words of 3 - 20 chars in unordered_map, by the hasher
+BENCH_CASE(hash_map)
+{
+	std::vector<std::string> words;
+	for (int i = 0; i < 10000; ++i) {
+		words.push_back(bench::random_word(3, 20));
+	}
+	std::unordered_map<std::string, int> std_map;
+	std::unordered_map<std::string, int, cutil::string_hash> cutil_map;
+	for (size_t i = 0; i < words.size(); ++i) {
+		std_map.emplace(words[i], static_cast<int>(i));
+		cutil_map.emplace(words[i], static_cast<int>(i));
+	}
+
+	bench::report("unordered_map<std::hash> find x10k", bench::measure([&]{
+		int sum = 0;
+		for (const auto& word : words) {
+			sum += std_map.find(word)->second;
+		}
+		bench::do_not_optimize(sum);
+	}));
+	bench::report("unordered_map<string_hash> find x10k", bench::measure([&]{
+		int sum = 0;
+		for (const auto& word : words) {
+			sum += cutil_map.find(word)->second;
+		}
+		bench::do_not_optimize(sum);
+	}));
+}
@@ -0,0 +1,114 @@
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppHexBase64.hpp"
+
+namespace {
+	const size_t sizes[] = {16, 256, 4 << 10, 64 << 10, 1 << 20, 16 << 20};
+
+	std::string size_name(size_t size)
+	{
+		return size >= (1 << 20) ? std::to_string(size >> 20) + " MB" : size >= 1024 ? std::to_string(size >> 10) + " KB" : std::to_string(size) + " B";
+	}
+
+	std::string random_bytes(size_t size)
+	{
+		std::string bytes(size, '\0');
+		for (char& c : bytes) {
+			c = static_cast<char>(bench::random_int(0, 255));
+		}
+		return bytes;
+	}
+
+	//* the usual hand-written loops, appending to a string
+	std::string naive_to_hex(const std::string& bytes)
+	{
+		static const char digits[] = "0123456789abcdef";
+		std::string hex;
+		for (char c : bytes) {
+			hex += digits[static_cast<uint8_t>(c) >> 4];
+			hex += digits[c & 0x0F];
+		}
+		return hex;
+	}
+	std::string naive_to_base64(const std::string& bytes)
+	{
+		static const char chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+		std::string text;
+		uint32_t bits = 0;
+		int count = 0;
+		for (char c : bytes) {
+			bits = (bits << 8) | static_cast<uint8_t>(c);
+			count += 8;
+			while (count >= 6) {
+				count -= 6;
+				text += chars[(bits >> count) & 0x3F];
+			}
+		}
+		if (count != 0) {
+			text += chars[(bits << (6 - count)) & 0x3F];
+		}
+		while (text.size() % 4 != 0) {
+			text += '=';
+		}
+		return text;
+	}
+	std::string naive_from_base64(const std::string& text)
+	{
+		std::string bytes;
+		uint32_t bits = 0;
+		int count = 0;
+		for (char c : text) {
+			const char* p = std::strchr("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/", c);
+			if (c == '=' || c == '\0' || p == nullptr) {
+				break;
+			}
+			bits = (bits << 6) | static_cast<uint32_t>(p - "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/");
+			count += 6;
+			if (count >= 8) {
+				count -= 8;
+				bytes += static_cast<char>(bits >> count);
+			}
+		}
+		return bytes;
+	}
+}
+
+//* 16 B - 16 MB of random bytes; MB/s of the binary side
+BENCH_CASE(hex)
+{
+	for (size_t size : sizes) {
+		const std::string bytes = random_bytes(size);
+		const std::string hex = cutil::str::to_hex(bytes);
+		std::string text(hex.size(), '\0');
+		std::string back(size, '\0');
+		const std::string suffix = " (" + size_name(size) + ")";
+
+		bench::report("naive to_hex" + suffix, bench::measure([&]{ bench::do_not_optimize(naive_to_hex(bytes)); }), size);
+		bench::report("hex_encode" + suffix, bench::measure([&]{
+			bench::do_not_optimize(cutil::str::hex_encode(bytes.data(), size, &text[0]));
+		}), size);
+		bench::report("hex_decode" + suffix, bench::measure([&]{
+			bench::do_not_optimize(cutil::str::hex_decode(hex.data(), hex.size(), &back[0], size).written);
+		}), size);
+	}
+}
+
+BENCH_CASE(base64)
+{
+	for (size_t size : sizes) {
+		const std::string bytes = random_bytes(size);
+		const std::string text = cutil::str::to_base64(bytes);
+		std::string out(text.size(), '\0');
+		std::string back(size, '\0');
+		const std::string suffix = " (" + size_name(size) + ")";
+
+		bench::report("naive to_base64" + suffix, bench::measure([&]{ bench::do_not_optimize(naive_to_base64(bytes)); }), size);
+		bench::report("base64_encode" + suffix, bench::measure([&]{
+			bench::do_not_optimize(cutil::str::base64_encode(bytes.data(), size, &out[0]));
+		}), size);
+		bench::report("naive from_base64" + suffix, bench::measure([&]{ bench::do_not_optimize(naive_from_base64(text)); }), size);
+		bench::report("base64_decode" + suffix, bench::measure([&]{
+			bench::do_not_optimize(cutil::str::base64_decode(text.data(), text.size(), &back[0], size).written);
+		}), size);
+	}
+}
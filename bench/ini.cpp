@@ -0,0 +1,30 @@
+
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppIniParser.hpp"
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+//* reloading a config of 2000 `[section] key = value; ...` blocks: `regex_split_map()` vs. `ini_config`
+BENCH_CASE(ini_config)
+{
+	std::string text;
+	for (size_t i = 0; i < 2000; ++i) {
+		text += "[section" + std::to_string(i) + "] name = " + bench::random_word(4, 12) + "; size = "
+			+ std::to_string(bench::random_int(0, 100000)) + "; path = \"" + bench::random_word(10, 30) + "\";\n";
+	}
+
+	bench::report("regex_split_map (sections only)", bench::measure([&]{
+		bench::do_not_optimize(cutil::str::regex_split_map(text, "\\[[^\\]]+\\]"));
+	}), text.size());
+	bench::report("ini_config (every key)", bench::measure([&]{
+		const cutil::str::ini_config cfg(text);
+		bench::do_not_optimize(cfg.size());
+	}), text.size());
+
+	const cutil::str::ini_config cfg(text);
+	bench::report("ini_config::find, per lookup", bench::measure([&]{
+		for (size_t i = 0; i < 2000; ++i) {
+			bench::do_not_optimize(cfg.find("section1234", "size"));
+		}
+	}) / 2000.0);
+}
@@ -0,0 +1,42 @@
+
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+//* lines of short tokens: `split()` into std::strings vs. `split_inline()` into a contiguous array, then hashing every token
+BENCH_CASE(inline_string)
+{
+	std::vector<std::string> lines;
+	size_t total_bytes = 0;
+	for (size_t i = 0; i < 1000; ++i) {
+		std::string line = bench::random_word(16, 30);
+		for (size_t k = 0; k < 15; ++k) {
+			line += ',' + bench::random_word(16, 30); // past the small string buffer of libstdc++ and MSVC
+		}
+		total_bytes += line.size();
+		lines.push_back(std::move(line));
+	}
+	const double n = static_cast<double>(lines.size());
+	const size_t bytes = total_bytes / lines.size();
+	
+	bench::report("split, per line", bench::measure([&]{
+		for (const auto& line : lines) {
+			size_t hash = 0;
+			for (const auto& token : cutil::str::split(line, ',')) {
+				hash ^= std::hash<std::string>()(token);
+			}
+			bench::do_not_optimize(hash);
+		}
+	}) / n, bytes);
+	std::vector<cutil::str::inline_string<31>> tokens;
+	bench::report("split_inline<31> (reused vector), per line", bench::measure([&]{
+		for (const auto& line : lines) {
+			cutil::str::split_inline(line, ',', tokens);
+			size_t hash = 0;
+			for (const auto& token : tokens) {
+				hash ^= std::hash<cutil::str::inline_string<31>>()(token);
+			}
+			bench::do_not_optimize(hash);
+		}
+	}) / n, bytes);
+}
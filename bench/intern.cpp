@@ -0,0 +1,49 @@
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+//* lines with a small vocabulary: `split()` allocating every token vs. `split_interned()` into a pool
+BENCH_CASE(intern)
+{
+	std::vector<std::string> vocabulary;
+	for (size_t i = 0; i < 200; ++i) {
+		vocabulary.push_back(bench::random_word(20, 30)); // past the small string buffer
+	}
+	std::vector<std::string> lines;
+	size_t total_bytes = 0;
+	for (size_t i = 0; i < 1000; ++i) {
+		std::string line = vocabulary[bench::random_int(0, vocabulary.size() - 1)];
+		for (size_t k = 0; k < 15; ++k) {
+			line += ';' + vocabulary[bench::random_int(0, vocabulary.size() - 1)];
+		}
+		total_bytes += line.size();
+		lines.push_back(std::move(line));
+	}
+	const double n = static_cast<double>(lines.size());
+	const size_t bytes = total_bytes / lines.size();
+	
+	bench::report("split, per line", bench::measure([&]{
+		for (const auto& line : lines) {
+			bench::do_not_optimize(cutil::str::split(line, ';').size());
+		}
+	}) / n, bytes);
+	
+	cutil::str::intern_pool pool;
+	std::vector<cutil::str::intern_pool::id_type> ids;
+	bench::report("split_interned (reused vector), per line", bench::measure([&]{
+		for (const auto& line : lines) {
+			ids.clear();
+			cutil::str::split_interned(line, ';', pool, ids);
+			bench::do_not_optimize(ids.back());
+		}
+	}) / n, bytes);
+	
+	cutil::str::concurrent_intern_pool shared;
+	bench::report("split_interned concurrent_intern_pool, per line", bench::measure([&]{
+		for (const auto& line : lines) {
+			ids.clear();
+			cutil::str::split_interned(line, ';', shared, ids);
+			bench::do_not_optimize(ids.back());
+		}
+	}) / n, bytes);
+}
@@ -0,0 +1,38 @@
+#include <cstdio>
+#include <cstring>
+
+#include "bench.hpp"
+
+int main(int argc, char* argv[])
+{
+	std::vector<const char*> filters;
+	for (int i = 1; i < argc; ++i) {
+		if (std::strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+			bench::csv_file() = std::fopen(argv[++i], "w");
+			if (bench::csv_file() == nullptr) {
+				std::fprintf(stderr, "cannot write %s\n", argv[i]);
+				return 1;
+			}
+			std::fprintf(bench::csv_file(), "case,name,ns,bytes,allocations,peak_bytes\n");
+		} else {
+			filters.push_back(argv[i]);
+		}
+	}
+	for (const auto& each : bench::registry()) {
+		bool selected = filters.empty();
+		for (const char* filter : filters) {
+			selected = selected || (std::strstr(each.name, filter) != nullptr);
+		}
+		if (!selected) {
+			continue;
+		}
+		std::printf("[%s]\n", each.name);
+		bench::current_case() = each.name;
+		each.func();
+		std::fflush(stdout);
+	}
+	if (bench::csv_file() != nullptr) {
+		std::fclose(bench::csv_file());
+	}
+	return 0;
+}
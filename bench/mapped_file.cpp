@@ -0,0 +1,49 @@
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppMappedFile.hpp"
+
+//* a 16 MB tab separated log: `std::getline()` + `split()` vs. records and `split_view()` from the mapping and from blocks
+BENCH_CASE(file_splitter)
+{
+	const std::string path = (std::filesystem::temp_directory_path() / "cutil_bench_file_splitter.tsv").string();
+	size_t file_size = 0;
+	{
+		std::ofstream out(path, std::ios::binary);
+		while (file_size < (size_t(16) << 20)) {
+			std::string line = std::to_string(bench::random_int(0, 1u << 30)) + '\t' + bench::random_word(4, 12) + '\t'
+				+ bench::random_word(10, 40) + '\t' + std::to_string(bench::random_int(100, 599)) + '\n';
+			file_size += line.size();
+			out << line;
+		}
+	}
+
+	bench::report("ifstream + getline + split", bench::measure([&]{
+		std::ifstream in(path, std::ios::binary);
+		std::string line;
+		size_t fields = 0;
+		while (std::getline(in, line)) {
+			fields += cutil::str::split(line, '\t').size();
+		}
+		bench::do_not_optimize(fields);
+	}, 500.0), file_size);
+	for (bool allow_mmap : {true, false}) {
+		bench::report(allow_mmap ? "file_splitter (mmap) + split_view" : "file_splitter (blocks) + split_view", bench::measure([&]{
+			cutil::str::file_splitter file;
+			file.open(path, '\n', allow_mmap);
+			std::string_view line;
+			std::vector<std::string_view> fields;
+			size_t count = 0;
+			while (file.next_record(line)) {
+				cutil::str::split_view(line, '\t', fields);
+				count += fields.size();
+			}
+			bench::do_not_optimize(count);
+		}, 500.0), file_size);
+	}
+	std::remove(path.c_str());
+}
@@ -0,0 +1,66 @@
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+//* checking log lines against N keywords: naive `contains()` loop vs. `multi_matcher`
+BENCH_CASE(multi_matcher)
+{
+	std::vector<std::string> lines;
+	size_t total_bytes = 0;
+	for (size_t i = 0; i < 1000; ++i) {
+		std::string line = "2024-06-01 12:00:00 [INFO]";
+		while (line.size() < 120) {
+			line += ' ' + bench::random_word(3, 9);
+		}
+		total_bytes += line.size();
+		lines.push_back(std::move(line));
+	}
+	
+	for (size_t n : {10, 100, 1000}) {
+		std::vector<std::string> keywords;
+		for (size_t i = 0; i < n; ++i) {
+			keywords.push_back(bench::random_word(6, 12));
+		}
+		for (size_t i = 0; i < lines.size(); i += 10) { // about 10% of the lines hit
+			lines[i].replace(30, 12, keywords[i % n]);
+		}
+		const cutil::str::multi_matcher matcher(keywords);
+		
+		const double naive = bench::measure([&]{
+			size_t hits = 0;
+			for (const auto& line : lines) {
+				for (const auto& kw : keywords) {
+					if (cutil::str::contains(line, kw)) {
+						++hits;
+						break;
+					}
+				}
+			}
+			bench::do_not_optimize(hits);
+		});
+		const double compiled = bench::measure([&]{
+			size_t hits = 0;
+			for (const auto& line : lines) {
+				hits += matcher.contains_any(line);
+			}
+			bench::do_not_optimize(hits);
+		});
+		const double counted = bench::measure([&]{
+			size_t hits = 0;
+			for (const auto& line : lines) {
+				hits += matcher.count(line);
+			}
+			bench::do_not_optimize(hits);
+		});
+		
+		const std::string suffix = " x" + std::to_string(n) + " patterns, 1000 lines";
+		bench::report("contains() loop" + suffix, naive, total_bytes);
+		bench::report("multi_matcher::contains_any()" + suffix, compiled, total_bytes);
+		bench::report("multi_matcher::count()" + suffix, counted, total_bytes);
+		
+		const std::string build_name = "multi_matcher build, " + std::to_string(n) + " patterns";
+		bench::report(build_name, bench::measure([&]{
+			bench::do_not_optimize(cutil::str::multi_matcher(keywords));
+		}));
+	}
+}
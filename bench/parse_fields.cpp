@@ -0,0 +1,41 @@
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+//* one line of numbers: `split()` + `to_number()` per token vs. the one-pass `parse_numbers()` / `parse_fields()`
+BENCH_CASE(parse_fields)
+{
+	std::vector<std::string> lines;
+	size_t total_bytes = 0;
+	for (size_t i = 0; i < 1000; ++i) {
+		std::string line = std::to_string(bench::random_int(1700000000, 1800000000));
+		for (size_t k = 0; k < 7; ++k) {
+			line += ',' + cutil::str::to_string(static_cast<double>(bench::random_int(0, 1000000)) / 1000.0);
+		}
+		total_bytes += line.size();
+		lines.push_back(std::move(line));
+	}
+	const double n = static_cast<double>(lines.size());
+	const size_t bytes = total_bytes / lines.size();
+	
+	bench::report("split + to_number<double>, per line", bench::measure([&]{
+		for (const auto& line : lines) {
+			for (const auto& token : cutil::str::split(line, ',')) {
+				bench::do_not_optimize(cutil::str::to_number<double>(token));
+			}
+		}
+	}) / n, bytes);
+	bench::report("parse_numbers<double>, per line", bench::measure([&]{
+		double values[8];
+		for (const auto& line : lines) {
+			bench::do_not_optimize(cutil::str::parse_numbers<double>(line, ',', values).parsed);
+			bench::do_not_optimize(values[7]);
+		}
+	}) / n, bytes);
+	bench::report("parse_fields<int64_t, double x7>, per line", bench::measure([&]{
+		for (const auto& line : lines) {
+			auto rec = cutil::str::parse_fields<int64_t, double, double, double, double, double, double, double>(line, ',');
+			bench::do_not_optimize(std::get<7>(rec.values));
+		}
+	}) / n, bytes);
+}
@@ -0,0 +1,46 @@
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+#ifdef _CUTIL_STRINGUTIL_USE_PMR
+//* split-heavy parsing of one request: the global heap vs. `cutil::str::pmr` on a monotonic buffer released at once
+BENCH_CASE(pmr)
+{
+	std::vector<std::string> lines;
+	size_t total_bytes = 0;
+	for (size_t i = 0; i < 1000; ++i) {
+		std::string line = "  " + bench::random_word(18, 30) + "  ";
+		for (size_t k = 0; k < 12; ++k) {
+			line += ',' + bench::random_word(18, 30);
+		}
+		total_bytes += line.size();
+		lines.push_back(std::move(line));
+	}
+	const double n = static_cast<double>(lines.size());
+	const size_t bytes = total_bytes / lines.size();
+	
+	bench::report("std::allocator split + trim_copy + to_lower, per line", bench::measure([&]{
+		for (const auto& line : lines) {
+			auto fields = cutil::str::split(line, ',');
+			auto key = cutil::str::to_lower(cutil::str::trim_copy(fields[0]));
+			bench::do_not_optimize(key.size() + fields.size());
+		}
+	}) / n, bytes);
+	bench::report("pmr default resource, per line", bench::measure([&]{
+		for (const auto& line : lines) {
+			auto fields = cutil::str::pmr::split(line, ',');
+			auto key = cutil::str::pmr::to_lower(cutil::str::pmr::trim_copy(fields[0]));
+			bench::do_not_optimize(key.size() + fields.size());
+		}
+	}) / n, bytes);
+	bench::report("pmr monotonic_buffer_resource per line, per line", bench::measure([&]{
+		alignas(std::max_align_t) char buffer[8 * 1024];
+		for (const auto& line : lines) {
+			std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+			auto fields = cutil::str::pmr::split(line, ',', &arena);
+			auto key = cutil::str::pmr::to_lower(cutil::str::pmr::trim_copy(fields[0], &arena), &arena);
+			bench::do_not_optimize(key.size() + fields.size());
+		}
+	}) / n, bytes);
+}
+#endif
@@ -0,0 +1,50 @@
+#include <algorithm>
+
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+namespace {
+	//* the previous implementation: `std::string::find()` per byte, then a separate trim
+	void sanitize_find(std::string& str) {
+		const std::string invalid_chars = "<>:\"/\\|?*";
+		str.erase(std::remove_if(str.begin(), str.end(), [&invalid_chars](char c){
+			return invalid_chars.find(c) != std::string::npos;
+		}), str.end());
+		cutil::str::trim(str);
+	}
+}
+
+//* file names of a few dozen bytes: find-based removal vs. the byte table, one by one and as a batch
+BENCH_CASE(sanitize_filename)
+{
+	std::vector<std::string> names;
+	size_t total_bytes = 0;
+	for (size_t i = 0; i < 10000; ++i) {
+		std::string name = " " + bench::random_word(10, 30) + ":" + bench::random_word(5, 10) + "?.txt ";
+		total_bytes += name.size();
+		names.push_back(std::move(name));
+	}
+	const double n = static_cast<double>(names.size());
+	const size_t bytes = total_bytes / names.size();
+	
+	bench::report("find + remove_if + trim, per name", bench::measure([&]{
+		std::vector<std::string> copy = names;
+		for (auto& name : copy) {
+			sanitize_find(name);
+		}
+		bench::do_not_optimize(copy.back());
+	}) / n, bytes);
+	bench::report("sanitize_filename, per name", bench::measure([&]{
+		std::vector<std::string> copy = names;
+		for (auto& name : copy) {
+			cutil::str::sanitize_filename(name);
+		}
+		bench::do_not_optimize(copy.back());
+	}) / n, bytes);
+	bench::report("sanitize_filenames (batch), per name", bench::measure([&]{
+		std::vector<std::string> copy = names;
+		cutil::str::sanitize_filenames(copy);
+		bench::do_not_optimize(copy.back());
+	}) / n, bytes);
+}
@@ -0,0 +1,39 @@
+#include <algorithm>
+
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+//* sorting string keys: `std::sort()` vs. `sorting_ascending()` (multikey quicksort on cached keys)
+BENCH_CASE(sort)
+{
+	std::vector<std::string> random_keys, url_keys;
+	for (size_t i = 0; i < 200000; ++i) {
+		random_keys.push_back(bench::random_word(8, 24));
+		url_keys.push_back("https://example.com/api/v2/" + bench::random_word(4, 12)); // long common prefix
+	}
+	
+	for (const auto* keys : {&random_keys, &url_keys}) {
+		const std::string suffix = keys == &random_keys ? " (random words), per key" : " (common prefix), per key";
+		const double n = static_cast<double>(keys->size());
+		bench::report("copy only" + suffix, bench::measure([&]{
+			std::vector<std::string> copy = *keys;
+			bench::do_not_optimize(copy.size());
+		}) / n);
+		bench::report("std::sort" + suffix, bench::measure([&]{
+			std::vector<std::string> copy = *keys;
+			std::sort(copy.begin(), copy.end());
+			bench::do_not_optimize(copy.front());
+		}) / n);
+		bench::report("sorting_ascending" + suffix, bench::measure([&]{
+			std::vector<std::string> copy = *keys;
+			cutil::str::sorting_ascending(copy);
+			bench::do_not_optimize(copy.front());
+		}) / n);
+		bench::report("drop_duplicate" + suffix, bench::measure([&]{
+			std::vector<std::string> copy = *keys;
+			cutil::str::drop_duplicate(copy);
+			bench::do_not_optimize(copy.size());
+		}) / n);
+	}
+}
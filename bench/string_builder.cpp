@@ -0,0 +1,47 @@
+
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+//* a log line per record: `+` with `std::to_string()` temporaries vs. `string_builder` chains and exact sizing
+BENCH_CASE(string_builder)
+{
+	struct record { std::string name; int id; double value; };
+	std::vector<record> records;
+	size_t total_bytes = 0;
+	for (size_t i = 0; i < 10000; ++i) {
+		records.push_back({bench::random_word(5, 20), static_cast<int>(bench::random_int(0, 1u << 30)), bench::random_int(0, 1000000) / 7.0});
+		total_bytes += records.back().name.size() + 30;
+	}
+	
+	bench::report("operator+ and std::to_string", bench::measure([&]{
+		std::string out;
+		for (const auto& r : records) {
+			out += "[" + std::to_string(r.id) + "] " + r.name + " = " + std::to_string(r.value) + '\n';
+		}
+		bench::do_not_optimize(out.size());
+	}), total_bytes);
+	bench::report("string_builder <<", bench::measure([&]{
+		cutil::str::string_builder sb;
+		for (const auto& r : records) {
+			sb << '[' << r.id << "] " << r.name << " = " << r.value << '\n';
+		}
+		bench::do_not_optimize(sb.release().size());
+	}), total_bytes);
+	bench::report("string_builder::build_exact", bench::measure([&]{
+		const std::string out = cutil::str::string_builder::build_exact([&](cutil::str::string_builder& sb) {
+			for (const auto& r : records) {
+				sb << '[' << r.id << "] " << r.name << " = " << r.value << '\n';
+			}
+		});
+		bench::do_not_optimize(out.size());
+	}), total_bytes);
+	cutil::str::string_builder reused;
+	bench::report("string_builder, reused buffer", bench::measure([&]{
+		reused.clear();
+		for (const auto& r : records) {
+			reused.append_all('[', r.id, "] ", r.name, " = ", r.value, '\n');
+		}
+		bench::do_not_optimize(reused.size());
+	}), total_bytes);
+}
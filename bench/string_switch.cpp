@@ -0,0 +1,139 @@
+#include "bench.hpp"
+
+#include <array>
+#include <unordered_map>
+
+#include "ConsoleUtil/CppStringSwitch.hpp"
+
+namespace {
+	//* the dispatcher this replaces
+	int if_chain(std::string_view cmd)
+	{
+		if (cmd == "open") return 0;
+		else if (cmd == "close") return 1;
+		else if (cmd == "read") return 2;
+		else if (cmd == "write") return 3;
+		else if (cmd == "seek") return 4;
+		else if (cmd == "list") return 5;
+		else if (cmd == "remove") return 6;
+		else if (cmd == "rename") return 7;
+		else if (cmd == "mkdir") return 8;
+		else if (cmd == "rmdir") return 9;
+		else if (cmd == "chmod") return 10;
+		else if (cmd == "chown") return 11;
+		else if (cmd == "stat") return 12;
+		else if (cmd == "sync") return 13;
+		else if (cmd == "help") return 14;
+		else if (cmd == "quit") return 15;
+		return -1;
+	}
+	int switched(std::string_view cmd)
+	{
+		static constexpr cutil::str::string_switch commands("open", "close", "read", "write", "seek", "list", "remove", "rename",
+			"mkdir", "rmdir", "chmod", "chown", "stat", "sync", "help", "quit");
+		switch (commands(cmd)) {
+			case commands("open"):	return 0;
+			case commands("close"):	return 1;
+			case commands("read"):	return 2;
+			case commands("write"):	return 3;
+			case commands("seek"):	return 4;
+			case commands("list"):	return 5;
+			case commands("remove"):return 6;
+			case commands("rename"):return 7;
+			case commands("mkdir"):	return 8;
+			case commands("rmdir"):	return 9;
+			case commands("chmod"):	return 10;
+			case commands("chown"):	return 11;
+			case commands("stat"):	return 12;
+			case commands("sync"):	return 13;
+			case commands("help"):	return 14;
+			case commands("quit"):	return 15;
+			default:				return -1;
+		}
+	}
+
+	template<size_t N>
+	void compare_lookups()
+	{
+		std::vector<std::string> storage;
+		while (storage.size() < N) {
+			std::string word = bench::random_word(3, 12);
+			if (std::find(storage.begin(), storage.end(), word) == storage.end()) {
+				storage.push_back(word);
+			}
+		}
+		std::array<std::string_view, N> keys;
+		std::copy(storage.begin(), storage.end(), keys.begin());
+		// half hits, half misses, in random order
+		std::vector<std::string> queries;
+		for (size_t i = 0; i < 1000; ++i) {
+			queries.push_back(i % 2 == 0 ? storage[bench::random_int(0, N - 1)] : bench::random_word(3, 12));
+		}
+
+		std::unordered_map<std::string_view, size_t> map;
+		for (size_t i = 0; i < N; ++i) {
+			map.emplace(keys[i], i);
+		}
+		const cutil::str::string_switch<N> sw(keys);
+		const std::string suffix = " (" + std::to_string(N) + " keys) x1000";
+
+		bench::report("if-chain" + suffix, bench::measure([&]{
+			size_t sum = 0;
+			for (const auto& query : queries) {
+				for (size_t i = 0; i < N; ++i) {
+					if (query == keys[i]) {
+						sum += i;
+						break;
+					}
+				}
+			}
+			bench::do_not_optimize(sum);
+		}));
+		bench::report("unordered_map" + suffix, bench::measure([&]{
+			size_t sum = 0;
+			for (const auto& query : queries) {
+				const auto it = map.find(query);
+				sum += it != map.end() ? it->second : 0;
+			}
+			bench::do_not_optimize(sum);
+		}));
+		bench::report("string_switch" + suffix, bench::measure([&]{
+			size_t sum = 0;
+			for (const auto& query : queries) {
+				const size_t i = sw(query);
+				sum += i != sw.npos ? i : 0;
+			}
+			bench::do_not_optimize(sum);
+		}));
+	}
+}
+
+//* a 16-command dispatcher written both ways, then 10 - 500 generated keys against a linear search and unordered_map
+BENCH_CASE(string_switch)
+{
+	const char* const names[] = {"open", "close", "read", "write", "seek", "list", "remove", "rename",
+		"mkdir", "rmdir", "chmod", "chown", "stat", "sync", "help", "quit", "unknown", "opens"};
+	std::vector<std::string> commands;
+	for (int i = 0; i < 1000; ++i) {
+		commands.push_back(names[bench::random_int(0, 17)]);
+	}
+	bench::report("if/else if dispatch (16 commands) x1000", bench::measure([&]{
+		int sum = 0;
+		for (const auto& cmd : commands) {
+			sum += if_chain(cmd);
+		}
+		bench::do_not_optimize(sum);
+	}));
+	bench::report("string_switch dispatch (16 commands) x1000", bench::measure([&]{
+		int sum = 0;
+		for (const auto& cmd : commands) {
+			sum += switched(cmd);
+		}
+		bench::do_not_optimize(sum);
+	}));
+
+	compare_lookups<10>();
+	compare_lookups<50>();
+	compare_lookups<100>();
+	compare_lookups<500>();
+}
@@ -0,0 +1,67 @@
+/* UTF-8 encoding
+* replaces the global `operator new` / `operator delete` of StringBench, so `bench::measure_memory()` can count heap use.
+* every block carries its size in a header; the counters are only touched while a measurement runs.
+*/
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "../bench.hpp"
+
+namespace {
+	constexpr size_t header_size = alignof(std::max_align_t); // keeps the blocks aligned as malloc() does
+
+	void* allocate(size_t size) noexcept
+	{
+		void* block = std::malloc(size + header_size);
+		if (block == nullptr) {
+			return nullptr;
+		}
+		*static_cast<size_t*>(block) = size;
+		auto& c = bench::detail::counters;
+		if (c.enabled.load(std::memory_order_relaxed)) {
+			c.allocations.fetch_add(1, std::memory_order_relaxed);
+			const int64_t live = c.live.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) + static_cast<int64_t>(size);
+			int64_t peak = c.peak.load(std::memory_order_relaxed);
+			while (live > peak && !c.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+			}
+		}
+		return static_cast<char*>(block) + header_size;
+	}
+
+	void release(void* ptr) noexcept
+	{
+		if (ptr == nullptr) {
+			return;
+		}
+		void* block = static_cast<char*>(ptr) - header_size;
+		auto& c = bench::detail::counters;
+		if (c.enabled.load(std::memory_order_relaxed)) {
+			c.live.fetch_sub(static_cast<int64_t>(*static_cast<size_t*>(block)), std::memory_order_relaxed);
+		}
+		std::free(block);
+	}
+
+	void* allocate_or_throw(size_t size)
+	{
+		void* ptr = allocate(size);
+		if (ptr == nullptr) {
+			throw std::bad_alloc();
+		}
+		return ptr;
+	}
+
+	[[maybe_unused]] const bool installed = (bench::detail::counters.hooked = true);
+}
+
+void* operator new(size_t size) { return allocate_or_throw(size); }
+void* operator new[](size_t size) { return allocate_or_throw(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+
+void operator delete(void* ptr) noexcept { release(ptr); }
+void operator delete[](void* ptr) noexcept { release(ptr); }
+void operator delete(void* ptr, size_t) noexcept { release(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { release(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { release(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { release(ptr); }
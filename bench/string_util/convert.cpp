@@ -0,0 +1,75 @@
+#include "corpus.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+//* the numeric fields of CSV rows: integers and decimals
+BENCH_CASE(str_to_number)
+{
+	std::vector<std::string> integers, decimals;
+	for (const auto& row : corpus::csv_rows(2000)) {
+		const auto fields = cutil::str::split(row, ',');
+		integers.insert(integers.end(), fields.begin() + 3, fields.begin() + 7);
+		decimals.insert(decimals.end(), fields.begin() + 7, fields.begin() + 9);
+	}
+	
+	bench::measure_and_report("to_number<int>(csv field), per field", integers.size(), corpus::total_size(integers), [&]{
+		long long sum = 0;
+		for (const auto& field : integers) {
+			sum += cutil::str::to_number<int>(field);
+		}
+		bench::do_not_optimize(sum);
+	});
+	bench::measure_and_report("to_number<long long>(csv field), per field", integers.size(), corpus::total_size(integers), [&]{
+		long long sum = 0;
+		for (const auto& field : integers) {
+			sum += cutil::str::to_number<long long>(field);
+		}
+		bench::do_not_optimize(sum);
+	});
+	bench::measure_and_report("to_number<double>(csv field), per field", decimals.size(), corpus::total_size(decimals), [&]{
+		double sum = 0;
+		for (const auto& field : decimals) {
+			sum += cutil::str::to_number<double>(field);
+		}
+		bench::do_not_optimize(sum);
+	});
+	std::vector<std::string> invalid;
+	for (const auto& field : integers) {
+		invalid.push_back("x" + field);
+	}
+	bench::measure_and_report("to_number_opt<int>(invalid field), per field", invalid.size(), corpus::total_size(invalid), [&]{
+		int sum = 0;
+		for (const auto& field : invalid) {
+			sum += cutil::str::to_number_opt<int>(field).value_or(-1);
+		}
+		bench::do_not_optimize(sum);
+	});
+}
+
+//* integers and doubles of the sizes found in the same rows
+BENCH_CASE(str_to_string)
+{
+	std::vector<int> integers;
+	std::vector<double> decimals;
+	for (size_t i = 0; i < 10000; ++i) {
+		integers.push_back(static_cast<int>(bench::random_int(0, 1000000)));
+		decimals.push_back(static_cast<double>(bench::random_int(0, 9999999)) / 100.0);
+	}
+	
+	bench::measure_and_report("to_string(int), per value", integers.size(), integers.size() * 6, [&]{
+		for (int v : integers) {
+			bench::do_not_optimize(cutil::str::to_string(v).size());
+		}
+	});
+	bench::measure_and_report("to_string(int, buffer), per value", integers.size(), integers.size() * 6, [&]{
+		char buf[32];
+		for (int v : integers) {
+			bench::do_not_optimize(cutil::str::to_string(v, buf, sizeof(buf)));
+		}
+	});
+	bench::measure_and_report("to_string(double), per value", decimals.size(), decimals.size() * 8, [&]{
+		for (double v : decimals) {
+			bench::do_not_optimize(cutil::str::to_string(v).size());
+		}
+	});
+}
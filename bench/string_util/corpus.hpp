@@ -0,0 +1,104 @@
+/* UTF-8 encoding
+* generated inputs for StringBench, the same on every run (`bench::rng()` has a fixed seed).
+*/
+#ifndef CONSOLEUTIL_BENCH_CORPUS_HPP__
+#define CONSOLEUTIL_BENCH_CORPUS_HPP__
+
+#include <string>
+#include <vector>
+
+#include "../bench.hpp"
+
+namespace corpus {
+	inline const char* pick(const std::vector<const char*>& choices) {
+		return choices[bench::random_int(0, choices.size() - 1)];
+	}
+	inline std::string two_digits(size_t value) {
+		return std::string(1, static_cast<char>('0' + value / 10 % 10)) + static_cast<char>('0' + value % 10);
+	}
+	
+	//* "2026-10-19 08:15:42.123 INFO  [worker-3] GET /api/v1/items/4812 200 35ms user=alice", about 90 bytes
+	inline std::vector<std::string> log_lines(size_t count) {
+		static const std::vector<const char*> levels = {"DEBUG", "INFO ", "INFO ", "INFO ", "WARN ", "ERROR"};
+		static const std::vector<const char*> methods = {"GET", "GET", "GET", "POST", "PUT", "DELETE"};
+		static const std::vector<const char*> paths = {"/api/v1/items/", "/api/v1/users/", "/static/img/", "/api/v2/orders/", "/health/"};
+		static const std::vector<const char*> users = {"alice", "bob", "carol", "dave", "eve", "mallory", "-"};
+		std::vector<std::string> lines;
+		for (size_t i = 0; i < count; ++i) {
+			std::string line = "2026-10-19 " + two_digits(bench::random_int(0, 23)) + ':' + two_digits(bench::random_int(0, 59)) + ':'
+				+ two_digits(bench::random_int(0, 59)) + '.' + std::to_string(bench::random_int(100, 999)) + ' ' + pick(levels)
+				+ " [worker-" + std::to_string(bench::random_int(0, 15)) + "] " + pick(methods) + ' ' + pick(paths)
+				+ std::to_string(bench::random_int(1, 99999)) + ' ' + pick({"200", "200", "200", "304", "404", "500"}) + ' '
+				+ std::to_string(bench::random_int(1, 2000)) + "ms user=" + pick(users);
+			lines.push_back(std::move(line));
+		}
+		return lines;
+	}
+	
+	//* 12 fields: id, name, city, integers, decimals, a date, a flag and a short free text; about 100 bytes
+	inline std::vector<std::string> csv_rows(size_t count) {
+		std::vector<std::string> rows;
+		for (size_t i = 0; i < count; ++i) {
+			std::string row = std::to_string(100000 + i) + ',' + bench::random_word(4, 10) + ',' + bench::random_word(5, 12);
+			for (int k = 0; k < 4; ++k) {
+				row += ',' + std::to_string(bench::random_int(0, 1000000));
+			}
+			for (int k = 0; k < 2; ++k) {
+				row += ',' + std::to_string(bench::random_int(0, 99999)) + '.' + two_digits(bench::random_int(0, 99));
+			}
+			row += ",2026-" + two_digits(bench::random_int(1, 12)) + '-' + two_digits(bench::random_int(1, 28));
+			row += bench::random_int(0, 1) ? ",true," : ",false,";
+			row += bench::random_word(3, 8) + ' ' + bench::random_word(3, 8) + ' ' + bench::random_word(3, 8);
+			rows.push_back(std::move(row));
+		}
+		return rows;
+	}
+	
+	//* identifiers of 3 - 16 chars drawn from `distinct` different ones, in mixed case and some with blanks around them
+	inline std::vector<std::string> short_keys(size_t count, size_t distinct) {
+		std::vector<std::string> pool;
+		for (size_t i = 0; i < distinct; ++i) {
+			std::string key = bench::random_word(3, 16);
+			key[0] = static_cast<char>(key[0] - 'a' + 'A');
+			pool.push_back(std::move(key));
+		}
+		std::vector<std::string> keys;
+		for (size_t i = 0; i < count; ++i) {
+			const std::string& key = pool[bench::random_int(0, distinct - 1)];
+			keys.push_back(i % 4 == 0 ? "  " + key + " \t" : key);
+		}
+		return keys;
+	}
+	
+	//* about `size` bytes of prose: sentences of lowercase words, some capitalized, punctuation, line breaks between paragraphs
+	inline std::string long_text(size_t size) {
+		static const std::vector<const char*> common = {"the", "of", "and", "to", "in", "is", "that", "for", "it", "as", "with", "was"};
+		std::string text;
+		text.reserve(size + 64);
+		while (text.size() < size) {
+			const size_t words = bench::random_int(6, 20);
+			for (size_t i = 0; i < words; ++i) {
+				std::string word = bench::random_int(0, 2) == 0 ? std::string(pick(common)) : bench::random_word(2, 11);
+				if (i == 0) {
+					word[0] = static_cast<char>(word[0] - 'a' + 'A');
+				}
+				text += word;
+				text += (i + 1 == words) ? ". " : (bench::random_int(0, 9) == 0 ? ", " : " ");
+			}
+			if (bench::random_int(0, 5) == 0) {
+				text += "\n\n";
+			}
+		}
+		return text;
+	}
+	
+	inline size_t total_size(const std::vector<std::string>& strings) {
+		size_t size = 0;
+		for (const auto& str : strings) {
+			size += str.size();
+		}
+		return size;
+	}
+} // namespace corpus
+
+#endif /* CONSOLEUTIL_BENCH_CORPUS_HPP__ */
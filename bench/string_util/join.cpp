@@ -0,0 +1,49 @@
+#include "corpus.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+//* joining the fields of CSV rows back, and a long list of keys
+BENCH_CASE(str_join)
+{
+	std::vector<std::vector<std::string>> rows;
+	size_t row_bytes = 0;
+	for (const auto& row : corpus::csv_rows(1000)) {
+		rows.push_back(cutil::str::split(row, ','));
+		row_bytes += row.size();
+	}
+	const auto keys = corpus::short_keys(10000, 10000);
+	const size_t key_bytes = corpus::total_size(keys);
+	std::vector<int> numbers;
+	for (size_t i = 0; i < 10000; ++i) {
+		numbers.push_back(static_cast<int>(bench::random_int(0, 1000000)));
+	}
+	
+	bench::measure_and_report("join(12 fields, \",\"), per row", rows.size(), row_bytes, [&]{
+		for (const auto& fields : rows) {
+			bench::do_not_optimize(cutil::str::join(fields, ",").size());
+		}
+	});
+	bench::measure_and_report("join(10k keys, \", \")", 1, key_bytes, [&]{
+		bench::do_not_optimize(cutil::str::join(keys, ", ").size());
+	});
+	bench::measure_and_report("join(10k ints, \",\")", 1, numbers.size() * 7, [&]{
+		bench::do_not_optimize(cutil::str::join(numbers, ",").size());
+	});
+}
+
+//* removing repeated keys: few duplicates, many duplicates
+BENCH_CASE(str_drop_duplicate)
+{
+	for (size_t distinct : {9000, 1000, 20}) {
+		const auto keys = corpus::short_keys(10000, distinct);
+		const size_t bytes = corpus::total_size(keys);
+		bench::measure_and_report("drop_duplicate_copy(10k keys, " + std::to_string(distinct) + " distinct)", 1, bytes, [&]{
+			bench::do_not_optimize(cutil::str::drop_duplicate_copy(keys).size());
+		});
+		bench::measure_and_report("drop_duplicate(copy of 10k keys, " + std::to_string(distinct) + " distinct)", 1, bytes, [&]{
+			std::vector<std::string> copy = keys;
+			cutil::str::drop_duplicate(copy);
+			bench::do_not_optimize(copy.size());
+		});
+	}
+}
@@ -0,0 +1,47 @@
+#include "corpus.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+//* tokenizing log lines and CSV rows; split_view() is the no-copy baseline
+BENCH_CASE(str_split)
+{
+	const auto lines = corpus::log_lines(1000);
+	const auto rows = corpus::csv_rows(1000);
+	const size_t line_bytes = corpus::total_size(lines);
+	const size_t row_bytes = corpus::total_size(rows);
+	
+	bench::measure_and_report("split(log line, ' '), per line", lines.size(), line_bytes, [&]{
+		for (const auto& line : lines) {
+			bench::do_not_optimize(cutil::str::split(line, ' ').size());
+		}
+	});
+	bench::measure_and_report("split(csv row, ','), per row", rows.size(), row_bytes, [&]{
+		for (const auto& row : rows) {
+			bench::do_not_optimize(cutil::str::split(row, ',').size());
+		}
+	});
+	bench::measure_and_report("split(csv row, \",\" string delim), per row", rows.size(), row_bytes, [&]{
+		const std::string delim = ",";
+		for (const auto& row : rows) {
+			bench::do_not_optimize(cutil::str::split(row, delim).size());
+		}
+	});
+	bench::measure_and_report("split_view(csv row, ','), reused vector, per row", rows.size(), row_bytes, [&]{
+		std::vector<std::string_view> fields;
+		for (const auto& row : rows) {
+			cutil::str::split_view(row, ',', fields);
+			bench::do_not_optimize(fields.size());
+		}
+	});
+	bench::measure_and_report("split_any(log line, \" []=\"), per line", lines.size(), line_bytes, [&]{
+		const std::string delims = " []=";
+		for (const auto& line : lines) {
+			bench::do_not_optimize(cutil::str::split_any(line, delims).size());
+		}
+	});
+	bench::measure_and_report("regex_split(log line, \"\\\\s+\"), per line", lines.size(), line_bytes, [&]{
+		for (const auto& line : lines) {
+			bench::do_not_optimize(cutil::str::regex_split(line, "\\s+").size());
+		}
+	});
+}
@@ -0,0 +1,78 @@
+#include "corpus.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+//* trimming short keys (a quarter of them padded) and a padded long text
+BENCH_CASE(str_trim)
+{
+	const auto keys = corpus::short_keys(10000, 1000);
+	const size_t key_bytes = corpus::total_size(keys);
+	const std::string text = "  \t\n" + corpus::long_text(1 << 20) + " \n\n";
+	
+	bench::measure_and_report("trim_copy(short key), per key", keys.size(), key_bytes, [&]{
+		for (const auto& key : keys) {
+			bench::do_not_optimize(cutil::str::trim_copy(key).size());
+		}
+	});
+	bench::measure_and_report("trim(short key) in place, with the copy, per key", keys.size(), key_bytes, [&]{
+		for (const auto& key : keys) {
+			std::string copy = key;
+			cutil::str::trim(copy);
+			bench::do_not_optimize(copy.size());
+		}
+	});
+	bench::measure_and_report("trim_copy(1 MB text)", 1, text.size(), [&]{
+		bench::do_not_optimize(cutil::str::trim_copy(text).size());
+	});
+}
+
+//* replacing in place: common word in prose, a growing replacement in log lines, and no match at all
+BENCH_CASE(str_replace_all)
+{
+	const std::string text = corpus::long_text(1 << 20);
+	const auto lines = corpus::log_lines(1000);
+	const size_t line_bytes = corpus::total_size(lines);
+	
+	bench::measure_and_report("replace_all(1 MB text, \" the \" -> \" THE \"), with the copy", 1, text.size(), [&]{
+		std::string copy = text;
+		cutil::str::replace_all(copy, " the ", " THE ");
+		bench::do_not_optimize(copy.size());
+	});
+	bench::measure_and_report("replace_all(1 MB text, \"e\" -> \"\"), with the copy", 1, text.size(), [&]{
+		std::string copy = text;
+		cutil::str::replace_all(copy, "e", "");
+		bench::do_not_optimize(copy.size());
+	});
+	bench::measure_and_report("replace_all(1 MB text, no match), with the copy", 1, text.size(), [&]{
+		std::string copy = text;
+		cutil::str::replace_all(copy, "zzqx", "-");
+		bench::do_not_optimize(copy.size());
+	});
+	bench::measure_and_report("replace_all(log line, \"INFO \" -> \"information\"), per line", lines.size(), line_bytes, [&]{
+		for (const auto& line : lines) {
+			std::string copy = line;
+			cutil::str::replace_all(copy, "INFO ", "information");
+			bench::do_not_optimize(copy.size());
+		}
+	});
+}
+
+//* ASCII case conversion of log lines and a long text
+BENCH_CASE(str_to_lower)
+{
+	const auto lines = corpus::log_lines(1000);
+	const size_t line_bytes = corpus::total_size(lines);
+	const std::string text = corpus::long_text(1 << 20);
+	
+	bench::measure_and_report("to_lower(log line), per line", lines.size(), line_bytes, [&]{
+		for (const auto& line : lines) {
+			bench::do_not_optimize(cutil::str::to_lower(line).size());
+		}
+	});
+	bench::measure_and_report("to_lower(1 MB text)", 1, text.size(), [&]{
+		bench::do_not_optimize(cutil::str::to_lower(text).size());
+	});
+	bench::measure_and_report("to_upper(1 MB text)", 1, text.size(), [&]{
+		bench::do_not_optimize(cutil::str::to_upper(text).size());
+	});
+}
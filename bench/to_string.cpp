@@ -0,0 +1,178 @@
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+#include "bench.hpp"
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+namespace {
+	template<typename T>
+	std::string stream_to_string(T value) {
+		std::stringstream ss;
+		ss << value;
+		return ss.str();
+	}
+	template<typename T>
+	T stream_parse_string(const std::string& str) {
+		T result;
+		std::istringstream(str) >> result;
+		return result;
+	}
+	
+	template<typename T>
+	void run(const char* type_name, const std::vector<T>& values) {
+		std::vector<std::string> texts;
+		for (const auto& v : values) {
+			texts.push_back(cutil::str::to_string(v));
+		}
+		const std::string suffix = std::string("<") + type_name + ">, per value";
+		const double n = static_cast<double>(values.size());
+		
+		bench::report("stringstream << " + suffix, bench::measure([&]{
+			for (const auto& v : values) {
+				bench::do_not_optimize(stream_to_string(v));
+			}
+		}) / n);
+		bench::report("to_string" + suffix, bench::measure([&]{
+			for (const auto& v : values) {
+				bench::do_not_optimize(cutil::str::to_string(v));
+			}
+		}) / n);
+		bench::report("to_string(buffer)" + suffix, bench::measure([&]{
+			char buf[64];
+			for (const auto& v : values) {
+				bench::do_not_optimize(cutil::str::to_string(v, buf, sizeof(buf)));
+			}
+		}) / n);
+		bench::report("istringstream >> " + suffix, bench::measure([&]{
+			for (const auto& s : texts) {
+				bench::do_not_optimize(stream_parse_string<T>(s));
+			}
+		}) / n);
+		bench::report("parse_string" + suffix, bench::measure([&]{
+			for (const auto& s : texts) {
+				bench::do_not_optimize(cutil::str::parse_string<T>(s));
+			}
+		}) / n);
+	}
+}
+
+//* arithmetic <-> text, the stream based implementation vs. `to_chars()` / `from_chars()`
+BENCH_CASE(to_string)
+{
+	std::vector<int> ints;
+	std::vector<double> doubles;
+	for (size_t i = 0; i < 1000; ++i) {
+		ints.push_back(static_cast<int>(bench::random_int(0, 2000000000)) - 1000000000);
+		doubles.push_back(static_cast<double>(bench::random_int(0, 1000000)) / 997.0);
+	}
+	run("int", ints);
+	run("double", doubles);
+}
+
+//* integer parsing: `std::stoll()` vs. `std::from_chars()` vs. the SWAR `parse_integer()`
+BENCH_CASE(to_number)
+{
+	std::vector<std::string> texts;
+	size_t total_bytes = 0;
+	for (size_t i = 0; i < 1000; ++i) {
+		texts.push_back(std::to_string(bench::rng()() >> bench::random_int(1, 40)));
+		total_bytes += texts.back().size();
+	}
+	const double n = static_cast<double>(texts.size());
+	
+	bench::report("std::stoll, per value", bench::measure([&]{
+		for (const auto& s : texts) {
+			bench::do_not_optimize(std::stoll(s));
+		}
+	}) / n, total_bytes / texts.size());
+	bench::report("std::from_chars, per value", bench::measure([&]{
+		for (const auto& s : texts) {
+			int64_t v = 0;
+			std::from_chars(s.data(), s.data() + s.size(), v);
+			bench::do_not_optimize(v);
+		}
+	}) / n, total_bytes / texts.size());
+	bench::report("parse_integer, per value", bench::measure([&]{
+		for (const auto& s : texts) {
+			int64_t v = 0;
+			cutil::str::parse_integer(s.data(), s.data() + s.size(), v);
+			bench::do_not_optimize(v);
+		}
+	}) / n, total_bytes / texts.size());
+	bench::report("to_number<int64_t>, per value", bench::measure([&]{
+		for (const auto& s : texts) {
+			bench::do_not_optimize(cutil::str::to_number<int64_t>(s));
+		}
+	}) / n, total_bytes / texts.size());
+	bench::report("to_number<int64_t> invalid input (was: catch), per value", bench::measure([&]{
+		for (size_t i = 0; i < 100; ++i) {
+			bench::do_not_optimize(cutil::str::to_number<int64_t>("n/a", int64_t(-1)));
+		}
+	}) / 100.0);
+}
+
+//* float <-> text: the C library and `std::to_chars()` / `std::from_chars()` vs. Eisel-Lemire and Schubfach
+BENCH_CASE(float_conv)
+{
+	std::vector<double> values;
+	std::vector<std::string> texts;
+	size_t total_bytes = 0;
+	for (size_t i = 0; i < 1000; ++i) {
+		uint64_t bits = bench::rng()();
+		bits = (bits & ~(uint64_t(0x7FF) << 52)) | (uint64_t(bench::random_int(1023 - 60, 1023 + 60)) << 52);
+		double v;
+		std::memcpy(&v, &bits, sizeof(v));
+		values.push_back(v);
+		char buf[cutil::str::float_chars_max];
+		texts.emplace_back(buf, cutil::str::float_to_chars(buf, buf + sizeof(buf), v));
+		total_bytes += texts.back().size();
+	}
+	const double n = static_cast<double>(values.size());
+	const size_t bytes = total_bytes / texts.size();
+	
+	bench::report("snprintf(\"%.17g\"), per value", bench::measure([&]{
+		char buf[64];
+		for (double v : values) {
+			bench::do_not_optimize(std::snprintf(buf, sizeof(buf), "%.17g", v));
+		}
+	}) / n);
+	bench::report("std::to_chars, per value", bench::measure([&]{
+		char buf[64];
+		for (double v : values) {
+			bench::do_not_optimize(std::to_chars(buf, buf + sizeof(buf), v).ptr);
+		}
+	}) / n);
+	bench::report("float_to_chars, per value", bench::measure([&]{
+		char buf[cutil::str::float_chars_max];
+		for (double v : values) {
+			bench::do_not_optimize(cutil::str::float_to_chars(buf, buf + sizeof(buf), v));
+		}
+	}) / n);
+	
+	bench::report("std::strtod, per value", bench::measure([&]{
+		for (const auto& s : texts) {
+			bench::do_not_optimize(std::strtod(s.c_str(), nullptr));
+		}
+	}) / n, bytes);
+	bench::report("std::from_chars, per value", bench::measure([&]{
+		for (const auto& s : texts) {
+			double v = 0;
+			std::from_chars(s.data(), s.data() + s.size(), v);
+			bench::do_not_optimize(v);
+		}
+	}) / n, bytes);
+	bench::report("parse_float, per value", bench::measure([&]{
+		for (const auto& s : texts) {
+			double v = 0;
+			cutil::str::parse_float(s.data(), s.data() + s.size(), v);
+			bench::do_not_optimize(v);
+		}
+	}) / n, bytes);
+	bench::report("to_number<double>, per value", bench::measure([&]{
+		for (const auto& s : texts) {
+			bench::do_not_optimize(cutil::str::to_number<double>(s));
+		}
+	}) / n, bytes);
+}
@@ -23,8 +23,12 @@
 	#include <ConsoleUtil/CppBase.hpp>
 	#include <ConsoleUtil/CppUtil.hpp>
 	#include <ConsoleUtil/CppBit.hpp>
+	#include <ConsoleUtil/CppHash.hpp>
 	#include <ConsoleUtil/CppMath.hpp>
 	#include <ConsoleUtil/CppScopeGuard.hpp>
+	#include <ConsoleUtil/CppCharConv.hpp>
+	#include <ConsoleUtil/CppEncoding.hpp>
+	#include <ConsoleUtil/CppHexBase64.hpp>
 	#include <ConsoleUtil/CppStringUtil.hpp>
 	#include <ConsoleUtil/QtUtil.hpp>
 	
@@ -32,6 +36,12 @@
 	#include <ConsoleUtil/External/Span.hpp>
 	
 	#ifdef CUTIL_CPP17_SUPPORTED
+		#include <ConsoleUtil/CppInlineString.hpp>
+		#include <ConsoleUtil/CppStringSwitch.hpp>
+		#include <ConsoleUtil/CppMappedFile.hpp>
+		#include <ConsoleUtil/CppCsvReader.hpp>
+		#include <ConsoleUtil/CppIniParser.hpp>
+		
 		#include <ConsoleUtil/External/XorStr.hpp>
 		
 		#include "ConsoleUtil/External/MagicEnum/magic_enum.hpp"
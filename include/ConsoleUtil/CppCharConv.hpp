@@ -0,0 +1,1409 @@
+#ifndef CONSOLEUTIL_CPP_CHAR_CONV_HPP__
+#define CONSOLEUTIL_CPP_CHAR_CONV_HPP__
+/* UTF-8 encoding
+* Project URL: https://github.com/BH2WFR/ConsoleUtil
+  Author:		BH2WFR
+  Updated:		19 OCT 2026
+  License:		MIT License
+* You can include this header in header files.
+* C++14 or later is required.
+*
+* Locale-independent floating-point conversions, usable before C++17:
+*   `cutil::str::parse_float()`    - Eisel-Lemire fast path, exact `strtod()` fallback for the rare ambiguous inputs.
+*   `cutil::str::float_to_chars()` - shortest round-trip text (Schubfach), same output as `std::to_chars(first, last, value)`.
+*/
+#include <ConsoleUtil/Base.h>
+#include <ConsoleUtil/CppBase.hpp>
+
+#ifndef CUTIL_CPP14_SUPPORTED
+	#error ">= C++14 is required"
+#endif
+
+#include <cfloat>
+#include <clocale>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+#if defined(CUTIL_COMPILER_MSVC) && defined(CUTIL_CPU_ARCH_X86_64)
+	#include <intrin.h>
+#endif
+
+
+_CUTIL_NAMESPACE_BEGIN
+namespace str
+{
+	/**
+	 * @brief Result of the non-throwing parsers, like `std::from_chars_result`.
+	 *        `ptr` points past the last parsed character (or to the input if nothing was parsed),
+	 *        `ec` is `std::errc()`, `std::errc::invalid_argument` or `std::errc::result_out_of_range`.
+	 */
+	struct parse_result {
+		const char* ptr;
+		std::errc ec;
+	};
+	
+	//* `float_to_chars()` never writes more characters than this, e.g. "-2.2250738585072014e-308"
+	static constexpr size_t float_chars_max = 32;
+	
+	namespace internal{
+		struct uint128 {
+			uint64_t hi;
+			uint64_t lo;
+		};
+		
+		inline uint128 mul_64x64(uint64_t a, uint64_t b)
+		{
+		#if defined(__SIZEOF_INT128__)
+			__extension__ using u128 = unsigned __int128;
+			const u128 p = static_cast<u128>(a) * b;
+			return {static_cast<uint64_t>(p >> 64), static_cast<uint64_t>(p)};
+		#elif defined(CUTIL_COMPILER_MSVC) && defined(CUTIL_CPU_ARCH_X86_64)
+			uint64_t hi;
+			const uint64_t lo = _umul128(a, b, &hi);
+			return {hi, lo};
+		#else
+			const uint64_t a_lo = a & 0xFFFFFFFFu, a_hi = a >> 32;
+			const uint64_t b_lo = b & 0xFFFFFFFFu, b_hi = b >> 32;
+			const uint64_t lo_lo = a_lo * b_lo;
+			const uint64_t hi_lo = a_hi * b_lo;
+			const uint64_t lo_hi = a_lo * b_hi;
+			const uint64_t hi_hi = a_hi * b_hi;
+			const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFu) + lo_hi;
+			return {(hi_lo >> 32) + (cross >> 32) + hi_hi, (cross << 32) | (lo_lo & 0xFFFFFFFFu)};
+		#endif
+		}
+		
+		inline int count_leading_zeros(uint64_t x)
+		{
+			int n = 0;
+			while ((x & (uint64_t(1) << 63)) == 0) {
+				x <<= 1;
+				++n;
+			}
+			return n;
+		}
+		
+		//* IEEE-754 layout and the bounds used by both algorithms
+		template <typename T>
+		struct float_traits;
+		
+		template <>
+		struct float_traits<double> {
+			using bits_type = uint64_t;
+			static constexpr int mantissa_bits = 52;			// explicit bits, without the hidden one
+			static constexpr int exponent_bits = 11;
+			static constexpr int minimum_exponent = -1023;
+			static constexpr int infinite_power = 0x7FF;
+			static constexpr int smallest_power_of_ten = -342;	// below: always rounds to zero
+			static constexpr int largest_power_of_ten = 308;	// above: always infinity
+			static constexpr int min_exponent_round_to_even = -4;
+			static constexpr int max_exponent_round_to_even = 23;
+			static constexpr int max_exponent_fast_path = 22;	// 10^22 is the largest exact power
+			static constexpr int min_binary_exponent = -1074;	// exponent of the smallest subnormal
+		};
+		template <>
+		struct float_traits<float> {
+			using bits_type = uint32_t;
+			static constexpr int mantissa_bits = 23;
+			static constexpr int exponent_bits = 8;
+			static constexpr int minimum_exponent = -127;
+			static constexpr int infinite_power = 0xFF;
+			static constexpr int smallest_power_of_ten = -64;
+			static constexpr int largest_power_of_ten = 38;
+			static constexpr int min_exponent_round_to_even = -17;
+			static constexpr int max_exponent_round_to_even = 10;
+			static constexpr int max_exponent_fast_path = 10;
+			static constexpr int min_binary_exponent = -149;
+		};
+		
+		template <typename T>
+		inline typename float_traits<T>::bits_type float_to_bits(T value)
+		{
+			typename float_traits<T>::bits_type bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			return bits;
+		}
+		template <typename T>
+		inline T float_from_bits(typename float_traits<T>::bits_type bits)
+		{
+			T value;
+			std::memcpy(&value, &bits, sizeof(value));
+			return value;
+		}
+		
+		//* 128-bit approximations of 5^q for q in [-342, 308], (high, low) pairs, most significant bit set.
+		//  truncated for q >= 0, rounded up for q < 0, same layout as the fast_float library.
+		inline const uint64_t* power_of_five_128()
+		{
+			static constexpr uint64_t table[] = {
+				0xEEF453D6923BD65A, 0x113FAA2906A13B3F, 0x9558B4661B6565F8, 0x4AC7CA59A424C507,
+				0xBAAEE17FA23EBF76, 0x5D79BCF00D2DF649, 0xE95A99DF8ACE6F53, 0xF4D82C2C107973DC,
+				0x91D8A02BB6C10594, 0x79071B9B8A4BE869, 0xB64EC836A47146F9, 0x9748E2826CDEE284,
+				0xE3E27A444D8D98B7, 0xFD1B1B2308169B25, 0x8E6D8C6AB0787F72, 0xFE30F0F5E50E20F7,
+				0xB208EF855C969F4F, 0xBDBD2D335E51A935, 0xDE8B2B66B3BC4723, 0xAD2C788035E61382,
+				0x8B16FB203055AC76, 0x4C3BCB5021AFCC31, 0xADDCB9E83C6B1793, 0xDF4ABE242A1BBF3D,
+				0xD953E8624B85DD78, 0xD71D6DAD34A2AF0D, 0x87D4713D6F33AA6B, 0x8672648C40E5AD68,
+				0xA9C98D8CCB009506, 0x680EFDAF511F18C2, 0xD43BF0EFFDC0BA48, 0x0212BD1B2566DEF2,
+				0x84A57695FE98746D, 0x014BB630F7604B57, 0xA5CED43B7E3E9188, 0x419EA3BD35385E2D,
+				0xCF42894A5DCE35EA, 0x52064CAC828675B9, 0x818995CE7AA0E1B2, 0x7343EFEBD1940993,
+				0xA1EBFB4219491A1F, 0x1014EBE6C5F90BF8, 0xCA66FA129F9B60A6, 0xD41A26E077774EF6,
+				0xFD00B897478238D0, 0x8920B098955522B4, 0x9E20735E8CB16382, 0x55B46E5F5D5535B0,
+				0xC5A890362FDDBC62, 0xEB2189F734AA831D, 0xF712B443BBD52B7B, 0xA5E9EC7501D523E4,
+				0x9A6BB0AA55653B2D, 0x47B233C92125366E, 0xC1069CD4EABE89F8, 0x999EC0BB696E840A,
+				0xF148440A256E2C76, 0xC00670EA43CA250D, 0x96CD2A865764DBCA, 0x380406926A5E5728,
+				0xBC807527ED3E12BC, 0xC605083704F5ECF2, 0xEBA09271E88D976B, 0xF7864A44C633682E,
+				0x93445B8731587EA3, 0x7AB3EE6AFBE0211D, 0xB8157268FDAE9E4C, 0x5960EA05BAD82964,
+				0xE61ACF033D1A45DF, 0x6FB92487298E33BD, 0x8FD0C16206306BAB, 0xA5D3B6D479F8E056,
+				0xB3C4F1BA87BC8696, 0x8F48A4899877186C, 0xE0B62E2929ABA83C, 0x331ACDABFE94DE87,
+				0x8C71DCD9BA0B4925, 0x9FF0C08B7F1D0B14, 0xAF8E5410288E1B6F, 0x07ECF0AE5EE44DD9,
+				0xDB71E91432B1A24A, 0xC9E82CD9F69D6150, 0x892731AC9FAF056E, 0xBE311C083A225CD2,
+				0xAB70FE17C79AC6CA, 0x6DBD630A48AAF406, 0xD64D3D9DB981787D, 0x092CBBCCDAD5B108,
+				0x85F0468293F0EB4E, 0x25BBF56008C58EA5, 0xA76C582338ED2621, 0xAF2AF2B80AF6F24E,
+				0xD1476E2C07286FAA, 0x1AF5AF660DB4AEE1, 0x82CCA4DB847945CA, 0x50D98D9FC890ED4D,
+				0xA37FCE126597973C, 0xE50FF107BAB528A0, 0xCC5FC196FEFD7D0C, 0x1E53ED49A96272C8,
+				0xFF77B1FCBEBCDC4F, 0x25E8E89C13BB0F7A, 0x9FAACF3DF73609B1, 0x77B191618C54E9AC,
+				0xC795830D75038C1D, 0xD59DF5B9EF6A2417, 0xF97AE3D0D2446F25, 0x4B0573286B44AD1D,
+				0x9BECCE62836AC577, 0x4EE367F9430AEC32, 0xC2E801FB244576D5, 0x229C41F793CDA73F,
+				0xF3A20279ED56D48A, 0x6B43527578C1110F, 0x9845418C345644D6, 0x830A13896B78AAA9,
+				0xBE5691EF416BD60C, 0x23CC986BC656D553, 0xEDEC366B11C6CB8F, 0x2CBFBE86B7EC8AA8,
+				0x94B3A202EB1C3F39, 0x7BF7D71432F3D6A9, 0xB9E08A83A5E34F07, 0xDAF5CCD93FB0CC53,
+				0xE858AD248F5C22C9, 0xD1B3400F8F9CFF68, 0x91376C36D99995BE, 0x23100809B9C21FA1,
+				0xB58547448FFFFB2D, 0xABD40A0C2832A78A, 0xE2E69915B3FFF9F9, 0x16C90C8F323F516C,
+				0x8DD01FAD907FFC3B, 0xAE3DA7D97F6792E3, 0xB1442798F49FFB4A, 0x99CD11CFDF41779C,
+				0xDD95317F31C7FA1D, 0x40405643D711D583, 0x8A7D3EEF7F1CFC52, 0x482835EA666B2572,
+				0xAD1C8EAB5EE43B66, 0xDA3243650005EECF, 0xD863B256369D4A40, 0x90BED43E40076A82,
+				0x873E4F75E2224E68, 0x5A7744A6E804A291, 0xA90DE3535AAAE202, 0x711515D0A205CB36,
+				0xD3515C2831559A83, 0x0D5A5B44CA873E03, 0x8412D9991ED58091, 0xE858790AFE9486C2,
+				0xA5178FFF668AE0B6, 0x626E974DBE39A872, 0xCE5D73FF402D98E3, 0xFB0A3D212DC8128F,
+				0x80FA687F881C7F8E, 0x7CE66634BC9D0B99, 0xA139029F6A239F72, 0x1C1FFFC1EBC44E80,
+				0xC987434744AC874E, 0xA327FFB266B56220, 0xFBE9141915D7A922, 0x4BF1FF9F0062BAA8,
+				0x9D71AC8FADA6C9B5, 0x6F773FC3603DB4A9, 0xC4CE17B399107C22, 0xCB550FB4384D21D3,
+				0xF6019DA07F549B2B, 0x7E2A53A146606A48, 0x99C102844F94E0FB, 0x2EDA7444CBFC426D,
+				0xC0314325637A1939, 0xFA911155FEFB5308, 0xF03D93EEBC589F88, 0x793555AB7EBA27CA,
+				0x96267C7535B763B5, 0x4BC1558B2F3458DE, 0xBBB01B9283253CA2, 0x9EB1AAEDFB016F16,
+				0xEA9C227723EE8BCB, 0x465E15A979C1CADC, 0x92A1958A7675175F, 0x0BFACD89EC191EC9,
+				0xB749FAED14125D36, 0xCEF980EC671F667B, 0xE51C79A85916F484, 0x82B7E12780E7401A,
+				0x8F31CC0937AE58D2, 0xD1B2ECB8B0908810, 0xB2FE3F0B8599EF07, 0x861FA7E6DCB4AA15,
+				0xDFBDCECE67006AC9, 0x67A791E093E1D49A, 0x8BD6A141006042BD, 0xE0C8BB2C5C6D24E0,
+				0xAECC49914078536D, 0x58FAE9F773886E18, 0xDA7F5BF590966848, 0xAF39A475506A899E,
+				0x888F99797A5E012D, 0x6D8406C952429603, 0xAAB37FD7D8F58178, 0xC8E5087BA6D33B83,
+				0xD5605FCDCF32E1D6, 0xFB1E4A9A90880A64, 0x855C3BE0A17FCD26, 0x5CF2EEA09A55067F,
+				0xA6B34AD8C9DFC06F, 0xF42FAA48C0EA481E, 0xD0601D8EFC57B08B, 0xF13B94DAF124DA26,
+				0x823C12795DB6CE57, 0x76C53D08D6B70858, 0xA2CB1717B52481ED, 0x54768C4B0C64CA6E,
+				0xCB7DDCDDA26DA268, 0xA9942F5DCF7DFD09, 0xFE5D54150B090B02, 0xD3F93B35435D7C4C,
+				0x9EFA548D26E5A6E1, 0xC47BC5014A1A6DAF, 0xC6B8E9B0709F109A, 0x359AB6419CA1091B,
+				0xF867241C8CC6D4C0, 0xC30163D203C94B62, 0x9B407691D7FC44F8, 0x79E0DE63425DCF1D,
+				0xC21094364DFB5636, 0x985915FC12F542E4, 0xF294B943E17A2BC4, 0x3E6F5B7B17B2939D,
+				0x979CF3CA6CEC5B5A, 0xA705992CEECF9C42, 0xBD8430BD08277231, 0x50C6FF782A838353,
+				0xECE53CEC4A314EBD, 0xA4F8BF5635246428, 0x940F4613AE5ED136, 0x871B7795E136BE99,
+				0xB913179899F68584, 0x28E2557B59846E3F, 0xE757DD7EC07426E5, 0x331AEADA2FE589CF,
+				0x9096EA6F3848984F, 0x3FF0D2C85DEF7621, 0xB4BCA50B065ABE63, 0x0FED077A756B53A9,
+				0xE1EBCE4DC7F16DFB, 0xD3E8495912C62894, 0x8D3360F09CF6E4BD, 0x64712DD7ABBBD95C,
+				0xB080392CC4349DEC, 0xBD8D794D96AACFB3, 0xDCA04777F541C567, 0xECF0D7A0FC5583A0,
+				0x89E42CAAF9491B60, 0xF41686C49DB57244, 0xAC5D37D5B79B6239, 0x311C2875C522CED5,
+				0xD77485CB25823AC7, 0x7D633293366B828B, 0x86A8D39EF77164BC, 0xAE5DFF9C02033197,
+				0xA8530886B54DBDEB, 0xD9F57F830283FDFC, 0xD267CAA862A12D66, 0xD072DF63C324FD7B,
+				0x8380DEA93DA4BC60, 0x4247CB9E59F71E6D, 0xA46116538D0DEB78, 0x52D9BE85F074E608,
+				0xCD795BE870516656, 0x67902E276C921F8B, 0x806BD9714632DFF6, 0x00BA1CD8A3DB53B6,
+				0xA086CFCD97BF97F3, 0x80E8A40ECCD228A4, 0xC8A883C0FDAF7DF0, 0x6122CD128006B2CD,
+				0xFAD2A4B13D1B5D6C, 0x796B805720085F81, 0x9CC3A6EEC6311A63, 0xCBE3303674053BB0,
+				0xC3F490AA77BD60FC, 0xBEDBFC4411068A9C, 0xF4F1B4D515ACB93B, 0xEE92FB5515482D44,
+				0x991711052D8BF3C5, 0x751BDD152D4D1C4A, 0xBF5CD54678EEF0B6, 0xD262D45A78A0635D,
+				0xEF340A98172AACE4, 0x86FB897116C87C34, 0x9580869F0E7AAC0E, 0xD45D35E6AE3D4DA0,
+				0xBAE0A846D2195712, 0x8974836059CCA109, 0xE998D258869FACD7, 0x2BD1A438703FC94B,
+				0x91FF83775423CC06, 0x7B6306A34627DDCF, 0xB67F6455292CBF08, 0x1A3BC84C17B1D542,
+				0xE41F3D6A7377EECA, 0x20CABA5F1D9E4A93, 0x8E938662882AF53E, 0x547EB47B7282EE9C,
+				0xB23867FB2A35B28D, 0xE99E619A4F23AA43, 0xDEC681F9F4C31F31, 0x6405FA00E2EC94D4,
+				0x8B3C113C38F9F37E, 0xDE83BC408DD3DD04, 0xAE0B158B4738705E, 0x9624AB50B148D445,
+				0xD98DDAEE19068C76, 0x3BADD624DD9B0957, 0x87F8A8D4CFA417C9, 0xE54CA5D70A80E5D6,
+				0xA9F6D30A038D1DBC, 0x5E9FCF4CCD211F4C, 0xD47487CC8470652B, 0x7647C3200069671F,
+				0x84C8D4DFD2C63F3B, 0x29ECD9F40041E073, 0xA5FB0A17C777CF09, 0xF468107100525890,
+				0xCF79CC9DB955C2CC, 0x7182148D4066EEB4, 0x81AC1FE293D599BF, 0xC6F14CD848405530,
+				0xA21727DB38CB002F, 0xB8ADA00E5A506A7C, 0xCA9CF1D206FDC03B, 0xA6D90811F0E4851C,
+				0xFD442E4688BD304A, 0x908F4A166D1DA663, 0x9E4A9CEC15763E2E, 0x9A598E4E043287FE,
+				0xC5DD44271AD3CDBA, 0x40EFF1E1853F29FD, 0xF7549530E188C128, 0xD12BEE59E68EF47C,
+				0x9A94DD3E8CF578B9, 0x82BB74F8301958CE, 0xC13A148E3032D6E7, 0xE36A52363C1FAF01,
+				0xF18899B1BC3F8CA1, 0xDC44E6C3CB279AC1, 0x96F5600F15A7B7E5, 0x29AB103A5EF8C0B9,
+				0xBCB2B812DB11A5DE, 0x7415D448F6B6F0E7, 0xEBDF661791D60F56, 0x111B495B3464AD21,
+				0x936B9FCEBB25C995, 0xCAB10DD900BEEC34, 0xB84687C269EF3BFB, 0x3D5D514F40EEA742,
+				0xE65829B3046B0AFA, 0x0CB4A5A3112A5112, 0x8FF71A0FE2C2E6DC, 0x47F0E785EABA72AB,
+				0xB3F4E093DB73A093, 0x59ED216765690F56, 0xE0F218B8D25088B8, 0x306869C13EC3532C,
+				0x8C974F7383725573, 0x1E414218C73A13FB, 0xAFBD2350644EEACF, 0xE5D1929EF90898FA,
+				0xDBAC6C247D62A583, 0xDF45F746B74ABF39, 0x894BC396CE5DA772, 0x6B8BBA8C328EB783,
+				0xAB9EB47C81F5114F, 0x066EA92F3F326564, 0xD686619BA27255A2, 0xC80A537B0EFEFEBD,
+				0x8613FD0145877585, 0xBD06742CE95F5F36, 0xA798FC4196E952E7, 0x2C48113823B73704,
+				0xD17F3B51FCA3A7A0, 0xF75A15862CA504C5, 0x82EF85133DE648C4, 0x9A984D73DBE722FB,
+				0xA3AB66580D5FDAF5, 0xC13E60D0D2E0EBBA, 0xCC963FEE10B7D1B3, 0x318DF905079926A8,
+				0xFFBBCFE994E5C61F, 0xFDF17746497F7052, 0x9FD561F1FD0F9BD3, 0xFEB6EA8BEDEFA633,
+				0xC7CABA6E7C5382C8, 0xFE64A52EE96B8FC0, 0xF9BD690A1B68637B, 0x3DFDCE7AA3C673B0,
+				0x9C1661A651213E2D, 0x06BEA10CA65C084E, 0xC31BFA0FE5698DB8, 0x486E494FCFF30A62,
+				0xF3E2F893DEC3F126, 0x5A89DBA3C3EFCCFA, 0x986DDB5C6B3A76B7, 0xF89629465A75E01C,
+				0xBE89523386091465, 0xF6BBB397F1135823, 0xEE2BA6C0678B597F, 0x746AA07DED582E2C,
+				0x94DB483840B717EF, 0xA8C2A44EB4571CDC, 0xBA121A4650E4DDEB, 0x92F34D62616CE413,
+				0xE896A0D7E51E1566, 0x77B020BAF9C81D17, 0x915E2486EF32CD60, 0x0ACE1474DC1D122E,
+				0xB5B5ADA8AAFF80B8, 0x0D819992132456BA, 0xE3231912D5BF60E6, 0x10E1FFF697ED6C69,
+				0x8DF5EFABC5979C8F, 0xCA8D3FFA1EF463C1, 0xB1736B96B6FD83B3, 0xBD308FF8A6B17CB2,
+				0xDDD0467C64BCE4A0, 0xAC7CB3F6D05DDBDE, 0x8AA22C0DBEF60EE4, 0x6BCDF07A423AA96B,
+				0xAD4AB7112EB3929D, 0x86C16C98D2C953C6, 0xD89D64D57A607744, 0xE871C7BF077BA8B7,
+				0x87625F056C7C4A8B, 0x11471CD764AD4972, 0xA93AF6C6C79B5D2D, 0xD598E40D3DD89BCF,
+				0xD389B47879823479, 0x4AFF1D108D4EC2C3, 0x843610CB4BF160CB, 0xCEDF722A585139BA,
+				0xA54394FE1EEDB8FE, 0xC2974EB4EE658828, 0xCE947A3DA6A9273E, 0x733D226229FEEA32,
+				0x811CCC668829B887, 0x0806357D5A3F525F, 0xA163FF802A3426A8, 0xCA07C2DCB0CF26F7,
+				0xC9BCFF6034C13052, 0xFC89B393DD02F0B5, 0xFC2C3F3841F17C67, 0xBBAC2078D443ACE2,
+				0x9D9BA7832936EDC0, 0xD54B944B84AA4C0D, 0xC5029163F384A931, 0x0A9E795E65D4DF11,
+				0xF64335BCF065D37D, 0x4D4617B5FF4A16D5, 0x99EA0196163FA42E, 0x504BCED1BF8E4E45,
+				0xC06481FB9BCF8D39, 0xE45EC2862F71E1D6, 0xF07DA27A82C37088, 0x5D767327BB4E5A4C,
+				0x964E858C91BA2655, 0x3A6A07F8D510F86F, 0xBBE226EFB628AFEA, 0x890489F70A55368B,
+				0xEADAB0ABA3B2DBE5, 0x2B45AC74CCEA842E, 0x92C8AE6B464FC96F, 0x3B0B8BC90012929D,
+				0xB77ADA0617E3BBCB, 0x09CE6EBB40173744, 0xE55990879DDCAABD, 0xCC420A6A101D0515,
+				0x8F57FA54C2A9EAB6, 0x9FA946824A12232D, 0xB32DF8E9F3546564, 0x47939822DC96ABF9,
+				0xDFF9772470297EBD, 0x59787E2B93BC56F7, 0x8BFBEA76C619EF36, 0x57EB4EDB3C55B65A,
+				0xAEFAE51477A06B03, 0xEDE622920B6B23F1, 0xDAB99E59958885C4, 0xE95FAB368E45ECED,
+				0x88B402F7FD75539B, 0x11DBCB0218EBB414, 0xAAE103B5FCD2A881, 0xD652BDC29F26A119,
+				0xD59944A37C0752A2, 0x4BE76D3346F0495F, 0x857FCAE62D8493A5, 0x6F70A4400C562DDB,
+				0xA6DFBD9FB8E5B88E, 0xCB4CCD500F6BB952, 0xD097AD07A71F26B2, 0x7E2000A41346A7A7,
+				0x825ECC24C873782F, 0x8ED400668C0C28C8, 0xA2F67F2DFA90563B, 0x728900802F0F32FA,
+				0xCBB41EF979346BCA, 0x4F2B40A03AD2FFB9, 0xFEA126B7D78186BC, 0xE2F610C84987BFA8,
+				0x9F24B832E6B0F436, 0x0DD9CA7D2DF4D7C9, 0xC6EDE63FA05D3143, 0x91503D1C79720DBB,
+				0xF8A95FCF88747D94, 0x75A44C6397CE912A, 0x9B69DBE1B548CE7C, 0xC986AFBE3EE11ABA,
+				0xC24452DA229B021B, 0xFBE85BADCE996168, 0xF2D56790AB41C2A2, 0xFAE27299423FB9C3,
+				0x97C560BA6B0919A5, 0xDCCD879FC967D41A, 0xBDB6B8E905CB600F, 0x5400E987BBC1C920,
+				0xED246723473E3813, 0x290123E9AAB23B68, 0x9436C0760C86E30B, 0xF9A0B6720AAF6521,
+				0xB94470938FA89BCE, 0xF808E40E8D5B3E69, 0xE7958CB87392C2C2, 0xB60B1D1230B20E04,
+				0x90BD77F3483BB9B9, 0xB1C6F22B5E6F48C2, 0xB4ECD5F01A4AA828, 0x1E38AEB6360B1AF3,
+				0xE2280B6C20DD5232, 0x25C6DA63C38DE1B0, 0x8D590723948A535F, 0x579C487E5A38AD0E,
+				0xB0AF48EC79ACE837, 0x2D835A9DF0C6D851, 0xDCDB1B2798182244, 0xF8E431456CF88E65,
+				0x8A08F0F8BF0F156B, 0x1B8E9ECB641B58FF, 0xAC8B2D36EED2DAC5, 0xE272467E3D222F3F,
+				0xD7ADF884AA879177, 0x5B0ED81DCC6ABB0F, 0x86CCBB52EA94BAEA, 0x98E947129FC2B4E9,
+				0xA87FEA27A539E9A5, 0x3F2398D747B36224, 0xD29FE4B18E88640E, 0x8EEC7F0D19A03AAD,
+				0x83A3EEEEF9153E89, 0x1953CF68300424AC, 0xA48CEAAAB75A8E2B, 0x5FA8C3423C052DD7,
+				0xCDB02555653131B6, 0x3792F412CB06794D, 0x808E17555F3EBF11, 0xE2BBD88BBEE40BD0,
+				0xA0B19D2AB70E6ED6, 0x5B6ACEAEAE9D0EC4, 0xC8DE047564D20A8B, 0xF245825A5A445275,
+				0xFB158592BE068D2E, 0xEED6E2F0F0D56712, 0x9CED737BB6C4183D, 0x55464DD69685606B,
+				0xC428D05AA4751E4C, 0xAA97E14C3C26B886, 0xF53304714D9265DF, 0xD53DD99F4B3066A8,
+				0x993FE2C6D07B7FAB, 0xE546A8038EFE4029, 0xBF8FDB78849A5F96, 0xDE98520472BDD033,
+				0xEF73D256A5C0F77C, 0x963E66858F6D4440, 0x95A8637627989AAD, 0xDDE7001379A44AA8,
+				0xBB127C53B17EC159, 0x5560C018580D5D52, 0xE9D71B689DDE71AF, 0xAAB8F01E6E10B4A6,
+				0x9226712162AB070D, 0xCAB3961304CA70E8, 0xB6B00D69BB55C8D1, 0x3D607B97C5FD0D22,
+				0xE45C10C42A2B3B05, 0x8CB89A7DB77C506A, 0x8EB98A7A9A5B04E3, 0x77F3608E92ADB242,
+				0xB267ED1940F1C61C, 0x55F038B237591ED3, 0xDF01E85F912E37A3, 0x6B6C46DEC52F6688,
+				0x8B61313BBABCE2C6, 0x2323AC4B3B3DA015, 0xAE397D8AA96C1B77, 0xABEC975E0A0D081A,
+				0xD9C7DCED53C72255, 0x96E7BD358C904A21, 0x881CEA14545C7575, 0x7E50D64177DA2E54,
+				0xAA242499697392D2, 0xDDE50BD1D5D0B9E9, 0xD4AD2DBFC3D07787, 0x955E4EC64B44E864,
+				0x84EC3C97DA624AB4, 0xBD5AF13BEF0B113E, 0xA6274BBDD0FADD61, 0xECB1AD8AEACDD58E,
+				0xCFB11EAD453994BA, 0x67DE18EDA5814AF2, 0x81CEB32C4B43FCF4, 0x80EACF948770CED7,
+				0xA2425FF75E14FC31, 0xA1258379A94D028D, 0xCAD2F7F5359A3B3E, 0x096EE45813A04330,
+				0xFD87B5F28300CA0D, 0x8BCA9D6E188853FC, 0x9E74D1B791E07E48, 0x775EA264CF55347E,
+				0xC612062576589DDA, 0x95364AFE032A819E, 0xF79687AED3EEC551, 0x3A83DDBD83F52205,
+				0x9ABE14CD44753B52, 0xC4926A9672793543, 0xC16D9A0095928A27, 0x75B7053C0F178294,
+				0xF1C90080BAF72CB1, 0x5324C68B12DD6339, 0x971DA05074DA7BEE, 0xD3F6FC16EBCA5E04,
+				0xBCE5086492111AEA, 0x88F4BB1CA6BCF585, 0xEC1E4A7DB69561A5, 0x2B31E9E3D06C32E6,
+				0x9392EE8E921D5D07, 0x3AFF322E62439FD0, 0xB877AA3236A4B449, 0x09BEFEB9FAD487C3,
+				0xE69594BEC44DE15B, 0x4C2EBE687989A9B4, 0x901D7CF73AB0ACD9, 0x0F9D37014BF60A11,
+				0xB424DC35095CD80F, 0x538484C19EF38C95, 0xE12E13424BB40E13, 0x2865A5F206B06FBA,
+				0x8CBCCC096F5088CB, 0xF93F87B7442E45D4, 0xAFEBFF0BCB24AAFE, 0xF78F69A51539D749,
+				0xDBE6FECEBDEDD5BE, 0xB573440E5A884D1C, 0x89705F4136B4A597, 0x31680A88F8953031,
+				0xABCC77118461CEFC, 0xFDC20D2B36BA7C3E, 0xD6BF94D5E57A42BC, 0x3D32907604691B4D,
+				0x8637BD05AF6C69B5, 0xA63F9A49C2C1B110, 0xA7C5AC471B478423, 0x0FCF80DC33721D54,
+				0xD1B71758E219652B, 0xD3C36113404EA4A9, 0x83126E978D4FDF3B, 0x645A1CAC083126EA,
+				0xA3D70A3D70A3D70A, 0x3D70A3D70A3D70A4, 0xCCCCCCCCCCCCCCCC, 0xCCCCCCCCCCCCCCCD,
+				0x8000000000000000, 0x0000000000000000, 0xA000000000000000, 0x0000000000000000,
+				0xC800000000000000, 0x0000000000000000, 0xFA00000000000000, 0x0000000000000000,
+				0x9C40000000000000, 0x0000000000000000, 0xC350000000000000, 0x0000000000000000,
+				0xF424000000000000, 0x0000000000000000, 0x9896800000000000, 0x0000000000000000,
+				0xBEBC200000000000, 0x0000000000000000, 0xEE6B280000000000, 0x0000000000000000,
+				0x9502F90000000000, 0x0000000000000000, 0xBA43B74000000000, 0x0000000000000000,
+				0xE8D4A51000000000, 0x0000000000000000, 0x9184E72A00000000, 0x0000000000000000,
+				0xB5E620F480000000, 0x0000000000000000, 0xE35FA931A0000000, 0x0000000000000000,
+				0x8E1BC9BF04000000, 0x0000000000000000, 0xB1A2BC2EC5000000, 0x0000000000000000,
+				0xDE0B6B3A76400000, 0x0000000000000000, 0x8AC7230489E80000, 0x0000000000000000,
+				0xAD78EBC5AC620000, 0x0000000000000000, 0xD8D726B7177A8000, 0x0000000000000000,
+				0x878678326EAC9000, 0x0000000000000000, 0xA968163F0A57B400, 0x0000000000000000,
+				0xD3C21BCECCEDA100, 0x0000000000000000, 0x84595161401484A0, 0x0000000000000000,
+				0xA56FA5B99019A5C8, 0x0000000000000000, 0xCECB8F27F4200F3A, 0x0000000000000000,
+				0x813F3978F8940984, 0x4000000000000000, 0xA18F07D736B90BE5, 0x5000000000000000,
+				0xC9F2C9CD04674EDE, 0xA400000000000000, 0xFC6F7C4045812296, 0x4D00000000000000,
+				0x9DC5ADA82B70B59D, 0xF020000000000000, 0xC5371912364CE305, 0x6C28000000000000,
+				0xF684DF56C3E01BC6, 0xC732000000000000, 0x9A130B963A6C115C, 0x3C7F400000000000,
+				0xC097CE7BC90715B3, 0x4B9F100000000000, 0xF0BDC21ABB48DB20, 0x1E86D40000000000,
+				0x96769950B50D88F4, 0x1314448000000000, 0xBC143FA4E250EB31, 0x17D955A000000000,
+				0xEB194F8E1AE525FD, 0x5DCFAB0800000000, 0x92EFD1B8D0CF37BE, 0x5AA1CAE500000000,
+				0xB7ABC627050305AD, 0xF14A3D9E40000000, 0xE596B7B0C643C719, 0x6D9CCD05D0000000,
+				0x8F7E32CE7BEA5C6F, 0xE4820023A2000000, 0xB35DBF821AE4F38B, 0xDDA2802C8A800000,
+				0xE0352F62A19E306E, 0xD50B2037AD200000, 0x8C213D9DA502DE45, 0x4526F422CC340000,
+				0xAF298D050E4395D6, 0x9670B12B7F410000, 0xDAF3F04651D47B4C, 0x3C0CDD765F114000,
+				0x88D8762BF324CD0F, 0xA5880A69FB6AC800, 0xAB0E93B6EFEE0053, 0x8EEA0D047A457A00,
+				0xD5D238A4ABE98068, 0x72A4904598D6D880, 0x85A36366EB71F041, 0x47A6DA2B7F864750,
+				0xA70C3C40A64E6C51, 0x999090B65F67D924, 0xD0CF4B50CFE20765, 0xFFF4B4E3F741CF6D,
+				0x82818F1281ED449F, 0xBFF8F10E7A8921A4, 0xA321F2D7226895C7, 0xAFF72D52192B6A0D,
+				0xCBEA6F8CEB02BB39, 0x9BF4F8A69F764490, 0xFEE50B7025C36A08, 0x02F236D04753D5B4,
+				0x9F4F2726179A2245, 0x01D762422C946590, 0xC722F0EF9D80AAD6, 0x424D3AD2B7B97EF5,
+				0xF8EBAD2B84E0D58B, 0xD2E0898765A7DEB2, 0x9B934C3B330C8577, 0x63CC55F49F88EB2F,
+				0xC2781F49FFCFA6D5, 0x3CBF6B71C76B25FB, 0xF316271C7FC3908A, 0x8BEF464E3945EF7A,
+				0x97EDD871CFDA3A56, 0x97758BF0E3CBB5AC, 0xBDE94E8E43D0C8EC, 0x3D52EEED1CBEA317,
+				0xED63A231D4C4FB27, 0x4CA7AAA863EE4BDD, 0x945E455F24FB1CF8, 0x8FE8CAA93E74EF6A,
+				0xB975D6B6EE39E436, 0xB3E2FD538E122B44, 0xE7D34C64A9C85D44, 0x60DBBCA87196B616,
+				0x90E40FBEEA1D3A4A, 0xBC8955E946FE31CD, 0xB51D13AEA4A488DD, 0x6BABAB6398BDBE41,
+				0xE264589A4DCDAB14, 0xC696963C7EED2DD1, 0x8D7EB76070A08AEC, 0xFC1E1DE5CF543CA2,
+				0xB0DE65388CC8ADA8, 0x3B25A55F43294BCB, 0xDD15FE86AFFAD912, 0x49EF0EB713F39EBE,
+				0x8A2DBF142DFCC7AB, 0x6E3569326C784337, 0xACB92ED9397BF996, 0x49C2C37F07965404,
+				0xD7E77A8F87DAF7FB, 0xDC33745EC97BE906, 0x86F0AC99B4E8DAFD, 0x69A028BB3DED71A3,
+				0xA8ACD7C0222311BC, 0xC40832EA0D68CE0C, 0xD2D80DB02AABD62B, 0xF50A3FA490C30190,
+				0x83C7088E1AAB65DB, 0x792667C6DA79E0FA, 0xA4B8CAB1A1563F52, 0x577001B891185938,
+				0xCDE6FD5E09ABCF26, 0xED4C0226B55E6F86, 0x80B05E5AC60B6178, 0x544F8158315B05B4,
+				0xA0DC75F1778E39D6, 0x696361AE3DB1C721, 0xC913936DD571C84C, 0x03BC3A19CD1E38E9,
+				0xFB5878494ACE3A5F, 0x04AB48A04065C723, 0x9D174B2DCEC0E47B, 0x62EB0D64283F9C76,
+				0xC45D1DF942711D9A, 0x3BA5D0BD324F8394, 0xF5746577930D6500, 0xCA8F44EC7EE36479,
+				0x9968BF6ABBE85F20, 0x7E998B13CF4E1ECB, 0xBFC2EF456AE276E8, 0x9E3FEDD8C321A67E,
+				0xEFB3AB16C59B14A2, 0xC5CFE94EF3EA101E, 0x95D04AEE3B80ECE5, 0xBBA1F1D158724A12,
+				0xBB445DA9CA61281F, 0x2A8A6E45AE8EDC97, 0xEA1575143CF97226, 0xF52D09D71A3293BD,
+				0x924D692CA61BE758, 0x593C2626705F9C56, 0xB6E0C377CFA2E12E, 0x6F8B2FB00C77836C,
+				0xE498F455C38B997A, 0x0B6DFB9C0F956447, 0x8EDF98B59A373FEC, 0x4724BD4189BD5EAC,
+				0xB2977EE300C50FE7, 0x58EDEC91EC2CB657, 0xDF3D5E9BC0F653E1, 0x2F2967B66737E3ED,
+				0x8B865B215899F46C, 0xBD79E0D20082EE74, 0xAE67F1E9AEC07187, 0xECD8590680A3AA11,
+				0xDA01EE641A708DE9, 0xE80E6F4820CC9495, 0x884134FE908658B2, 0x3109058D147FDCDD,
+				0xAA51823E34A7EEDE, 0xBD4B46F0599FD415, 0xD4E5E2CDC1D1EA96, 0x6C9E18AC7007C91A,
+				0x850FADC09923329E, 0x03E2CF6BC604DDB0, 0xA6539930BF6BFF45, 0x84DB8346B786151C,
+				0xCFE87F7CEF46FF16, 0xE612641865679A63, 0x81F14FAE158C5F6E, 0x4FCB7E8F3F60C07E,
+				0xA26DA3999AEF7749, 0xE3BE5E330F38F09D, 0xCB090C8001AB551C, 0x5CADF5BFD3072CC5,
+				0xFDCB4FA002162A63, 0x73D9732FC7C8F7F6, 0x9E9F11C4014DDA7E, 0x2867E7FDDCDD9AFA,
+				0xC646D63501A1511D, 0xB281E1FD541501B8, 0xF7D88BC24209A565, 0x1F225A7CA91A4226,
+				0x9AE757596946075F, 0x3375788DE9B06958, 0xC1A12D2FC3978937, 0x0052D6B1641C83AE,
+				0xF209787BB47D6B84, 0xC0678C5DBD23A49A, 0x9745EB4D50CE6332, 0xF840B7BA963646E0,
+				0xBD176620A501FBFF, 0xB650E5A93BC3D898, 0xEC5D3FA8CE427AFF, 0xA3E51F138AB4CEBE,
+				0x93BA47C980E98CDF, 0xC66F336C36B10137, 0xB8A8D9BBE123F017, 0xB80B0047445D4184,
+				0xE6D3102AD96CEC1D, 0xA60DC059157491E5, 0x9043EA1AC7E41392, 0x87C89837AD68DB2F,
+				0xB454E4A179DD1877, 0x29BABE4598C311FB, 0xE16A1DC9D8545E94, 0xF4296DD6FEF3D67A,
+				0x8CE2529E2734BB1D, 0x1899E4A65F58660C, 0xB01AE745B101E9E4, 0x5EC05DCFF72E7F8F,
+				0xDC21A1171D42645D, 0x76707543F4FA1F73, 0x899504AE72497EBA, 0x6A06494A791C53A8,
+				0xABFA45DA0EDBDE69, 0x0487DB9D17636892, 0xD6F8D7509292D603, 0x45A9D2845D3C42B6,
+				0x865B86925B9BC5C2, 0x0B8A2392BA45A9B2, 0xA7F26836F282B732, 0x8E6CAC7768D7141E,
+				0xD1EF0244AF2364FF, 0x3207D795430CD926, 0x8335616AED761F1F, 0x7F44E6BD49E807B8,
+				0xA402B9C5A8D3A6E7, 0x5F16206C9C6209A6, 0xCD036837130890A1, 0x36DBA887C37A8C0F,
+				0x802221226BE55A64, 0xC2494954DA2C9789, 0xA02AA96B06DEB0FD, 0xF2DB9BAA10B7BD6C,
+				0xC83553C5C8965D3D, 0x6F92829494E5ACC7, 0xFA42A8B73ABBF48C, 0xCB772339BA1F17F9,
+				0x9C69A97284B578D7, 0xFF2A760414536EFB, 0xC38413CF25E2D70D, 0xFEF5138519684ABA,
+				0xF46518C2EF5B8CD1, 0x7EB258665FC25D69, 0x98BF2F79D5993802, 0xEF2F773FFBD97A61,
+				0xBEEEFB584AFF8603, 0xAAFB550FFACFD8FA, 0xEEAABA2E5DBF6784, 0x95BA2A53F983CF38,
+				0x952AB45CFA97A0B2, 0xDD945A747BF26183, 0xBA756174393D88DF, 0x94F971119AEEF9E4,
+				0xE912B9D1478CEB17, 0x7A37CD5601AAB85D, 0x91ABB422CCB812EE, 0xAC62E055C10AB33A,
+				0xB616A12B7FE617AA, 0x577B986B314D6009, 0xE39C49765FDF9D94, 0xED5A7E85FDA0B80B,
+				0x8E41ADE9FBEBC27D, 0x14588F13BE847307, 0xB1D219647AE6B31C, 0x596EB2D8AE258FC8,
+				0xDE469FBD99A05FE3, 0x6FCA5F8ED9AEF3BB, 0x8AEC23D680043BEE, 0x25DE7BB9480D5854,
+				0xADA72CCC20054AE9, 0xAF561AA79A10AE6A, 0xD910F7FF28069DA4, 0x1B2BA1518094DA04,
+				0x87AA9AFF79042286, 0x90FB44D2F05D0842, 0xA99541BF57452B28, 0x353A1607AC744A53,
+				0xD3FA922F2D1675F2, 0x42889B8997915CE8, 0x847C9B5D7C2E09B7, 0x69956135FEBADA11,
+				0xA59BC234DB398C25, 0x43FAB9837E699095, 0xCF02B2C21207EF2E, 0x94F967E45E03F4BB,
+				0x8161AFB94B44F57D, 0x1D1BE0EEBAC278F5, 0xA1BA1BA79E1632DC, 0x6462D92A69731732,
+				0xCA28A291859BBF93, 0x7D7B8F7503CFDCFE, 0xFCB2CB35E702AF78, 0x5CDA735244C3D43E,
+				0x9DEFBF01B061ADAB, 0x3A0888136AFA64A7, 0xC56BAEC21C7A1916, 0x088AAA1845B8FDD0,
+				0xF6C69A72A3989F5B, 0x8AAD549E57273D45, 0x9A3C2087A63F6399, 0x36AC54E2F678864B,
+				0xC0CB28A98FCF3C7F, 0x84576A1BB416A7DD, 0xF0FDF2D3F3C30B9F, 0x656D44A2A11C51D5,
+				0x969EB7C47859E743, 0x9F644AE5A4B1B325, 0xBC4665B596706114, 0x873D5D9F0DDE1FEE,
+				0xEB57FF22FC0C7959, 0xA90CB506D155A7EA, 0x9316FF75DD87CBD8, 0x09A7F12442D588F2,
+				0xB7DCBF5354E9BECE, 0x0C11ED6D538AEB2F, 0xE5D3EF282A242E81, 0x8F1668C8A86DA5FA,
+				0x8FA475791A569D10, 0xF96E017D694487BC, 0xB38D92D760EC4455, 0x37C981DCC395A9AC,
+				0xE070F78D3927556A, 0x85BBE253F47B1417, 0x8C469AB843B89562, 0x93956D7478CCEC8E,
+				0xAF58416654A6BABB, 0x387AC8D1970027B2, 0xDB2E51BFE9D0696A, 0x06997B05FCC0319E,
+				0x88FCF317F22241E2, 0x441FECE3BDF81F03, 0xAB3C2FDDEEAAD25A, 0xD527E81CAD7626C3,
+				0xD60B3BD56A5586F1, 0x8A71E223D8D3B074, 0x85C7056562757456, 0xF6872D5667844E49,
+				0xA738C6BEBB12D16C, 0xB428F8AC016561DB, 0xD106F86E69D785C7, 0xE13336D701BEBA52,
+				0x82A45B450226B39C, 0xECC0024661173473, 0xA34D721642B06084, 0x27F002D7F95D0190,
+				0xCC20CE9BD35C78A5, 0x31EC038DF7B441F4, 0xFF290242C83396CE, 0x7E67047175A15271,
+				0x9F79A169BD203E41, 0x0F0062C6E984D386, 0xC75809C42C684DD1, 0x52C07B78A3E60868,
+				0xF92E0C3537826145, 0xA7709A56CCDF8A82, 0x9BBCC7A142B17CCB, 0x88A66076400BB691,
+				0xC2ABF989935DDBFE, 0x6ACFF893D00EA435, 0xF356F7EBF83552FE, 0x0583F6B8C4124D43,
+				0x98165AF37B2153DE, 0xC3727A337A8B704A, 0xBE1BF1B059E9A8D6, 0x744F18C0592E4C5C,
+				0xEDA2EE1C7064130C, 0x1162DEF06F79DF73, 0x9485D4D1C63E8BE7, 0x8ADDCB5645AC2BA8,
+				0xB9A74A0637CE2EE1, 0x6D953E2BD7173692, 0xE8111C87C5C1BA99, 0xC8FA8DB6CCDD0437,
+				0x910AB1D4DB9914A0, 0x1D9C9892400A22A2, 0xB54D5E4A127F59C8, 0x2503BEB6D00CAB4B,
+				0xE2A0B5DC971F303A, 0x2E44AE64840FD61D, 0x8DA471A9DE737E24, 0x5CEAECFED289E5D2,
+				0xB10D8E1456105DAD, 0x7425A83E872C5F47, 0xDD50F1996B947518, 0xD12F124E28F77719,
+				0x8A5296FFE33CC92F, 0x82BD6B70D99AAA6F, 0xACE73CBFDC0BFB7B, 0x636CC64D1001550B,
+				0xD8210BEFD30EFA5A, 0x3C47F7E05401AA4E, 0x8714A775E3E95C78, 0x65ACFAEC34810A71,
+				0xA8D9D1535CE3B396, 0x7F1839A741A14D0D, 0xD31045A8341CA07C, 0x1EDE48111209A050,
+				0x83EA2B892091E44D, 0x934AED0AAB460432, 0xA4E4B66B68B65D60, 0xF81DA84D5617853F,
+				0xCE1DE40642E3F4B9, 0x36251260AB9D668E, 0x80D2AE83E9CE78F3, 0xC1D72B7C6B426019,
+				0xA1075A24E4421730, 0xB24CF65B8612F81F, 0xC94930AE1D529CFC, 0xDEE033F26797B627,
+				0xFB9B7CD9A4A7443C, 0x169840EF017DA3B1, 0x9D412E0806E88AA5, 0x8E1F289560EE864E,
+				0xC491798A08A2AD4E, 0xF1A6F2BAB92A27E2, 0xF5B5D7EC8ACB58A2, 0xAE10AF696774B1DB,
+				0x9991A6F3D6BF1765, 0xACCA6DA1E0A8EF29, 0xBFF610B0CC6EDD3F, 0x17FD090A58D32AF3,
+				0xEFF394DCFF8A948E, 0xDDFC4B4CEF07F5B0, 0x95F83D0A1FB69CD9, 0x4ABDAF101564F98E,
+				0xBB764C4CA7A4440F, 0x9D6D1AD41ABE37F1, 0xEA53DF5FD18D5513, 0x84C86189216DC5ED,
+				0x92746B9BE2F8552C, 0x32FD3CF5B4E49BB4, 0xB7118682DBB66A77, 0x3FBC8C33221DC2A1,
+				0xE4D5E82392A40515, 0x0FABAF3FEAA5334A, 0x8F05B1163BA6832D, 0x29CB4D87F2A7400E,
+				0xB2C71D5BCA9023F8, 0x743E20E9EF511012, 0xDF78E4B2BD342CF6, 0x914DA9246B255416,
+				0x8BAB8EEFB6409C1A, 0x1AD089B6C2F7548E, 0xAE9672ABA3D0C320, 0xA184AC2473B529B1,
+				0xDA3C0F568CC4F3E8, 0xC9E5D72D90A2741E, 0x8865899617FB1871, 0x7E2FA67C7A658892,
+				0xAA7EEBFB9DF9DE8D, 0xDDBB901B98FEEAB7, 0xD51EA6FA85785631, 0x552A74227F3EA565,
+				0x8533285C936B35DE, 0xD53A88958F87275F, 0xA67FF273B8460356, 0x8A892ABAF368F137,
+				0xD01FEF10A657842C, 0x2D2B7569B0432D85, 0x8213F56A67F6B29B, 0x9C3B29620E29FC73,
+				0xA298F2C501F45F42, 0x8349F3BA91B47B8F, 0xCB3F2F7642717713, 0x241C70A936219A73,
+				0xFE0EFB53D30DD4D7, 0xED238CD383AA0110, 0x9EC95D1463E8A506, 0xF4363804324A40AA,
+				0xC67BB4597CE2CE48, 0xB143C6053EDCD0D5, 0xF81AA16FDC1B81DA, 0xDD94B7868E94050A,
+				0x9B10A4E5E9913128, 0xCA7CF2B4191C8326, 0xC1D4CE1F63F57D72, 0xFD1C2F611F63A3F0,
+				0xF24A01A73CF2DCCF, 0xBC633B39673C8CEC, 0x976E41088617CA01, 0xD5BE0503E085D813,
+				0xBD49D14AA79DBC82, 0x4B2D8644D8A74E18, 0xEC9C459D51852BA2, 0xDDF8E7D60ED1219E,
+				0x93E1AB8252F33B45, 0xCABB90E5C942B503, 0xB8DA1662E7B00A17, 0x3D6A751F3B936243,
+				0xE7109BFBA19C0C9D, 0x0CC512670A783AD4, 0x906A617D450187E2, 0x27FB2B80668B24C5,
+				0xB484F9DC9641E9DA, 0xB1F9F660802DEDF6, 0xE1A63853BBD26451, 0x5E7873F8A0396973,
+				0x8D07E33455637EB2, 0xDB0B487B6423E1E8, 0xB049DC016ABC5E5F, 0x91CE1A9A3D2CDA62,
+				0xDC5C5301C56B75F7, 0x7641A140CC7810FB, 0x89B9B3E11B6329BA, 0xA9E904C87FCB0A9D,
+				0xAC2820D9623BF429, 0x546345FA9FBDCD44, 0xD732290FBACAF133, 0xA97C177947AD4095,
+				0x867F59A9D4BED6C0, 0x49ED8EABCCCC485D, 0xA81F301449EE8C70, 0x5C68F256BFFF5A74,
+				0xD226FC195C6A2F8C, 0x73832EEC6FFF3111, 0x83585D8FD9C25DB7, 0xC831FD53C5FF7EAB,
+				0xA42E74F3D032F525, 0xBA3E7CA8B77F5E55, 0xCD3A1230C43FB26F, 0x28CE1BD2E55F35EB,
+				0x80444B5E7AA7CF85, 0x7980D163CF5B81B3, 0xA0555E361951C366, 0xD7E105BCC332621F,
+				0xC86AB5C39FA63440, 0x8DD9472BF3FEFAA7, 0xFA856334878FC150, 0xB14F98F6F0FEB951,
+				0x9C935E00D4B9D8D2, 0x6ED1BF9A569F33D3, 0xC3B8358109E84F07, 0x0A862F80EC4700C8,
+				0xF4A642E14C6262C8, 0xCD27BB612758C0FA, 0x98E7E9CCCFBD7DBD, 0x8038D51CB897789C,
+				0xBF21E44003ACDD2C, 0xE0470A63E6BD56C3, 0xEEEA5D5004981478, 0x1858CCFCE06CAC74,
+				0x95527A5202DF0CCB, 0x0F37801E0C43EBC8, 0xBAA718E68396CFFD, 0xD30560258F54E6BA,
+				0xE950DF20247C83FD, 0x47C6B82EF32A2069, 0x91D28B7416CDD27E, 0x4CDC331D57FA5441,
+				0xB6472E511C81471D, 0xE0133FE4ADF8E952, 0xE3D8F9E563A198E5, 0x58180FDDD97723A6,
+				0x8E679C2F5E44FF8F, 0x570F09EAA7EA7648,			};
+			return table;
+		}
+		
+		//* g = floor(10^e * 2^-r) + 1 in [2^125, 2^126) for e in [-292, 324], (high, low) pairs, as in the Schubfach paper
+		inline const uint64_t* schubfach_power_of_ten()
+		{
+			static constexpr uint64_t table[] = {
+				0x3FDDEC7F2FAF3713, 0xC97A3A2704EEC3DF, 0x27EAB3CF7DCD826C, 0x5DEC645863153A6C,
+				0x31E560C35D40E307, 0x75677D6E7BDA8906, 0x3E5EB8F434911BC9, 0x52C15CCA1AD12B48,
+				0x26FB3398A0DAB15D, 0xD3B8D9FE50C2BB0D, 0x30BA007EC9115DB5, 0x48A7107DE4F369D0,
+				0x3CE8809E7B55B522, 0x9AD0D49D5E304444, 0x261150630D159135, 0xA0C284E25ADE2AAB,
+				0x2F95A47BD05AF583, 0x08F3261AF195B555, 0x3B7B0D9AC471B2E3, 0xCB2FEFA1ADFB22AB,
+				0x252CE880BAC70FCE, 0x5EFDF5C50CBCF5AB, 0x2E7822A0E978D3C1, 0xF6BD73364FEC3315,
+				0x3A162B4923D708B2, 0x746CD003E3E73FDB, 0x244DDB0DB666656F, 0x88C402026E7087E9,
+				0x2D6151D123FFFECB, 0x6AF502830A0CA9E3, 0x38B9A6456CFFFE7E, 0x45B24323CC8FD45C,
+				0x237407EB641FFF0E, 0xEB8F69F65FD9E4B9, 0x2C5109E63D27FED2, 0xA6734473F7D05DE8,
+				0x37654C5FCC71FE87, 0x50101590F5C47561, 0x229F4FBBDFC73F14, 0x920A0D7A999AC95D,
+				0x2B4723AAD7B90ED9, 0xB68C90D940017BB4, 0x3618EC958DA75290, 0x242FB50F9001DAA1,
+				0x21CF93DD7888939A, 0x169DD129BA0128A5, 0x2A4378D4D6AAB880, 0x9C454574288172CE,
+				0x34D4570A0C5566A0, 0xC35696D132A1CF81, 0x2104B66647B56024, 0x7A161E42BFA521B1,
+				0x2945E3FFD9A2B82D, 0x989BA5D36F8E6A1D, 0x33975CFFD00B6638, 0xFEC28F484B7204A4,
+				0x203E9A1FE2071FE3, 0x9F39998D2F2742E7, 0x284E40A7DA88E7DC, 0x8707FFF07AF113A1,
+				0x3261D0D1D12B21D3, 0xA8C9FFEC99AD5889, 0x3EFA45064575EA48, 0x92FC7FE7C018AEAB,
+				0x275C6B23EB69B26D, 0x5BDDCFF0D80F6D2B, 0x313385ECE6441F08, 0xB2D543ED0E134875,
+				0x3D8067681FD526CA, 0xDF8A94E851981A93, 0x267040A113E5383E, 0xCBB69D1132FF109C,
+				0x300C50C958DE864E, 0x7EA444557FBED4C3, 0x3C0F64FBAF1627E2, 0x1E4D556ADFAE89F3,
+				0x25899F1D4D6DD8ED, 0x52F05562CBCD1638, 0x2EEC06E4A0C94F28, 0xA7AC6ABB7EC05BC6,
+				0x3AA7089DC8FBA2F2, 0xD197856A5E7072B8, 0x24A865629D9D45D7, 0xC2FEB3627B0647B3,
+				0x2DD27EBB4504974D, 0xB3BE603B19C7D99F, 0x39471E6A1645BD21, 0x20ADF849E039D007,
+				0x23CC73024DEB9634, 0xB46CBB2E2C242205, 0x2CBF8FC2E1667BC1, 0xE187E9F9B72D2A86,
+				0x37EF73B399C01AB2, 0x59E9E47824F87527, 0x22F5A850401810AF, 0x78322ECB171B4939,
+				0x2BB31264501E14DB, 0x563EBA7DDCE21B87, 0x369FD6FD64259A12, 0x2BCE691D541AA268,
+				0x2223E65E5E97804B, 0x5B6101B25490A581, 0x2AACDFF5F63D605E, 0x3239421EE9B4CEE1,
+				0x355817F373CCB875, 0xBEC792A6A422029A, 0x21570EF8285FF349, 0x973CBBA8269541A0,
+				0x29ACD2B63277F01B, 0xFD0BEA92303A9208, 0x34180763BF15EC22, 0xFC4EE536BC49368A,
+				0x208F049E576DB395, 0xDDB14F4235ADC217, 0x28B2C5C5ED49207B, 0x551DA312C319329C,
+				0x32DF7737689B689A, 0x2A650BD773DF7F43, 0x3F97550542C242C0, 0xB4FE4ECD50D75F14,
+				0x27BE952349B969B8, 0x711EF14052869B6C, 0x31AE3A6C1C27C426, 0x8D66AD9067284247,
+				0x3E19C9072331B530, 0x30C058F480F252D9, 0x26D01DA475FF113E, 0x1E783798D09773C8,
+				0x3084250D937ED58D, 0xA616457F04BD50BA, 0x3CA52E50F85E8AF1, 0x0F9BD6DEC5ECA4E8,
+				0x25E73CF29B3B16D6, 0xA9C1664B3BB3E711, 0x2F610C2F4209DC8C, 0x5431BFDE0AA0E0D5,
+				0x3B394F3B128C53AF, 0x693E2FD58D49190B, 0x2503D184EB97B44D, 0xA1C6DDE5784DAFA7,
+				0x2E44C5E6267DA161, 0x0A38955ED6611B90, 0x39D5F75FB01D09B9, 0x4CC6BAB68BF96274,
+				0x2425BA9BCE122613, 0xCFFC34B2177BDD89, 0x2D2F2942C196AF98, 0xC3FB41DE9D5AD4EB,
+				0x387AF39371FC5B7E, 0xF4FA125644B18A26, 0x234CD83C273DB92F, 0x591C4B75EAEEF658,
+				0x2C200E4B310D277B, 0x2F635E5365AAB3ED, 0x372811DDFD507159, 0xFB3C35E83F1560E9,
+				0x22790B2ABE5246D8, 0x3D05A1B1276D5C92, 0x2B174DF56DE6D88E, 0x4C470A1D7148B3B6,
+				0x35DD2172C9608EB1, 0xDF58CCA4CD9AE0A3, 0x21AA34E7BDDC592F, 0x2B977FE70080CC66,
+				0x2A14C221AD536F7A, 0xF67D5FE0C0A0FF80, 0x3499F2AA18A84B59, 0xB41CB7D8F0C93F5F,
+				0x20E037AA4F692F18, 0x1091F2E7967DC79C, 0x29184594E3437ADE, 0x14B66FA17C1D3983,
+				0x335E56FA1C145995, 0x99E40B89DB2487E3, 0x201AF65C518CB7FD, 0x802E873628F6D4EE,
+				0x2821B3F365EFE5FC, 0xE03A2903B3348A2A, 0x322A20F03F6BDF7C, 0x1848B344A001ACB4,
+				0x3EB4A92C4F46D75B, 0x1E5AE015C80217E1, 0x2730E9BBB18C4698, 0xF2F8CC0D9D014EED,
+				0x30FD242A9DEF583F, 0x2FB6FF110441A2A8, 0x3D3C6D35456B2E4E, 0xFBA4BED545520B52,
+				0x2645C4414B62FCF1, 0x5D46F7454B534713, 0x2FD735519E3BBC2D, 0xB498B5169E2818D8,
+				0x3BCD02A605CAAB39, 0x21BEE25C45B21F0E, 0x256021A7C39EAB03, 0xB5174D79AB8F5369,
+				0x2EB82A11B48655C4, 0xA25D20D816732843, 0x3A66349621A7EB35, 0xCAF4690E1C0FF253,
+				0x247FE0DDD508F301, 0x9ED8C1A8D189F774, 0x2D9FD9154A4B2FC2, 0x068EF21305EC7551,
+				0x3907CF5A9CDDFBB2, 0x8832AE97C76792A5, 0x23A4E198A20ABD4F, 0x951FAD1EDCA0BBA8,
+				0x2C8E19FECA8D6CA3, 0x7A67986693C8EA91, 0x37B1A07E7D30C7CC, 0x59017E8038BB2536,
+				0x22CF044F0E3E7CDF, 0xB7A0EF102374F742, 0x2B82C562D1CE1C17, 0xA5892AD42C523512,
+				0x366376BB8641A31D, 0x8EEB75893766C256, 0x21FE2A3533E905F2, 0x79532975C2A03976,
+				0x2A7DB4C280E3476F, 0x17A7F3D3334847D4, 0x351D21F3211C194A, 0xDD91F0C8001A59C8,
+				0x21323537F4B18FCE, 0xCA7B367D0010781D, 0x297EC285F1DDF3C2, 0x7D1A041C40149625,
+				0x33DE73276E5570B3, 0x1C6085235019BBAE, 0x206B07F8A4F5666F, 0xF1BC53361210154D,
+				0x2885C9F6CE32C00B, 0xEE2B680396941AA0, 0x32A73C7481BF700E, 0xE9B642047C392148,
+				0x3F510B91A22F4C12, 0xA423D2859B476999, 0x2792A73B055D8F8B, 0xA6966393810CA200,
+				0x31775109C6B4F36E, 0x903BFC78614FCA80, 0x3DD5254C3862304A, 0x344AFB9679A3BD20,
+				0x26A5374FA33D5E2E, 0x60AEDD3E0C065634, 0x304E85238C0CB5B9, 0xF8DA948D8F07EBC1,
+				0x3C62266C6F0FE328, 0x771139B0F2C9E6B1, 0x25BD5803C569EDF9, 0x4A6AC40E97BE302F,
+				0x2F2CAE04B6C46977, 0x9D0575123DADBC3A, 0x3AF7D985E47583D5, 0x8446D256CD192B49,
+				0x24DAE7F3AEC97265, 0x72AC4376402FBB0E, 0x2E11A1F09A7BCEFE, 0xCF575453D03BA9D1,
+				0x39960A6CC11AC2BE, 0x832D2968C44A9445, 0x23FDC683F8B0B9B7, 0x11FC39E17AAE9CAB,
+				0x2CFD3824F6DCE824, 0xD67B4859D95A43D6, 0x383C862E3494222E, 0x0C1A1A704FB0D4CC,
+				0x2325D3DCE0DC955C, 0xC790508631CE84FF, 0x2BEF48D41913BAB3, 0xF97464A7BE42263F,
+				0x36EB1B091F58A960, 0xF7D17DD1ADD2AFCF, 0x2252F0E5B39769DC, 0x9AE2EEA30CA3ADE1,
+				0x2AE7AD1F207D4453, 0xC19BAA4BCFCC995A, 0x35A19866E89C9568, 0xB20294DEC3BFBFB0,
+				0x2184FF405161DD61, 0x6F419D0B3A57D7CE, 0x29E63F1065BA54B9, 0xCB12044E08EDCDC2,
+				0x345FCED47F28E9E8, 0x3DD685618B294132, 0x20BBE144CF799231, 0x26A6135CF6F9C8BF,
+				0x28EAD9960357F6BD, 0x704F983434B83AEF, 0x33258FFB842DF46C, 0xCC637E4141E649AB,
+				0x3FEEF3FA65397187, 0xFF7C5DD1925FDC15, 0x27F5587C7F43E6F4, 0xFFADBAA2FB7BE98D,
+				0x31F2AE9B9F14E0B2, 0x3F99294BBA5AE3F1, 0x3E6F5A4286DA18DE, 0xCF7F739EA8F19CED,
+				0x2705986994484F8B, 0x41AFA84329970214, 0x30C6FE83F95A636E, 0x121B9253F3FCC299,
+				0x3CF8BE24F7B0FC49, 0x96A276E8F0FBF33F, 0x261B76D71ACE9DAD, 0xFE258A51969D7808,
+				0x2FA2548CE1824519, 0x7DAEECE5FC44D609, 0x3B8AE9B019E2D65F, 0xDD1AA81F7B560B8C,
+				0x2536D20E102DC5FB, 0xEA30A913AD15C738, 0x2E8486919439377A, 0xE4BCD358985B3905,
+				0x3A25A835F9478559, 0x9DEC082EBE720746, 0x24578921BBCCB358, 0x02B3851D3707448C,
+				0x2D6D6B6A2ABFE02E, 0x0360666484C915AF, 0x38C8C644B56FD839, 0x84387FFDA5FB5B1B,
+				0x237D7BEAF165E723, 0xF2A34FFE87BD18F1, 0x2C5CDAE5ADBF60EC, 0xEF4C23FE29AC5F2D,
+				0x3774119F192F3928, 0x2B1F2CFDB41776F8, 0x22A88B036FBD83B9, 0x1AF37C1E908EAA5B,
+				0x2B52ADC44BACE4A7, 0x61B05B2634B254F2, 0x362759355E981DD1, 0x3A1C71EFC1DEEA2E,
+				0x21D897C15B1F12A2, 0xC451C735D92B525D, 0x2A4EBDB1B1E6D74B, 0x756639034F7626F4,
+				0x34E26D1E1E608D1E, 0x52BFC7442353B0B1, 0x210D8432D2FC5832, 0xF3B7DC8A96144E6F,
+				0x2950E53F87BB6E3F, 0xB0A5D3AD3B99620B, 0x33A51E8F69AA49CF, 0x9CCF48988A7FBA8D,
+				0x20473319A20A6E21, 0xC2018D5F568FD498, 0x2858FFE00A8D09AA, 0x3281F0B72C33C9BE,
+				0x326F3FD80D304C14, 0xBF226CE4F740BC2E, 0x3F0B0FCE107C5F19, 0xEEEB081E3510EB39,
+				0x2766E9E0CA4DBB70, 0x3552E512E12A9304, 0x3140A458FCE12A4C, 0x42A79E57997537C5,
+				0x3D90CD6F3C1974DF, 0x535185ED7FD285B6, 0x267A8065858FE90B, 0x9412F3B46FE39392,
+				0x3019207EE6F3E34E, 0x7917B0A18BDC7876, 0x3C1F689EA0B0DC22, 0x175D9CC9EED39694,
+				0x2593A163246E8995, 0x4E9A81FE35443E1C, 0x2EF889BBED8A2BFA, 0xA241227DC2954DA3,
+				0x3AB6AC2AE8ECB6F9, 0x4AD16B1D333AA10C, 0x24B22B9AD193F25B, 0xCEC2E2F24004A4A8,
+				0x2DDEB68185F8EEF2, 0xC2739BAED005CDD2, 0x39566421E7772AAF, 0x7310829A84074146,
+				0x23D5FE9530AA7AAD, 0xA7EA51A0928488CC, 0x2CCB7E3A7CD51959, 0x11E4E608B725AAFF,
+				0x37FE5DC91C0A5FAF, 0x565E1F8AE4EF15BE, 0x22FEFA9DB1867BCD, 0x95FAD3B6CF156D97,
+				0x2BBEB9451DE81AC0, 0xFB7988A482DAC8FD, 0x36AE679665622171, 0x3A57EACDA3917B3C,
+				0x222D00BDFF5D54E6, 0xC476F2C0863AED06, 0x2AB840ED7F34AA20, 0x7594AF70A7C9A847,
+				0x35665128DF01D4A8, 0x92F9DB4CD1BC1258, 0x215FF2B98B6124E9, 0x5BDC291003158B77,
+				0x29B7EF67EE396E23, 0xB2D3335403DAEE55, 0x3425EB41E9C7C9AC, 0x9F88002904D1A9EA,
+				0x2097B309321CDE0B, 0xE3B50019A3030A33, 0x28BD9FCB7EA4158E, 0xDCA240200BC3CCBF,
+				0x32ED07BE5E4D1AF2, 0x93CAD0280EB4BFEF, 0x3FA849ADF5E061AF, 0x38BD84321261EFEB,
+				0x27C92E0CB9AC3D0D, 0x8376729F4B7D35F3, 0x31BB798FE8174C50, 0xE4540F471E5C836F,
+				0x3E2A57F3E21D1F65, 0x1D691318E5F3A44B, 0x26DA76F86D52339F, 0x3261ABEF8FB846AF,
+				0x309114B688A6C086, 0xFEFA16EB73A6585B, 0x3CB559E42AD070A8, 0xBEB89CA6508FEE71,
+				0x25F1582E9AC24669, 0x773361E7F259F507, 0x2F6DAE3A4172D803, 0xD5003A61EEF07249,
+				0x3B4919C8D1CF8E04, 0xCA4048FA6AAC8EDB, 0x250DB01D8321B8C2, 0xFE682D9C82ABD949,
+				0x2E511C24E3EA26F3, 0xBE023903A356CF9B, 0x39E5632E1CE4B0B0, 0xAD82C7448C2C8382,
+				0x242F5DFCD20EEE6E, 0x6C71BC8AD79BD231, 0x2D3B357C0692AA0A, 0x078E2BAD8D82C6BD,
+				0x388A02DB0837548C, 0x8971B698F0E3786D, 0x235641C8E52294D7, 0xD5E7121F968E2B44,
+				0x2C2BD23B1E6B3A0D, 0xCB60D6A77C31B615, 0x3736C6C9E6060891, 0x3E390C515B3E239A,
+				0x22823C3E2FC3C55A, 0xC6E3A7B2D906D640, 0x2B22CB4DBBB4B6B1, 0x789C919F8F488BD0,
+				0x35EB7E212AA1E45D, 0xD6C3B607731AAEC4, 0x21B32ED4BAA52EBA, 0xA63A51C4A7F0AD3B,
+				0x2A1FFA89E94E7A69, 0x4FC8E635D1ECD88A, 0x34A7F92C63A21903, 0xA3BB1FC346680EAC,
+				0x20E8FBBBBE454FA2, 0x4654F3DA0C01092C, 0x29233AAAADD6A38A, 0xD7EA30D08F014B76,
+				0x336C0955594C4C6D, 0x8DE4BD04B2C19E54, 0x202385D557CFAFC4, 0x78AEF622EFB902F5,
+				0x282C674AADC39BB5, 0x96DAB3ABABA743B2, 0x3237811D593482A2, 0xFC9160969691149E,
+				0x3EC56164AF81A34B, 0xBBB5B8BC3C3559C5, 0x273B5CDEEDB1060F, 0x55519375A5A1581B,
+				0x310A3416A91D4793, 0x2AA5F8530F09AE22, 0x3D4CC11C53649977, 0xF54F7667D2CC19AB,
+				0x264FF8B1B41EDFEA, 0xF951AA00E3BF900B, 0x2FE3F6DE212697E5, 0xB7A614811CAF740D,
+				0x3BDCF495A9703DDF, 0x258F99A163DB5111, 0x256A18DD89E626AB, 0x7779C004DE6912AB,
+				0x2EC49F14EC5FB056, 0x5558300616035755, 0x3A75C6DA27779C6B, 0xEAAE3C079B842D2A,
+				0x24899C4858AAC1C3, 0x72ACE584C1329C3B, 0x2DAC035A6ED57234, 0x4F581EE5F17F4349,
+				0x391704310A8ACEC1, 0x632E269F6DDF141B, 0x23AE629EA696C138, 0xDDFCD823A4AB6C91,
+				0x2C99FB46503C7187, 0x157C0E2C8DD647B5, 0x37C07A17E44B8DE8, 0xDADB11B7B14BD9A3,
+				0x22D84C4EEEAF38B1, 0x88C8EB12CECF6806, 0x2B8E5F62AA5B06DD, 0xEAFB25D782834207,
+				0x3671F73B54F1C895, 0x65B9EF4D63241289, 0x22073A8515171D5D, 0x5F9435905DF68B96,
+				0x2A8909265A5CE4B4, 0xB77942F475742E7B, 0x352B4B6FF0F41DE1, 0xE55793B192D13A1A,
+				0x213B0F25F69892AD, 0x2F56BC4EFBC2C450, 0x2989D2EF743EB758, 0x7B2C6B62BAB37564,
+				0x33EC47AB514E652E, 0x99F7863B696052BD, 0x2073ACCB12D0FF3D, 0x203AB3E521DC33B6,
+				0x289097FDD7853F0C, 0x684960DE6A5340A4, 0x32B4BDFD4D668ECF, 0x825BB91604E810CD,
+				0x3F61ED7CA0C03283, 0x62F2A75B86221500, 0x279D346DE4781F92, 0x1DD7A89933D54D20,
+				0x318481895D962776, 0xA54D92BF80CAA068, 0x3DE5A1EBB4FBB154, 0x4EA0F76F60FD4882,
+				0x26AF8533511D4ED4, 0xB1249AA59C9E4D51, 0x305B66802564A289, 0xDD6DC14F03C5E0A5,
+				0x3C7240202EBDCB2C, 0x54C931A2C4B758CF, 0x25C768141D369EFB, 0xB4FDBF05BAF29781,
+				0x2F394219248446BA, 0xA23D2EC729AF3D62, 0x3B07929F6DA55869, 0x4ACC7A78F41B0CBA,
+				0x24E4BBA3A4875741, 0xCEBFCC8B9890E7F4, 0x2E1DEA8C8DA92D12, 0x426FBFAE7EB521F1,
+				0x39A5652FB1137856, 0xD30BAF9A1E626A6D, 0x24075F3DCEAC2B36, 0x43E74DC052FD8285,
+				0x2D09370D42573603, 0xD4E1213067BCE326, 0x384B84D092ED0384, 0xCA19697C81AC1BEF,
+				0x232F33025BD42232, 0xFE4FE1EDD10B9175, 0x2BFAFFC2F2C92ABF, 0xBDE3DA69454E75D3,
+				0x36F9BFB3AF7B756F, 0xAD5CD10396A21347, 0x225C17D04DAD2965, 0xCC5A02A23E254C0D,
+				0x2AF31DC4611873BF, 0x3F70834ACDAE9F10, 0x35AFE535795E90AF, 0x0F4CA41D811A46D4,
+				0x218DEF416BDB1A6D, 0x698FE69270B06C44, 0x29F16B11C6D1E108, 0xC3F3E0370CDC8755,
+				0x346DC5D63886594A, 0xF4F0D844D013A92B, 0x20C49BA5E353F7CE, 0xD916872B020C49BB,
+				0x28F5C28F5C28F5C2, 0x8F5C28F5C28F5C29, 0x3333333333333333, 0x3333333333333334,
+				0x2000000000000000, 0x0000000000000001, 0x2800000000000000, 0x0000000000000001,
+				0x3200000000000000, 0x0000000000000001, 0x3E80000000000000, 0x0000000000000001,
+				0x2710000000000000, 0x0000000000000001, 0x30D4000000000000, 0x0000000000000001,
+				0x3D09000000000000, 0x0000000000000001, 0x2625A00000000000, 0x0000000000000001,
+				0x2FAF080000000000, 0x0000000000000001, 0x3B9ACA0000000000, 0x0000000000000001,
+				0x2540BE4000000000, 0x0000000000000001, 0x2E90EDD000000000, 0x0000000000000001,
+				0x3A35294400000000, 0x0000000000000001, 0x246139CA80000000, 0x0000000000000001,
+				0x2D79883D20000000, 0x0000000000000001, 0x38D7EA4C68000000, 0x0000000000000001,
+				0x2386F26FC1000000, 0x0000000000000001, 0x2C68AF0BB1400000, 0x0000000000000001,
+				0x3782DACE9D900000, 0x0000000000000001, 0x22B1C8C1227A0000, 0x0000000000000001,
+				0x2B5E3AF16B188000, 0x0000000000000001, 0x3635C9ADC5DEA000, 0x0000000000000001,
+				0x21E19E0C9BAB2400, 0x0000000000000001, 0x2A5A058FC295ED00, 0x0000000000000001,
+				0x34F086F3B33B6840, 0x0000000000000001, 0x2116545850052128, 0x0000000000000001,
+				0x295BE96E64066972, 0x0000000000000001, 0x33B2E3C9FD0803CE, 0x8000000000000001,
+				0x204FCE5E3E250261, 0x1000000000000001, 0x2863C1F5CDAE42F9, 0x5400000000000001,
+				0x327CB2734119D3B7, 0xA900000000000001, 0x3F1BDF10116048A5, 0x9340000000000001,
+				0x27716B6A0ADC2D67, 0x7C08000000000001, 0x314DC6448D9338C1, 0x5B0A000000000001,
+				0x3DA137D5B0F806F1, 0xB1CC800000000001, 0x2684C2E58E9B0457, 0x0F1FD00000000001,
+				0x3025F39EF241C56C, 0xD2E7C40000000001, 0x3C2F7086AED236C8, 0x07A1B50000000001,
+				0x259DA6542D43623D, 0x04C5112000000001, 0x2F050FE938943ACC, 0x45F6556800000001,
+				0x3AC653E386B9497F, 0x5773EAC200000001, 0x24BBF46E3433CDEF, 0x96A872B940000001,
+				0x2DEAF189C140C16B, 0x7C528F6790000001, 0x3965ADEC3190F1C6, 0x5B67334174000001,
+				0x23DF8CB39EFA971B, 0xF9208008E8800001, 0x2CD76FE086B93CE2, 0xF768A00B22A00001,
+				0x380D4BD8A8678C1B, 0xB542C80DEB480001, 0x23084F676940B791, 0x5149BD08B30D0001,
+				0x2BCA63414390E575, 0xA59C2C4ADFD04001, 0x36BCFC1194751ED3, 0x0F03375D97C45001,
+				0x22361D8AFCC93343, 0xE962029A7EDAB201, 0x2AC3A4EDBBFB8014, 0xE3BA83411E915E81,
+				0x35748E292AFA601A, 0x1CA924116635B621, 0x2168D8D9BADC7C10, 0x51E9B68ADFE191D5,
+				0x29C30F1029939B14, 0x6664242D97D9F64A, 0x3433D2D433F881D9, 0x7FFD2D38FDD073DC,
+				0x20A063C4A07B5127, 0xEFFE3C439EA2486A, 0x28C87CB5C89A2571, 0xEBFDCB54864ADA84,
+				0x32FA9BE33AC0AECE, 0x66FD3E29A7DD9125, 0x3FB942DC0970DA82, 0x00BC8DB411D4F56E,
+				0x27D3C9C985E68891, 0x4075D8908B251965, 0x31C8BC3BE7602AB5, 0x90934EB4ADEE5FBE,
+				0x3E3AEB4AE1383562, 0xF4B82261D969F7AD, 0x26E4D30ECCC3215D, 0xD8F3157D27E23ACC,
+				0x309E07D27FF3E9B5, 0x4F2FDADC71DAC97F, 0x3CC589C71FF0E422, 0xA2FBD1938E517BDF,
+				0x25FB761C73F68E95, 0xA5DD62FC38F2ED6C, 0x2F7A53A390F4323B, 0x0F54BBBB472FA8C6,
+				0x3B58E88C75313EC9, 0xD329EAAA18FB92F8, 0x25179157C93EC73E, 0x23FA32AA4F9D3BDB,
+				0x2E5D75ADBB8E790D, 0xACF8BF54E3848AD2, 0x39F4D3192A721751, 0x1836EF2A1C65AD86,
+				0x243903EFBA874E92, 0xAF22557A51BF8C74, 0x2D4744EBA9292237, 0x5AEAEAD8E62F6F91,
+				0x3899162693736AC5, 0x31A5A58F1FBB4B75, 0x235FADD81C2822BB, 0x3F07877973D50F29,
+				0x2C37994E23322B6A, 0x0EC96957D0CA52F3, 0x37457FA1ABFEB644, 0x927BC3ADC4FCE7B0,
+				0x228B6FC50B7F31EA, 0xDB8D5A4C9B1E10CE, 0x2B2E4BB64E5EFE65, 0x9270B0DFC1E59502,
+				0x35F9DEA3E1F6BDFE, 0xF70CDD17B25EFA42, 0x21BC2B266D3A36BF, 0x5A680A2ECF7B5C69,
+				0x2A2B35F00888C46F, 0x31020CBA835A3384, 0x34B6036C0AAAF58A, 0xFD428FE92430C065,
+				0x20F1C22386AAD976, 0xDE4999F1B69E783F, 0x292E32AC68558FD4, 0x95DC006E2446164F,
+				0x3379BF57826AF3C9, 0xBB530089AD579BE2, 0x202C1796B182D85E, 0x1513E0560C56C16E,
+				0x28371D7C5DE38E75, 0x9A58D86B8F6C71C9, 0x3244E4DB755C7213, 0x00EF0E8673478E3B,
+				0x3ED61E1252B38E97, 0xC12AD228101971C9, 0x2745D2CB73B0391E, 0xD8BAC3590A0FE71E,
+				0x3117477E509C4766, 0x8EE9742F4C93E0E6, 0x3D5D195DE4C35940, 0x32A3D13B1FB8D91F,
+				0x265A2FDAAEFA17C8, 0x1FA662C4F3D387B3, 0x2FF0BBD15AB89DBA, 0x278FFB7630C869A0,
+				0x3BECEAC5B166C528, 0xB173FA53BCFA8408, 0x257412BB8EE03B39, 0x6EE87C74561C9285,
+				0x2ED1176A72984A07, 0xCAA29B916BA3B726, 0x3A855D450F3E5C89, 0xBD4B4275C68CA4F0,
+				0x24935A4B2986F9D6, 0x164F09899C17E716, 0x2DB830DDF3E8B84B, 0x9BE2CBEC031DE0DC,
+				0x39263D1570E2E65E, 0x82DB7EE703E55912, 0x23B7E62D668DCFFB, 0x11C92F50626F57AC,
+				0x2CA5DFB8C03143F9, 0xD63B7B247B0B2D96, 0x37CF57A6F03D94F8, 0x4BCA59ED99CDF8FC,
+				0x22E196C856267D1B, 0x2F5E78348020BB9E, 0x2B99FC7A6BB01C61, 0xFB361641A028EA85,
+				0x36807B99069C237A, 0x7A039BD208332526, 0x22104D3FA421962C, 0x8C424163451FF738,
+				0x2A94608F8D29FBB7, 0xAF52D1BC1667F506, 0x353978B370747AA5, 0x9B27862B1C01F247,
+				0x2143EB702648CCA7, 0x80F8B3DAF181376D, 0x2994E64C2FDAFFD1, 0x6136E0D1ADE18548,
+				0x33FA1FDF3BD1BFC5, 0xB98499061959E699, 0x207C53EB856317DB, 0x93F2DFA3CFD83020,
+				0x289B68E666BBDDD2, 0x78EF978CC3CE3C28, 0x32C24320006AD547, 0x172B7D6FF4C1CB32,
+				0x3F72D3E800858A98, 0xDCF65CCBF1F23DFE, 0x27A7C4710053769F, 0x8A19F9FF773766BF,
+				0x3191B58D40685447, 0x6CA0787F5505406F, 0x3DF622F090826959, 0x47C8969F2A46908A,
+				0x26B9D5D65A5181D7, 0xCCDD5E237A6C1A57, 0x30684B4BF0E5E24D, 0xC014B5AC590720EC,
+				0x3C825E1EED1F5AE1, 0x3019E3176F48E927, 0x25D17AD3543398CC, 0xBE102DEEA58D91B9,
+				0x2F45D98829407EFF, 0xED94396A4EF0F627, 0x3B174FEA33909EBF, 0xE8F947C4E2AD33B0,
+				0x24EE91F2603A6337, 0xF19BCCDB0DAC404E, 0x2E2A366EF848FC05, 0xEE02C011D1175062,
+				0x39B4C40AB65B3B07, 0x69837016455D247A, 0x2410FA86B1F904E4, 0xA1F2260DEB5A36CC,
+				0x2D1539285E77461D, 0xCA6EAF916630C47F, 0x385A8772761517A5, 0x3D0A5B75BFBCF59F,
+				0x233894A789CD2EC7, 0x4626792997D61984, 0x2C06B9D16C407A79, 0x17B01773FDCB9FE4,
+				0x37086845C7509917, 0x5D9C1D50FD3E87DD, 0x2265412B9C925FAE, 0x9A8192529E4714EB,
+				0x2AFE917683B6F79A, 0x4121F6E745D8DA25, 0x35BE35D424A4B580, 0xD16A74A1174F10AE,
+				0x2196E1A496E6F170, 0x82E288E4AE916A6D, 0x29FC9A0DBCA0ADCC, 0xA39B2B1DDA35C508,
+				0x347BC0912BC8D93F, 0xCC81F5E550C3364A, 0x20CD585ABB5D87C7, 0xDFD139AF527A01EF,
+				0x2900AE716A34E9B9, 0xD7C5881B2718826A, 0x3340DA0DC4C22428, 0x4DB6EA21F0DEA304,
+				0x200888489AF95699, 0x30925255368B25E3, 0x280AAA5AC1B7AC3F, 0x7CB6E6EA842DEF5C,
+				0x320D54F17225974F, 0x5BE4A0A525396B32, 0x3E90AA2DCEAEFD23, 0x32DDC8CE6E87C5FF,
+				0x271A6A5CA12D5E35, 0xFFCA9D810514DBBF, 0x30E104F3C978B5C3, 0x7FBD44E1465A12AF,
+				0x3D194630BBD6E334, 0x5FAC961997F0975B, 0x262FCBDE75664E00, 0xBBCBDDCFFEF65E99,
+				0x2FBBBED612BFE180, 0xEABED543FEB3F63F, 0x3BAAAE8B976FD9E1, 0x256E8A94FE60F3CF,
+				0x254AAD173EA5E82C, 0xB765169D1EFC9861, 0x2E9D585D0E4F6237, 0xE53E5C4466BBBE7A,
+				0x3A44AE7451E33AC5, 0xDE8DF355806AAE18, 0x246AED08B32E04BB, 0xAB18B8157042ACCF,
+				0x2D85A84ADFF985EA, 0x95DEE61ACC535803, 0x38E7125D97F7E765, 0x3B569FA17F682E03,
+				0x23906B7A7EFAF09F, 0x451623C4EFA11CC2, 0x2C7486591EB9ACC7, 0x165BACB62B8963F3,
+				0x3791A7EF666817F8, 0xDBF297E3B66BBCEF, 0x22BB08F5A0010EFB, 0x89779EEE52035616,
+				0x2B69CB33080152BA, 0x6BD586A9E6842B9B, 0x36443DFFCA01A769, 0x06CAE85460253682,
+				0x21EAA6BFDE4108A1, 0xA43ED134BC174211, 0x2A65506FD5D14ACA, 0x0D4E8581EB1D1295,
+				0x34FEA48BCB459D7C, 0x90A226E265E4573B, 0x211F26D75F0B826D, 0xDA65584D7FAEB685,
+				0x2966F08D36CE6309, 0x50FEAE60DF9A6426, 0x33C0ACB08481FBCB, 0xA53E59F91780FD2F,
+				0x20586BEE52D13D5F, 0x4746F83BAEB09E3E, 0x286E86E9E7858CB7, 0x1918B64A9A5CC5CD,
+				0x328A28A46166EFE4, 0xDF5EE3DD40F3F740, 0x3F2CB2CD79C0ABDE, 0x17369CD49130F510,
+				0x277BEFC06C186B6A, 0xCE822204DABE992A, 0x315AEBB0871E8645, 0x8222AA86116E3F75,
+				0x3DB1A69CA8E627D6, 0xE2AB552795C9CF52, 0x268F0821E98FD8E6, 0x4DAB1538BD9E2193,
+				0x3032CA2A63F3CF1F, 0xE115DA86ED05A9F8, 0x3C3F7CB4FCF0C2E7, 0xD95B5128A8471476,
+				0x25A7ADF11E1679D0, 0xE7D912B9692C6CCA, 0x2F11996D659C1845, 0x21CF5767C37787FC,
+				0x3AD5FFC8BF031E56, 0x6A432D41B45569FB, 0x24C5BFDD7761F2F6, 0x0269FC4910B5623D,
+				0x2DF72FD4D53A6FB3, 0x83047B5B54E2BACC, 0x3974FBCA0A890BA0, 0x63C59A322A1B697F,
+				0x23E91D5E4695A744, 0x3E5B805F5A5121F0, 0x2CE364B5D83B1115, 0x4DF2607730E56A6C,
+				0x381C3DE34E49D55A, 0xA16EF894FD1EC506, 0x2311A6AE10EE2558, 0xA4E55B5D1E333B24,
+				0x2BD610599529AEAE, 0xCE1EB23465C009ED, 0x36CB946FFA741A5A, 0x81A65EC17F300C68,
+				0x223F3CC5FC889078, 0x9107FB38EF7E07C1, 0x2ACF0BF77BAAB496, 0xB549FA072B5D89B1,
+				0x3582CEF55A9561BC, 0x629C7888F634EC1E, 0x2171C159589D5D15, 0xBDA1CB5599E11393,
+				0x29CE31AFAEC4B45B, 0x2D0A3E2B00595877, 0x3441BE1B9A75E171, 0xF84CCDB5C06FAE95,
+				0x20A916D14089ACE7, 0x3B3000919845CD1D, 0x28D35C8590AC1821, 0x09FC00B5FE574065,
+				0x330833A6F4D71E29, 0x4C7B00E37DED107E, 0x3FCA4090B20CE5B3, 0x9F99C11C5D68549D,
+				0x27DE685A6F480F90, 0x43C018B1BA6134E2, 0x31D602710B1A1374, 0x54B01EDE28F9821B,
+				0x3E4B830D4DE09851, 0x69DC2695B337E2A1, 0x26EF31E850AC5F32, 0xE229981D9002EDA5,
+				0x30AAFE6264D776FF, 0x9AB3FE24F403A90E, 0x3CD5BDFAFE0D54BF, 0x8160FDAE31049351,
+				0x260596BCDEC854F7, 0xB0DC9E8CDEA2DC13, 0x2F86FC6C167A6A35, 0x9D13C630164B9318,
+				0x3B68BB871C1904C3, 0x0458B7BC1BDE77DD, 0x25217534718FA2F9, 0xE2B772D5916B0AEB,
+				0x2E69D2818DF38BB8, 0x5B654F8AF5C5CDA5, 0x3A044721F1706EA6, 0x723EA36DB337410E,
+				0x2442AC7536E64528, 0x07672624900288A9, 0x2D535792849FD672, 0x0940EFADB4032AD3,
+				0x38A82D7725C7CC0E, 0x8B912B992103F588, 0x23691C6A779CDF89, 0x173ABB3FB4A27975,
+				0x2C4363851584176B, 0x5D096A0FA1CB17D2, 0x37543C665AE51D46, 0x344BC4938A3DDDC7,
+				0x2294A5BFF8CF324B, 0xE0AF5ADC3666AA9C, 0x2B39CF2FF702FEDE, 0xD8DB319344005543,
+				0x360842FBF4C3BE96, 0x8F11FDF815006A94, 0x21C529DD78FA571E, 0x196B3EBB0D20429D,
+				0x2A367454D738ECE5, 0x9FC60E69D0685344, 0x34C4116A0D07281F, 0x07B7920444826815,
+				0x20FA8AE248247913, 0x64D2BB42AAD1810D, 0x29392D9ADA2D9758, 0x3E076A135585E150,
+				0x3387790190B8FD2E, 0x4D8944982AE759A4, 0x2034ABA0FA739E3C, 0xF075CADF1AD09807,
+				0x2841D689391085CC, 0x2C933D96E184BE08, 0x32524C2B8754A73F, 0x37B80CFC99E5ED8A,
+				0x3EE6DF366929D10F, 0x05A6103BC05F68ED, 0x27504B8201BA22A9, 0x6387CA25583BA194,
+				0x31245E628228AB53, 0xBC69BCAEAE4A89F9, 0x3D6D75FB22B2D628, 0xAB842BDA59DD2C77,
+				0x266469BCF5AFC5D9, 0x6B329B68782A3BCB, 0x2FFD842C331BB74F, 0xC5FF42429634CABD,
+				0x3BFCE5373FE2A523, 0xB77F12D33BC1FD6D, 0x257E0F4287EDA736, 0x52AF6BC405593E64,
+				0x2EDD931329E91103, 0xE75B46B506AF8DFD, 0x3A94F7D7F4635544, 0xE1321862485B717C,
+				0x249D1AE6F8BE154B, 0x0CBF4F3D6D3926EE, 0x2DC461A0B6ED9A9D, 0xCFEF230CC88770A9,
+				0x39357A08E4A90145, 0x43EAEBCFFAA94CD3, 0x23C16C458EE9A0CB, 0x4A72D361FCA9D004,
+				0x2CB1C756F2A408FE, 0x1D0F883A7BD44405, 0x37DE392CAF4D0B3D, 0xA4536A491AC95506,
+				0x22EAE3BBED902706, 0x86B4226DB0BDD524, 0x2BA59CAAE8F430C8, 0x28612B091CED4A6D,
+				0x368F03D5A3313CFA, 0x327975CB64289D08, 0x2219626585FEC61C, 0x5F8BE99F1E996225,
+				0x2A9FBAFEE77E77A3, 0x776EE406E63FBAAE, 0x3547A9BEA15E158C, 0x554A9D089FCFA95A,
+				0x214CCA1724DACD77, 0xB54EA22563E1C9D8, 0x299FFC9CEE1180D5, 0xA2A24AAEBCDA3C4E,
+				0x3407FBC42995E10B, 0x0B4ADD5A6C10CB62, 0x2084FD5A99FDACA6, 0xE70ECA58838A7F1D,
+				0x28A63CB1407D17D0, 0xA0D27CEEA46D1EE4, 0x32CFCBDD909C5DC4, 0xC9071C2A4D88669D,
+				0x3F83BED4F4C37535, 0xFB48E334E0EA8045, 0x27B2574518FA2941, 0xBD0D8E010C92902B,
+				0x319EED165F38B392, 0x2C50F1814FB73436, 0x3E06A85BF706E076, 0xB7652DE1A3A50143,
+				0x26C429397A644C4A, 0x329F3CAD064720CA, 0x30753387D8FD5F5C, 0xBF470BD847D8E8FD,
+				0x3C928069CF3CB733, 0xEF18CECE59CF233C, 0x25DB90422185F280, 0x756F8140F8217605,
+				0x2F527452A9E76F20, 0x92CB61913629D387, 0x3B27116754614AE8, 0xB77E39F583B44868,
+				0x24F86AE094BCCED1, 0x72AEE4397250AD41, 0x2E368598B9EC0285, 0xCF5A9D47CEE4D891,
+				0x39C426FEE8670327, 0x43314499C29E0EB6, 0x241A985F514061F8, 0x89FECAE019A2C932,
+				0x2D213E7725907A76, 0xAC7E7D98200B7B7E, 0x38698E14EEF49914, 0x579E1CFE280E5A5D,
+				0x2341F8CD1558DFAC, 0xB6C2D21ED908F87B, 0x2C1277005AAF1797, 0xE47386A68F4B3699,
+				0x371714C0715ADD7D, 0xDD906850331E043F, 0x226E6CF846D8CA6E, 0xAA7A41321FF2C2A8,
+				0x2B0A0836588EFD0A, 0x5518D17EA7EF7352, 0x35CC8A43EEB2BC4C, 0xEA5F05DE51EB5026,
+				0x219FD66A752FB5B0, 0x127B63AAF3331218, 0x2A07CC05127BA31C, 0x171A3C95AFFFD69E,
+				0x3489BF06571A8BE3, 0x1CE0CBBB1BFFCC45, 0x20D61763F670976D, 0xF20C7F54F17FDFAB,
+				0x290B9D3CF40CBD49, 0x6E8F9F2A2DDFD796, 0x334E848C310FEC9B, 0xCA3386F4B957CD7B,
+				0x201112D79EA9F3E1, 0x5E603458F3D6E06D, 0x2815578D865470D9, 0xB5F8416F30CC9888,
+				0x321AAD70E7E98D10, 0x237651CAFCFFBEAA, 0x3EA158CD21E3F054, 0x2C53E63DBC3FAE55,
+				0x2724D780352E7634, 0x9BB46FE695A7CCF5, 0x30EE0D60427A13C1, 0xC2A18BE03B11C033,
+				0x3D2990B8531898B2, 0x3349EED849D6303F, 0x2639FA7333EF5F6F, 0x600E35472E25DE28,
+				0x2FC8791000EB374B, 0x3811C298F9AF55B1, 0x3BBA97540126051E, 0x0616333F381B2B1E,
+				0x25549E9480B7C332, 0xC3CDE0078310FAF3, 0x2EA9C639A0E5B3FF, 0x74C1580963D539AF,
+				0x3A5437C8091F20FF, 0x51F1AE0BBCCA881B, 0x2474A2DD05B3749F, 0x93370CC755FE9511,
+				0x2D91CB94472051C7, 0x7804CFF92B7E3A55, 0x38F63E7958E86639, 0x560603F7765DC8EA,
+				0x2399E70BD7913FE3, 0xD5C3C27AA9FA9D93, 0x2C8060CECD758FDC, 0xCB34B319547944F7,
+				0x37A0790280D2F3D3, 0xFE01DFDFA9979635, 0x22C44BA19083D864, 0x7EC12BEBC9FEBDE1,
+				0x2B755E89F4A4CE7D, 0x9E7176E6BC7E6D59, 0x3652B62C71CE021D, 0x060DD4A06B9E08B0,
+				0x21F3B1DBC720C152, 0x23C8A4E44342C56E, 0x2A709E52B8E8F1A6, 0xACBACE1D541376C9,
+				0x350CC5E767232E10, 0x57E981A4A918547B, 0x2127FBB0A075FCCA, 0x36F1F106E9AF34CD,
+				0x2971FA9CC8937BFC, 0xC4AE6D48A41B0201, 0x33CE7943FAB85AFB, 0xF5DA089ACD21C281,
+				0x20610BCA7CB338DD, 0x79A84560C0351991, 0x28794EBD1BE00714, 0xD81256B8F0425FF5,
+				0x3297A26C62D808DA, 0x0E16EC672C52F7F2, 0x3F3D8B077B8E0B10, 0x919CA780F767B5EE,
+				0x278676E4AD38C6EA, 0x5B01E8B09AA0D1B5,			};
+			return table;
+		}
+		
+		
+		//======================= parsing ============================
+		
+		//* binary significand and biased exponent, `power2 < 0` when the fast path can not decide
+		struct adjusted_mantissa {
+			uint64_t mantissa;
+			int power2;
+		};
+		inline bool operator==(adjusted_mantissa a, adjusted_mantissa b) { return a.mantissa == b.mantissa && a.power2 == b.power2; }
+		inline bool operator!=(adjusted_mantissa a, adjusted_mantissa b) { return !(a == b); }
+		
+		//* Eisel-Lemire: w * 10^q rounded to nearest even, w != 0 has at most 19 digits
+		template <typename T>
+		inline adjusted_mantissa eisel_lemire(int64_t q, uint64_t w)
+		{
+			using traits = float_traits<T>;
+			if (w == 0 || q < traits::smallest_power_of_ten) {
+				return {0, 0};
+			}
+			if (q > traits::largest_power_of_ten) {
+				return {0, traits::infinite_power};
+			}
+			const int lz = count_leading_zeros(w);
+			w <<= lz;
+			
+			// the second word of 5^q is only needed when the truncated product may be one off
+			const uint64_t* pow5 = power_of_five_128() + 2 * (q + 342);
+			uint128 product = mul_64x64(w, pow5[0]);
+			const uint64_t precision_mask = ~uint64_t(0) >> (traits::mantissa_bits + 3);
+			if ((product.hi & precision_mask) == precision_mask) {
+				const uint128 second = mul_64x64(w, pow5[1]);
+				product.lo += second.hi;
+				if (second.hi > product.lo) {
+					++product.hi;
+				}
+			}
+			if (product.lo == ~uint64_t(0) && (q < -27 || q > 55)) {
+				return {0, -1}; // outside the range where 5^q is exact in 128 bits, let the fallback decide
+			}
+			
+			const int upperbit = static_cast<int>(product.hi >> 63);
+			const int shift = upperbit + 64 - traits::mantissa_bits - 3;
+			adjusted_mantissa answer;
+			answer.mantissa = product.hi >> shift;
+			// ((152170 + 65536) * q) >> 16 is floor(log2(10^q))
+			answer.power2 = static_cast<int>((((152170 + 65536) * q) >> 16) + 63) + upperbit - lz - traits::minimum_exponent;
+			if (answer.power2 <= 0) { // subnormal
+				if (-answer.power2 + 1 >= 64) {
+					return {0, 0};
+				}
+				answer.mantissa >>= -answer.power2 + 1;
+				answer.mantissa += (answer.mantissa & 1);
+				answer.mantissa >>= 1;
+				// rounding up may turn it into the smallest normal number
+				answer.power2 = (answer.mantissa < (uint64_t(1) << traits::mantissa_bits)) ? 0 : 1;
+				return answer;
+			}
+			// exactly halfway between two floats: round to even instead of up
+			if (product.lo <= 1 && q >= traits::min_exponent_round_to_even && q <= traits::max_exponent_round_to_even
+				&& (answer.mantissa & 3) == 1 && (answer.mantissa << shift) == product.hi) {
+				answer.mantissa &= ~uint64_t(1);
+			}
+			answer.mantissa += (answer.mantissa & 1);
+			answer.mantissa >>= 1;
+			if (answer.mantissa >= (uint64_t(2) << traits::mantissa_bits)) {
+				answer.mantissa = (uint64_t(1) << traits::mantissa_bits);
+				++answer.power2;
+			}
+			answer.mantissa &= ~(uint64_t(1) << traits::mantissa_bits);
+			if (answer.power2 >= traits::infinite_power) {
+				return {0, traits::infinite_power};
+			}
+			return answer;
+		}
+		
+		inline bool is_decimal_digit(char c)
+		{
+			return static_cast<unsigned char>(c - '0') < 10;
+		}
+		
+		//* SWAR: checks 8 ASCII bytes loaded in little-endian order at once
+		inline bool is_eight_digits(uint64_t chunk)
+		{
+			return ((chunk + 0x4646464646464646ull) | (chunk - 0x3030303030303030ull)) & 0x8080808080808080ull ? false : true;
+		}
+		
+		//* SWAR: converts 8 ASCII digits loaded in little-endian order, with 3 multiplications
+		inline uint32_t parse_eight_digits(uint64_t chunk)
+		{
+			const uint64_t mask = 0x000000FF000000FFull;
+			const uint64_t mul1 = 0x000F424000000064ull; // 100 + (1000000 << 32)
+			const uint64_t mul2 = 0x0000271000000001ull; // 1 + (10000 << 32)
+			chunk -= 0x3030303030303030ull;
+			chunk = (chunk * 10) + (chunk >> 8);
+			chunk = (((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32;
+			return static_cast<uint32_t>(chunk);
+		}
+		
+		//* appends the decimal digits at `p` to `i`, 8 at a time where possible. `i` may wrap around past 19 digits
+		inline const char* accumulate_digits(const char* p, const char* last, uint64_t& i)
+		{
+		#ifdef CUTIL_CPU_LITTLE_ENDIAN
+			while (last - p >= 8) {
+				uint64_t chunk;
+				std::memcpy(&chunk, p, sizeof(chunk));
+				if (!is_eight_digits(chunk)) {
+					break;
+				}
+				i = i * 100000000u + parse_eight_digits(chunk);
+				p += 8;
+			}
+		#endif
+			while (p != last && is_decimal_digit(*p)) {
+				i = 10 * i + static_cast<uint64_t>(*p - '0');
+				++p;
+			}
+			return p;
+		}
+		
+		struct parsed_decimal {
+			uint64_t mantissa;		// the first 19 significant digits
+			int64_t exponent;		// value ~= mantissa * 10^exponent
+			const char* last_match;
+			bool negative;
+			bool valid;
+			bool truncated;			// more than 19 significant digits, `mantissa` is rounded down
+		};
+		
+		//* `std::from_chars()` syntax: ['-'] (digits ['.' [digits]] | '.' digits) [('e' | 'E') ['+' | '-'] digits]
+		inline parsed_decimal parse_decimal(const char* first, const char* last)
+		{
+			parsed_decimal answer{};
+			const char* p = first;
+			answer.negative = (p != last && *p == '-');
+			if (answer.negative) {
+				++p;
+			}
+			
+			const char* const integer_begin = p;
+			uint64_t i = 0;
+			p = accumulate_digits(p, last, i); // recomputed below if it wrapped around
+			const char* const integer_end = p;
+			int64_t digit_count = integer_end - integer_begin;
+			const char* fraction_begin = p;
+			int64_t exponent = 0;
+			if (p != last && *p == '.') {
+				fraction_begin = ++p;
+				p = accumulate_digits(p, last, i);
+				exponent = fraction_begin - p;
+				digit_count -= exponent;
+			}
+			const char* const fraction_end = p;
+			if (digit_count == 0) {
+				return answer;
+			}
+			
+			int64_t exp_number = 0;
+			if (p != last && (*p == 'e' || *p == 'E')) {
+				const char* const exp_begin = p++;
+				const bool neg_exp = (p != last && *p == '-');
+				if (p != last && (*p == '-' || *p == '+')) {
+					++p;
+				}
+				if (p == last || !is_decimal_digit(*p)) {
+					p = exp_begin; // "1e" is parsed as "1"
+				} else {
+					while (p != last && is_decimal_digit(*p)) {
+						if (exp_number < 0x10000) {
+							exp_number = 10 * exp_number + (*p - '0');
+						}
+						++p;
+					}
+					if (neg_exp) {
+						exp_number = -exp_number;
+					}
+					exponent += exp_number;
+				}
+			}
+			answer.last_match = p;
+			answer.valid = true;
+			
+			if (digit_count > 19) {
+				const char* start = integer_begin; // leading zeros are not significant
+				while (start != fraction_end && (*start == '0' || *start == '.')) {
+					digit_count -= (*start == '0');
+					++start;
+				}
+				if (digit_count > 19) {
+					const uint64_t min_19_digits = 1000000000000000000u;
+					answer.truncated = true;
+					i = 0;
+					p = integer_begin;
+					while (i < min_19_digits && p != integer_end) {
+						i = 10 * i + static_cast<uint64_t>(*p - '0');
+						++p;
+					}
+					if (i >= min_19_digits) {
+						exponent = (integer_end - p) + exp_number;
+					} else {
+						p = fraction_begin;
+						while (i < min_19_digits && p != fraction_end) {
+							i = 10 * i + static_cast<uint64_t>(*p - '0');
+							++p;
+						}
+						exponent = (fraction_begin - p) + exp_number;
+					}
+				}
+			}
+			answer.mantissa = i;
+			answer.exponent = exponent;
+			return answer;
+		}
+		
+		//* compares with a lower-case ASCII word, case-insensitively
+		inline bool match_word(const char* p, const char* last, const char* word)
+		{
+			for (; *word != '\0'; ++word, ++p) {
+				if (p == last || (*p | 0x20) != *word) {
+					return false;
+				}
+			}
+			return true;
+		}
+		
+		//* "inf", "infinity", "nan" and "nan(chars)", case-insensitive, with an optional '-'
+		template <typename T>
+		inline parse_result parse_inf_nan(const char* first, const char* last, T& value)
+		{
+			const char* p = first;
+			const bool negative = (p != last && *p == '-');
+			p += negative;
+			if (match_word(p, last, "nan")) {
+				p += 3;
+				if (p != last && *p == '(') {
+					const char* q = p + 1;
+					while (q != last && (is_decimal_digit(*q) || *q == '_'
+						|| (static_cast<unsigned char>((*q | 0x20) - 'a') < 26))) {
+						++q;
+					}
+					if (q != last && *q == ')') {
+						p = q + 1;
+					}
+				}
+				value = negative ? -std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::quiet_NaN();
+				return {p, std::errc()};
+			}
+			if (match_word(p, last, "inf")) {
+				p += 3;
+				if (match_word(p, last, "inity")) {
+					p += 5;
+				}
+				value = negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+				return {p, std::errc()};
+			}
+			return {first, std::errc::invalid_argument};
+		}
+		
+		inline float strto_float(const char* str, char** end, float*) { return std::strtof(str, end); }
+		inline double strto_float(const char* str, char** end, double*) { return std::strtod(str, end); }
+		inline long double strto_float(const char* str, char** end, long double*) { return std::strtold(str, end); }
+		
+		//* exact conversion by the C library, for a range already checked by `parse_decimal()`.
+		//  '.' is swapped for the decimal point of the current C locale. returns false if out of memory.
+		template <typename T>
+		inline bool parse_float_fallback(const char* first, const char* last, T& value)
+		{
+			const size_t len = static_cast<size_t>(last - first);
+			char stack_buf[256];
+			char* buf = (len < sizeof(stack_buf)) ? stack_buf : static_cast<char*>(std::malloc(len + 1));
+			if (buf == nullptr) {
+				return false;
+			}
+			std::copy(first, last, buf);
+			buf[len] = '\0';
+			const char point = *std::localeconv()->decimal_point;
+			if (point != '.') {
+				char* dot = static_cast<char*>(std::memchr(buf, '.', len));
+				if (dot != nullptr) {
+					*dot = point;
+				}
+			}
+			value = strto_float(buf, nullptr, static_cast<T*>(nullptr));
+			if (buf != stack_buf) {
+				std::free(buf);
+			}
+			return true;
+		}
+		
+		//* exactly representable powers of ten for Clinger's fast path
+		inline double exact_power_of_ten(int e)
+		{
+			static constexpr double table[] = {
+				1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+				1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+			};
+			return table[e];
+		}
+		
+		//* float and double
+		template <typename T>
+		inline parse_result parse_float(const char* first, const char* last, T& value, std::true_type)
+		{
+			using traits = float_traits<T>;
+			const parsed_decimal pd = parse_decimal(first, last);
+			if (!pd.valid) {
+				return parse_inf_nan(first, last, value);
+			}
+			T result;
+		#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+			// Clinger's fast path: both operands are exact, so a single rounding gives the right answer
+			if (!pd.truncated && pd.exponent >= -traits::max_exponent_fast_path && pd.exponent <= traits::max_exponent_fast_path
+				&& pd.mantissa <= (uint64_t(2) << traits::mantissa_bits)) {
+				result = static_cast<T>(pd.mantissa);
+				const T scale = static_cast<T>(exact_power_of_ten(static_cast<int>(pd.exponent < 0 ? -pd.exponent : pd.exponent)));
+				result = (pd.exponent < 0) ? result / scale : result * scale;
+				value = pd.negative ? -result : result;
+				return {pd.last_match, std::errc()};
+			}
+		#endif
+			adjusted_mantissa am = eisel_lemire<T>(pd.exponent, pd.mantissa);
+			if (pd.truncated && am.power2 >= 0 && am != eisel_lemire<T>(pd.exponent, pd.mantissa + 1)) {
+				am.power2 = -1; // the dropped digits matter
+			}
+			if (am.power2 >= 0) {
+				using bits_type = typename traits::bits_type;
+				bits_type bits = static_cast<bits_type>(am.mantissa | (uint64_t(am.power2) << traits::mantissa_bits));
+				if (pd.negative) {
+					bits |= bits_type(1) << (traits::mantissa_bits + traits::exponent_bits);
+				}
+				result = float_from_bits<T>(bits);
+			} else if (!parse_float_fallback(first, pd.last_match, result)) {
+				return {first, std::errc::not_enough_memory};
+			}
+			// like `strtod()`, overflow to infinity and underflow to zero are range errors
+			if (result > std::numeric_limits<T>::max() || result < std::numeric_limits<T>::lowest()
+				|| (result == T(0) && pd.mantissa != 0)) {
+				return {pd.last_match, std::errc::result_out_of_range};
+			}
+			value = result;
+			return {pd.last_match, std::errc()};
+		}
+		//* long double, same syntax, converted by `strtold()`
+		template <typename T>
+		inline parse_result parse_float(const char* first, const char* last, T& value, std::false_type)
+		{
+			const parsed_decimal pd = parse_decimal(first, last);
+			if (!pd.valid) {
+				return parse_inf_nan(first, last, value);
+			}
+			T result;
+			if (!parse_float_fallback(first, pd.last_match, result)) {
+				return {first, std::errc::not_enough_memory};
+			}
+			if (result > std::numeric_limits<T>::max() || result < std::numeric_limits<T>::lowest()
+				|| (result == T(0) && pd.mantissa != 0)) {
+				return {pd.last_match, std::errc::result_out_of_range};
+			}
+			value = result;
+			return {pd.last_match, std::errc()};
+		}
+		
+		
+		//======================= formatting ============================
+		
+		//* floor(log10(2^e)), floor(log10(3/4 * 2^e)) and floor(log2(10^e)), exact for the exponents of double
+		inline int flog10_pow2(int e) { return static_cast<int>((int64_t(e) * 661971961083) >> 41); }
+		inline int flog10_three_quarters_pow2(int e) { return static_cast<int>((int64_t(e) * 661971961083 - 274743187321) >> 41); }
+		inline int flog2_pow10(int e) { return static_cast<int>((int64_t(e) * 913124641741) >> 38); }
+		
+		//* g * cp / 2^126 rounded to odd, g is a 126-bit entry of `schubfach_power_of_ten()`
+		inline uint64_t round_to_odd(const uint64_t* g, uint64_t cp)
+		{
+			const uint128 low = mul_64x64(g[1], cp);
+			const uint128 high = mul_64x64(g[0], cp);
+			const uint64_t mid = high.lo + low.hi;
+			const uint64_t top = high.hi + (mid < high.lo);
+			// the lowest word only holds the excess of g over 10^-k, it must not hide exact ties
+			const bool inexact = (mid & ((uint64_t(1) << 62) - 1)) != 0;
+			return (top << 2) | (mid >> 62) | static_cast<uint64_t>(inexact);
+		}
+		
+		struct decimal_fp {
+			uint64_t significand;
+			int exponent;
+		};
+		
+		//* Giulietti's Schubfach: the shortest decimal in the rounding interval of c * 2^q, the closest one if several.
+		//  `irregular` is true when c is a power of 2, whose lower neighbour is closer.
+		//  unlike Java, one-digit results are allowed, so the tiniest subnormals are not scaled by 10 first.
+		inline decimal_fp schubfach(int q, uint64_t c, bool irregular)
+		{
+			const uint64_t out = c & 1; // the interval is closed for even c (round half to even)
+			const uint64_t cb = c << 2;
+			const uint64_t cbr = cb + 2;
+			const uint64_t cbl = irregular ? cb - 1 : cb - 2;
+			const int k = irregular ? flog10_three_quarters_pow2(q) : flog10_pow2(q);
+			const int h = q + flog2_pow10(-k) + 1;
+			
+			// v, its lower and upper bounds, times 4 * 10^-k
+			const uint64_t* g = schubfach_power_of_ten() + 2 * (-k + 292);
+			const uint64_t vb = round_to_odd(g, cb << h);
+			const uint64_t vbl = round_to_odd(g, cbl << h);
+			const uint64_t vbr = round_to_odd(g, cbr << h);
+			
+			const uint64_t s = vb >> 2;
+			if (s >= 10) { // one digit less, if exactly one of the candidates is inside
+				const uint64_t sp10 = s / 10 * 10;
+				const uint64_t tp10 = sp10 + 10;
+				const bool upin = vbl + out <= (sp10 << 2);
+				const bool wpin = (tp10 << 2) + out <= vbr;
+				if (upin != wpin) {
+					return {upin ? sp10 : tp10, k};
+				}
+			}
+			const uint64_t t = s + 1;
+			const bool uin = vbl + out <= (s << 2);
+			const bool win = (t << 2) + out <= vbr;
+			if (uin != win) {
+				return {uin ? s : t, k};
+			}
+			// both are inside, take the closer one, the even one on ties
+			const uint64_t mid = (s + t) << 1;
+			return {(vb < mid || (vb == mid && (s & 1) == 0)) ? s : t, k};
+		}
+		
+		//* finite, positive and non-zero values
+		template <typename T>
+		inline decimal_fp to_decimal(T value)
+		{
+			using traits = float_traits<T>;
+			const uint64_t bits = float_to_bits(value);
+			const uint64_t t = bits & ((uint64_t(1) << traits::mantissa_bits) - 1);
+			const int bq = static_cast<int>(bits >> traits::mantissa_bits);
+			if (bq != 0) { // normal: c * 2^q
+				const int mq = -traits::min_binary_exponent + 1 - bq;
+				const uint64_t c = (uint64_t(1) << traits::mantissa_bits) | t;
+				if (0 < mq && mq <= traits::mantissa_bits) { // small integers are exact
+					const uint64_t f = c >> mq;
+					if ((f << mq) == c) {
+						return {f, 0};
+					}
+				}
+				return schubfach(-mq, c, t == 0 && bq > 1);
+			}
+			return schubfach(traits::min_binary_exponent, t, false); // subnormal
+		}
+		
+		//* the exact value of a finite, positive float with a positive binary exponent, when it fits in 128 bits
+		template <typename T>
+		inline bool exact_integer(T value, uint128& out)
+		{
+			using traits = float_traits<T>;
+			const uint64_t bits = float_to_bits(value);
+			const int bq = static_cast<int>(bits >> traits::mantissa_bits);
+			const int q = bq + traits::min_binary_exponent - 1;
+			if (bq == 0 || q <= 0 || q > 127 - traits::mantissa_bits) {
+				return false;
+			}
+			const uint64_t c = (uint64_t(1) << traits::mantissa_bits) | (bits & ((uint64_t(1) << traits::mantissa_bits) - 1));
+			out.hi = (q >= 64) ? (c << (q - 64)) : (c >> (64 - q));
+			out.lo = (q >= 64) ? 0 : (c << q);
+			return true;
+		}
+		
+		inline char* write_uint128(char* p, uint128 v)
+		{
+			uint32_t limbs[4] = {
+				static_cast<uint32_t>(v.hi >> 32), static_cast<uint32_t>(v.hi),
+				static_cast<uint32_t>(v.lo >> 32), static_cast<uint32_t>(v.lo),
+			};
+			char digits[40];
+			char* d = digits + sizeof(digits);
+			for (;;) { // 9 digits at a time
+				uint64_t rem = 0;
+				for (uint32_t& limb : limbs) {
+					const uint64_t cur = (rem << 32) | limb;
+					limb = static_cast<uint32_t>(cur / 1000000000u);
+					rem = cur % 1000000000u;
+				}
+				const bool more = (limbs[0] | limbs[1] | limbs[2] | limbs[3]) != 0;
+				for (int i = 0; i < 9 && (more || rem != 0); ++i) {
+					*--d = static_cast<char>('0' + rem % 10);
+					rem /= 10;
+				}
+				if (!more) {
+					break;
+				}
+			}
+			const size_t n = static_cast<size_t>(digits + sizeof(digits) - d);
+			std::memcpy(p, d, n);
+			return p + n;
+		}
+		
+		//* d * 10^e in fixed or scientific notation, whichever is shorter (fixed on ties), like `std::to_chars()`.
+		//  fixed notation of large integers prints all the digits of their exact value `integer`, like printf("%.0f").
+		inline char* write_decimal(char* p, uint64_t d, int e, const uint128* integer)
+		{
+			while (d % 10 == 0) {
+				d /= 10;
+				++e;
+			}
+			char digits[20];
+			int n = 0;
+			for (uint64_t v = d; v != 0; v /= 10) {
+				digits[19 - n++] = static_cast<char>('0' + v % 10);
+			}
+			const char* const digit = digits + 20 - n;
+			const int sci_exp = e + n - 1;
+			const int abs_exp = (sci_exp < 0) ? -sci_exp : sci_exp;
+			const int sci_len = n + (n > 1) + 2 + (abs_exp >= 100 ? 3 : 2);
+			const int fixed_len = (e >= 0) ? n + e : ((sci_exp >= 0) ? n + 1 : n + 1 - sci_exp);
+			
+			if (fixed_len <= sci_len) {
+				if (e >= 0 && integer != nullptr) {
+					return write_uint128(p, *integer);
+				}
+				if (e >= 0) { // 12300
+					std::memcpy(p, digit, n);
+					std::memset(p + n, '0', e);
+					return p + n + e;
+				}
+				if (sci_exp >= 0) { // 12.3
+					std::memcpy(p, digit, sci_exp + 1);
+					p[sci_exp + 1] = '.';
+					std::memcpy(p + sci_exp + 2, digit + sci_exp + 1, n - sci_exp - 1);
+					return p + n + 1;
+				}
+				*p++ = '0'; // 0.00123
+				*p++ = '.';
+				std::memset(p, '0', -sci_exp - 1);
+				p += -sci_exp - 1;
+				std::memcpy(p, digit, n);
+				return p + n;
+			}
+			*p++ = digit[0]; // 1.23e+45
+			if (n > 1) {
+				*p++ = '.';
+				std::memcpy(p, digit + 1, n - 1);
+				p += n - 1;
+			}
+			*p++ = 'e';
+			*p++ = (sci_exp < 0) ? '-' : '+';
+			if (abs_exp >= 100) {
+				*p++ = static_cast<char>('0' + abs_exp / 100);
+			}
+			*p++ = static_cast<char>('0' + abs_exp / 10 % 10);
+			*p++ = static_cast<char>('0' + abs_exp % 10);
+			return p;
+		}
+	} // namespace internal
+	
+	
+	/**
+	 * @brief Parses a float or double from the beginning of [first, last) without throwing, like `std::from_chars()`.
+	 *        Correctly rounded: Clinger's and Eisel-Lemire's fast paths cover nearly all inputs,
+	 *        the few ambiguous ones (e.g. more than 19 significant digits) go through `strtod()`.
+	 *        long double always goes through `strtold()`, with the same syntax.
+	 * @param first, last - the input, an optional '-', digits with an optional '.' and exponent, "inf", "infinity" or "nan".
+	 *        No leading spaces, '+' or hexadecimal; the decimal point is always '.', whatever the locale is.
+	 * @param value - receives the result, untouched on failure.
+	 * @return `{ptr, ec}`, `ec` is `std::errc::result_out_of_range` when the value overflows, or underflows to zero.
+	 */
+	template<typename T, typename std::enable_if<std::is_floating_point<T>::value, bool>::type = false>
+		_CUTIL_FUNC_STATIC inline
+	parse_result parse_float(const char* first, const char* last, T& value) noexcept
+	{
+		return internal::parse_float(first, last, value
+			, std::integral_constant<bool, std::is_same<T, float>::value || std::is_same<T, double>::value>());
+	}
+	
+	/**
+	 * @brief Writes the shortest text that reads back to the same float or double, like `std::to_chars(first, last, value)`:
+	 *        fixed or scientific notation, whichever is shorter, e.g. "0.1", "1e+20", "-2.5e-07", "inf", "nan".
+	 * @return the end of the written characters, or nullptr if [first, last) is too small;
+	 *         `cutil::str::float_chars_max` characters are always enough.
+	 */
+	template<typename T, typename std::enable_if<std::is_same<T, float>::value || std::is_same<T, double>::value, bool>::type = false>
+		_CUTIL_FUNC_STATIC inline
+	char* float_to_chars(char* first, char* last, T value) noexcept
+	{
+		using traits = internal::float_traits<T>;
+		char buf[float_chars_max];
+		char* p = buf;
+		const uint64_t bits = internal::float_to_bits(value);
+		const uint64_t sign_bit = uint64_t(1) << (traits::mantissa_bits + traits::exponent_bits);
+		if (bits & sign_bit) {
+			*p++ = '-';
+		}
+		const uint64_t magnitude = bits & ~sign_bit;
+		const uint64_t infinite_bits = uint64_t(traits::infinite_power) << traits::mantissa_bits;
+		if (magnitude >= infinite_bits) {
+			std::memcpy(p, (magnitude == infinite_bits) ? "inf" : "nan", 3);
+			p += 3;
+		} else if (magnitude == 0) {
+			*p++ = '0';
+		} else {
+			const T abs_value = (value < 0) ? -value : value;
+			const internal::decimal_fp dec = internal::to_decimal(abs_value);
+			internal::uint128 integer;
+			p = internal::write_decimal(p, dec.significand, dec.exponent
+										, internal::exact_integer(abs_value, integer) ? &integer : nullptr);
+		}
+		const size_t len = static_cast<size_t>(p - buf);
+		if (static_cast<size_t>(last - first) < len) {
+			return nullptr;
+		}
+		std::memcpy(first, buf, len);
+		return first + len;
+	}
+/*
+	double value = 0;
+	auto res = cutil::str::parse_float(str.data(), str.data() + str.size(), value);
+	if (res.ec == std::errc() && res.ptr == str.data() + str.size()) { ... } // whole string is a number
+	
+	char buf[cutil::str::float_chars_max];
+	std::string text(buf, cutil::str::float_to_chars(buf, buf + sizeof(buf), 0.1)); // "0.1", reads back to 0.1 exactly
+*/
+	
+	
+} // namespace str
+_CUTIL_NAMESPACE_END
+#endif /* CONSOLEUTIL_CPP_CHAR_CONV_HPP__ */
@@ -0,0 +1,331 @@
+#ifndef CONSOLEUTIL_CPP_CSV_READER_HPP__
+#define CONSOLEUTIL_CPP_CSV_READER_HPP__
+/* UTF-8 encoding
+* Project URL: https://github.com/BH2WFR/ConsoleUtil
+  Author:		BH2WFR
+  Updated:		19 OCT 2026
+  License:		MIT License
+* You can include this header in header files.
+* C++17 or later is required.
+*
+* RFC 4180 CSV / TSV reading without a copy per field:
+*   `cutil::str::csv_reader`  - rows of `std::string_view` fields, from memory or streamed from a `file_splitter`.
+*                               Quoted fields may hold delimiters, line breaks and doubled quotes.
+*   `cutil::str::parse_csv()` - the whole text as `std::vector<std::vector<std::string>>`.
+* The input is classified 64 bytes at a time like simdcsv (Langdale & Lemire): bitmasks of quotes, delimiters and line feeds,
+* a prefix XOR of the quote mask marks the quoted spans, and the delimiters left outside them are walked bit by bit.
+*/
+#include <ConsoleUtil/Base.h>
+#include <ConsoleUtil/CppBase.hpp>
+#include <ConsoleUtil/CppBit.hpp>
+#include <ConsoleUtil/CppMappedFile.hpp>
+
+#ifndef CUTIL_CPP17_SUPPORTED
+	#error ">= C++17 is required"
+#endif
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#if defined(CUTIL_CPU_ARCH_X86_64)
+	#define _CUTIL_CSV_USE_SSE2 //* SSE2 is part of x86-64
+	#include <emmintrin.h>
+#endif
+
+
+_CUTIL_NAMESPACE_BEGIN
+namespace str
+{
+	namespace internal{
+		//* bit i set: byte i of the block is `quote` / `delim` / '\n'
+		struct csv_block_masks {
+			uint64_t quotes;
+			uint64_t delims;
+			uint64_t newlines;
+		};
+
+		//* classifies up to 64 bytes; bits past `size` stay clear
+		inline csv_block_masks csv_scan_block(const char* p, size_t size, char delim, char quote) noexcept
+		{
+			alignas(16) char padded[64];
+			if (size < 64) {
+				std::memset(padded, 0, sizeof(padded));
+				if (size != 0) {
+					std::memcpy(padded, p, size);
+				}
+				p = padded;
+			}
+			csv_block_masks masks{0, 0, 0};
+		#ifdef _CUTIL_CSV_USE_SSE2
+			const __m128i quote_v = _mm_set1_epi8(quote);
+			const __m128i delim_v = _mm_set1_epi8(delim);
+			const __m128i newline_v = _mm_set1_epi8('\n');
+			for (int k = 0; k < 4; ++k) {
+				const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16 * k));
+				const int shift = 16 * k;
+				masks.quotes |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(in, quote_v)))) << shift;
+				masks.delims |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(in, delim_v)))) << shift;
+				masks.newlines |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(in, newline_v)))) << shift;
+			}
+		#else
+			for (int i = 0; i < 64; ++i) {
+				const uint64_t bit = uint64_t(1) << i;
+				masks.quotes |= p[i] == quote ? bit : 0;
+				masks.delims |= p[i] == delim ? bit : 0;
+				masks.newlines |= p[i] == '\n' ? bit : 0;
+			}
+		#endif
+			if (size < 64) { // the zero padding matches a '\0' delimiter or quote
+				const uint64_t valid = (uint64_t(1) << size) - 1;
+				masks.quotes &= valid;
+				masks.delims &= valid;
+				masks.newlines &= valid;
+			}
+			return masks;
+		}
+
+		//* bit i = XOR of bits [0, i]: set from an opening quote up to the byte before the closing one
+		inline uint64_t prefix_xor(uint64_t x) noexcept
+		{
+			x ^= x << 1;
+			x ^= x << 2;
+			x ^= x << 4;
+			x ^= x << 8;
+			x ^= x << 16;
+			x ^= x << 32;
+			return x;
+		}
+	}
+
+
+	/**
+	 * @brief Reads CSV (RFC 4180) or TSV rows as `std::string_view` fields.
+	 *        A field starting with the quote character may hold delimiters, line breaks and doubled quotes;
+	 *        its quotes are removed, and only a field with doubled quotes is copied (unescaped) into a buffer of the reader.
+	 *        Rows end at '\n' or "\r\n"; a line break at the very end of the input does not start another row,
+	 *        and an empty line is a row with one empty field, like `split("", ',')`.
+	 * @note  As in simdcsv, every quote character toggles quoting, also one in the middle of an unquoted field.
+	 * @note  The views are valid until the next call to `next_row()`, and as long as the input text, if one was given.
+	 */
+	class csv_reader {
+	public:
+		/**
+		 * @param text - the whole input.
+		 * @param delim - field separator, '\t' for TSV.
+		 * @param quote - quote character, '\0' turns quoting off.
+		 */
+		explicit csv_reader(std::string_view text, char delim = ',', char quote = '"')
+			: delim_(delim), quote_(quote)
+		{
+			reset_text(text);
+		}
+
+		/**
+		 * @brief Streams the rows of an opened file: chunks of `chunk_size` bytes are pulled from `file` as they are needed,
+		 *        and a quoted field running past the end of a chunk is stitched together with the next one.
+		 * @note  `file` has to be opened with the '\n' record delimiter, so that chunks end between rows.
+		 */
+		explicit csv_reader(file_splitter& file, char delim = ',', char quote = '"', size_t chunk_size = file_splitter::default_chunk_size)
+			: file_(&file), chunk_size_(chunk_size), delim_(delim), quote_(quote)
+		{
+			assert((file.record_delim() == '\n') && "`file` should split records on '\\n'");
+			reset_text(std::string_view());
+		}
+
+		/**
+		 * @brief Reads the next row.
+		 * @param fields - cleared, then receives the fields of the row.
+		 * @return false at the end of the input.
+		 */
+		bool next_row(std::vector<std::string_view>& fields)
+		{
+			fields.clear();
+			for (;;) {
+				if (pos_ >= text_.size() && !next_chunk()) {
+					return false;
+				}
+				const size_t row_first = pos_;
+				size_t field_first = pos_;
+				bool complete = false;
+				ranges_.clear();
+				for (;;) {
+					if (structural_ == 0) {
+						if (block_base_ + 64 >= text_.size()) {
+							break;
+						}
+						block_base_ += 64;
+						index_block();
+						continue;
+					}
+					const size_t at = block_base_ + static_cast<size_t>(cutil::countr_zero(structural_));
+					structural_ &= structural_ - 1;
+					ranges_.push_back({field_first, at});
+					field_first = at + 1;
+					if (text_[at] != delim_) { // '\n'
+						pos_ = at + 1;
+						complete = true;
+						break;
+					}
+				}
+				if (!complete) {
+					if (in_quote_ != 0 && stitch_next_chunk(row_first)) {
+						continue; // parse the row again from the joined text
+					}
+					if (in_quote_ != 0) {
+						error_ = std::errc::illegal_byte_sequence;
+					}
+					ranges_.push_back({field_first, text_.size()});
+					pos_ = text_.size();
+				}
+				finish_row(fields);
+				++rows_;
+				return true;
+			}
+		}
+
+		//* `illegal_byte_sequence` if the input ended inside a quoted field, the rest was taken as its content
+		_CUTIL_NODISCARD std::errc error() const noexcept { return error_; }
+		//* rows read so far
+		_CUTIL_NODISCARD size_t rows() const noexcept { return rows_; }
+
+	private:
+		struct field_range {
+			size_t first;
+			size_t last;
+		};
+
+		void reset_text(std::string_view text)
+		{
+			text_ = text;
+			pos_ = 0;
+			block_base_ = 0;
+			in_quote_ = 0;
+			index_block();
+		}
+
+		void index_block() noexcept
+		{
+			const size_t size = std::min<size_t>(64, text_.size() - block_base_);
+			const internal::csv_block_masks masks = internal::csv_scan_block(text_.data() + block_base_, size, delim_, quote_);
+			const uint64_t quoted = quote_ == '\0' ? 0 : (internal::prefix_xor(masks.quotes) ^ in_quote_);
+			in_quote_ = static_cast<uint64_t>(static_cast<int64_t>(quoted) >> 63); // all ones if the block ends inside quotes
+			structural_ = (masks.delims | masks.newlines) & ~quoted;
+		}
+
+		bool next_chunk()
+		{
+			if (file_ == nullptr || !file_->next_chunk(chunk_, chunk_size_)) {
+				return false;
+			}
+			stitched_.clear();
+			reset_text(chunk_.data);
+			return true;
+		}
+
+		//* the unfinished row from `row_first` on, followed by the next chunk
+		bool stitch_next_chunk(size_t row_first)
+		{
+			// at least as much as is carried over, so a field over many chunks is copied a bounded number of times
+			file_chunk next;
+			if (file_ == nullptr || !file_->next_chunk(next, std::max(chunk_size_, text_.size() - row_first))) {
+				return false;
+			}
+			std::string joined;
+			joined.reserve(text_.size() - row_first + next.data.size());
+			joined.append(text_.substr(row_first)); // `text_` may be `stitched_` itself
+			joined.append(next.data);
+			stitched_ = std::move(joined);
+			chunk_ = file_chunk();
+			reset_text(stitched_);
+			return true;
+		}
+
+		void finish_row(std::vector<std::string_view>& fields)
+		{
+			field_range& last = ranges_.back();
+			if (last.last > last.first && text_[last.last - 1] == '\r') {
+				--last.last;
+			}
+			unescaped_.clear();
+			unescaped_.reserve(last.last - ranges_.front().first); // enough for every field, so the views below stay valid
+			for (const field_range& range : ranges_) {
+				const std::string_view raw = text_.substr(range.first, range.last - range.first);
+				if (quote_ == '\0' || raw.find(quote_) == std::string_view::npos) {
+					fields.push_back(raw);
+				} else if (raw.size() >= 2 && raw.front() == quote_ && raw.back() == quote_
+						   && raw.substr(1, raw.size() - 2).find(quote_) == std::string_view::npos) {
+					fields.push_back(raw.substr(1, raw.size() - 2));
+				} else {
+					const size_t first = unescaped_.size();
+					bool quoted = false;
+					for (size_t i = 0; i < raw.size(); ++i) {
+						if (raw[i] != quote_) {
+							unescaped_ += raw[i];
+						} else if (quoted && i + 1 < raw.size() && raw[i + 1] == quote_) {
+							unescaped_ += quote_; // doubled quote
+							++i;
+						} else {
+							quoted = !quoted;
+						}
+					}
+					fields.emplace_back(unescaped_.data() + first, unescaped_.size() - first);
+				}
+			}
+		}
+
+		std::string_view text_;
+		file_splitter* file_ = nullptr;
+		size_t chunk_size_ = 0;
+		file_chunk chunk_;			// owns `text_` while streaming
+		std::string stitched_;		// or this, for a row across chunks
+		std::string unescaped_;		// fields with doubled quotes of the current row
+		std::vector<field_range> ranges_;
+		size_t pos_ = 0;			// start of the next row
+		size_t block_base_ = 0;		// offset of the 64-byte block `structural_` belongs to
+		uint64_t structural_ = 0;	// unvisited delimiters and line feeds outside quotes
+		uint64_t in_quote_ = 0;		// all ones if the block at `block_base_` ends inside quotes
+		size_t rows_ = 0;
+		char delim_;
+		char quote_;
+		std::errc error_ = std::errc();
+	};
+
+	/**
+	 * @brief Reads all rows of CSV / TSV text into strings, see `csv_reader`.
+	 */
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	std::vector<std::vector<std::string>> parse_csv(std::string_view text, char delim = ',', char quote = '"')
+	{
+		std::vector<std::vector<std::string>> rows;
+		csv_reader reader(text, delim, quote);
+		std::vector<std::string_view> fields;
+		while (reader.next_row(fields)) {
+			rows.emplace_back(fields.begin(), fields.end());
+		}
+		return rows;
+	}
+/*
+	cutil::str::csv_reader reader(text);			// "id,name\n1,\"Smith, J.\"\n2,\"say \"\"hi\"\"\"\n"
+	std::vector<std::string_view> fields;
+	while (reader.next_row(fields)) {				// {"id", "name"}, {"1", "Smith, J."}, {"2", "say \"hi\""}
+		...
+	}
+
+	cutil::str::file_splitter file;
+	file.open("export.tsv");
+	cutil::str::csv_reader tsv(file, '\t');		// streamed, the file may be bigger than memory
+	while (tsv.next_row(fields)) { ... }
+	if (tsv.error() != std::errc()) { ... }		// unterminated quote
+
+	auto table = cutil::str::parse_csv("a,b\n1,2\n");	// -> {{"a", "b"}, {"1", "2"}}
+*/
+
+} // namespace str
+_CUTIL_NAMESPACE_END
+#endif /* CONSOLEUTIL_CPP_CSV_READER_HPP__ */
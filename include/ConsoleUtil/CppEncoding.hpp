@@ -0,0 +1,612 @@
+#ifndef CONSOLEUTIL_CPP_ENCODING_HPP__
+#define CONSOLEUTIL_CPP_ENCODING_HPP__
+/* UTF-8 encoding
+* Project URL: https://github.com/BH2WFR/ConsoleUtil
+  Author:		BH2WFR
+  Updated:		19 OCT 2026
+  License:		MIT License
+* You can include this header in header files.
+* C++14 or later is required.
+*
+* Text encodings without iconv, for the code pages the console layer switches to (`cutil::console::Encodings`):
+*   `cutil::str::validate_utf8()` - ASCII fast path, and the lookup-table validator of Keiser & Lemire with SSSE3 on x86-64.
+*   `cutil::str::to_utf8()`       - CP936 (GBK) / CP950 (Big5) / CP932 (Shift_JIS) -> UTF-8, into a caller buffer.
+*   `cutil::str::from_utf8()`     - UTF-8 -> CP936 / CP950 / CP932, into a caller buffer.
+*/
+#include <ConsoleUtil/Base.h>
+#include <ConsoleUtil/CppBase.hpp>
+#include <ConsoleUtil/CppCharConv.hpp>
+#include <ConsoleUtil/CppEncodingTables.hpp>
+
+#ifndef CUTIL_CPP14_SUPPORTED
+	#error ">= C++14 is required"
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <system_error>
+
+#if defined(CUTIL_CPU_ARCH_X86_64) && (defined(__GNUC__) || defined(CUTIL_COMPILER_MSVC))
+	#define _CUTIL_ENCODING_USE_SSSE3 //* SSE2 is part of x86-64, SSSE3 is checked at runtime
+	#include <immintrin.h>
+	#ifdef CUTIL_COMPILER_MSVC
+		#include <intrin.h>
+		#define _CUTIL_TARGET_SSSE3
+	#else
+		#define _CUTIL_TARGET_SSSE3 __attribute__((target("ssse3")))
+	#endif
+#endif
+
+
+_CUTIL_NAMESPACE_BEGIN
+namespace str
+{
+	//* double-byte code pages, numbered like `cutil::console::Encodings`
+	enum class codepage : uint16_t {
+		gbk			= 936,	// CP936, Simp. Chinese
+		big5		= 950,	// CP950, Trad. Chinese
+		shift_jis	= 932,	// CP932, Japanese
+	};
+
+	struct transcode_result {
+		size_t read;	// input bytes consumed
+		size_t written;	// output bytes written
+		std::errc ec;	// std::errc() when everything was converted,
+						// `illegal_byte_sequence`: the input at `read` is malformed or has no mapping in the target encoding,
+						// `value_too_large`: the output buffer is full, call again with the rest of the input.
+
+		_CUTIL_NODISCARD bool ok() const noexcept { return ec == std::errc(); }
+	};
+
+
+	namespace internal{
+		//* length of the leading run of ASCII bytes
+		inline size_t ascii_prefix(const char* p, size_t n) noexcept
+		{
+			size_t i = 0;
+		#ifdef _CUTIL_ENCODING_USE_SSSE3
+			for (; i + 16 <= n; i += 16) {
+				if (_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i))) != 0) {
+					break;
+				}
+			}
+		#else
+			for (; i + 8 <= n; i += 8) {
+				uint64_t chunk;
+				std::memcpy(&chunk, p + i, sizeof(chunk));
+				if (chunk & 0x8080808080808080ull) {
+					break;
+				}
+			}
+		#endif
+			while (i < n && static_cast<uint8_t>(p[i]) < 0x80) {
+				++i;
+			}
+			return i;
+		}
+
+		//* decodes the sequence at `p`, returns its length, or 0 if it is not well-formed UTF-8
+		//  (overlong forms, surrogates, code points above U+10FFFF and truncated sequences are rejected)
+		inline size_t decode_utf8(const uint8_t* p, const uint8_t* last, uint32_t& cp) noexcept
+		{
+			const uint8_t c = p[0];
+			const size_t left = static_cast<size_t>(last - p);
+			if (c < 0x80) {
+				cp = c;
+				return 1;
+			}
+			if (c < 0xC2) { // continuation byte, or overlong 2-byte form
+				return 0;
+			}
+			if (c < 0xE0) {
+				if (left < 2 || (p[1] & 0xC0) != 0x80) {
+					return 0;
+				}
+				cp = (static_cast<uint32_t>(c & 0x1F) << 6) | (p[1] & 0x3F);
+				return 2;
+			}
+			if (c < 0xF0) {
+				const uint8_t lo = c == 0xE0 ? 0xA0 : 0x80;
+				const uint8_t hi = c == 0xED ? 0x9F : 0xBF;
+				if (left < 3 || p[1] < lo || p[1] > hi || (p[2] & 0xC0) != 0x80) {
+					return 0;
+				}
+				cp = (static_cast<uint32_t>(c & 0x0F) << 12) | (static_cast<uint32_t>(p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+				return 3;
+			}
+			if (c < 0xF5) {
+				const uint8_t lo = c == 0xF0 ? 0x90 : 0x80;
+				const uint8_t hi = c == 0xF4 ? 0x8F : 0xBF;
+				if (left < 4 || p[1] < lo || p[1] > hi || (p[2] & 0xC0) != 0x80 || (p[3] & 0xC0) != 0x80) {
+					return 0;
+				}
+				cp = (static_cast<uint32_t>(c & 0x07) << 18) | (static_cast<uint32_t>(p[1] & 0x3F) << 12)
+				   | (static_cast<uint32_t>(p[2] & 0x3F) << 6) | (p[3] & 0x3F);
+				return 4;
+			}
+			return 0;
+		}
+
+		//* returns the start of the first malformed sequence, or `last`
+		inline const char* validate_utf8_scalar(const char* first, const char* last) noexcept
+		{
+			while (first != last) {
+				if (static_cast<uint8_t>(*first) < 0x80) {
+					first += ascii_prefix(first, static_cast<size_t>(last - first));
+					continue;
+				}
+				uint32_t cp;
+				const size_t len = decode_utf8(reinterpret_cast<const uint8_t*>(first), reinterpret_cast<const uint8_t*>(last), cp);
+				if (len == 0) {
+					return first;
+				}
+				first += len;
+			}
+			return last;
+		}
+
+	#ifdef _CUTIL_ENCODING_USE_SSSE3
+		inline bool cpu_has_ssse3() noexcept
+		{
+			static const bool has = [] {
+			#ifdef CUTIL_COMPILER_MSVC
+				int info[4];
+				__cpuid(info, 1);
+				return (info[2] & (1 << 9)) != 0;
+			#else
+				return __builtin_cpu_supports("ssse3") != 0;
+			#endif
+			}();
+			return has;
+		}
+
+		//* "Validating UTF-8 In Less Than One Instruction Per Byte" (Keiser & Lemire, 2021):
+		//  three 16-entry tables, indexed by the nibbles of each byte and of the byte before it, flag every invalid 2-byte pattern;
+		//  the bytes that must be the 3rd or 4th of a sequence are found separately from the bytes 2 and 3 positions back.
+		struct utf8_lookup_checker {
+			__m128i error;
+			__m128i prev_input;
+			__m128i prev_incomplete;
+
+			_CUTIL_TARGET_SSSE3 utf8_lookup_checker()
+				: error(_mm_setzero_si128()), prev_input(_mm_setzero_si128()), prev_incomplete(_mm_setzero_si128()) {}
+
+			//* all ASCII: only a sequence cut off by the previous block is an error
+			_CUTIL_TARGET_SSSE3 void check_ascii(__m128i input)
+			{
+				error = _mm_or_si128(error, prev_incomplete);
+				prev_incomplete = _mm_setzero_si128();
+				prev_input = input;
+			}
+
+			_CUTIL_TARGET_SSSE3 void check(__m128i input)
+			{
+				if (_mm_movemask_epi8(input) == 0) {
+					check_ascii(input);
+					return;
+				}
+
+				constexpr uint8_t too_short = 1 << 0;		// 11______ 0_______ / 11______ 11______
+				constexpr uint8_t too_long = 1 << 1;		// 0_______ 10______
+				constexpr uint8_t overlong_3 = 1 << 2;		// 11100000 100_____
+				constexpr uint8_t too_large = 1 << 3;		// 11110100 1001____, 11110100 101_____, 11110101+ 10______
+				constexpr uint8_t surrogate = 1 << 4;		// 11101101 101_____
+				constexpr uint8_t overlong_2 = 1 << 5;		// 1100000_ 10______
+				constexpr uint8_t too_large_1000 = 1 << 6;	// 11110101+ 1000____
+				constexpr uint8_t overlong_4 = 1 << 6;		// 11110000 1000____
+				constexpr uint8_t two_conts = 1 << 7;		// 10______ 10______
+				constexpr uint8_t carry = too_short | too_long | two_conts;
+
+				const __m128i byte_1_high_table = _mm_setr_epi8(
+					too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+					static_cast<char>(two_conts), static_cast<char>(two_conts), static_cast<char>(two_conts), static_cast<char>(two_conts),
+					too_short | overlong_2,
+					too_short,
+					too_short | overlong_3 | surrogate,
+					too_short | too_large | too_large_1000 | overlong_4);
+				const __m128i byte_1_low_table = _mm_setr_epi8(
+					static_cast<char>(carry | overlong_3 | overlong_2 | overlong_4),
+					static_cast<char>(carry | overlong_2),
+					static_cast<char>(carry),
+					static_cast<char>(carry),
+					static_cast<char>(carry | too_large),
+					static_cast<char>(carry | too_large | too_large_1000),
+					static_cast<char>(carry | too_large | too_large_1000),
+					static_cast<char>(carry | too_large | too_large_1000),
+					static_cast<char>(carry | too_large | too_large_1000),
+					static_cast<char>(carry | too_large | too_large_1000),
+					static_cast<char>(carry | too_large | too_large_1000),
+					static_cast<char>(carry | too_large | too_large_1000),
+					static_cast<char>(carry | too_large | too_large_1000),
+					static_cast<char>(carry | too_large | too_large_1000 | surrogate),
+					static_cast<char>(carry | too_large | too_large_1000),
+					static_cast<char>(carry | too_large | too_large_1000));
+				const __m128i byte_2_high_table = _mm_setr_epi8(
+					too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+					static_cast<char>(too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4),
+					static_cast<char>(too_long | overlong_2 | two_conts | overlong_3 | too_large),
+					static_cast<char>(too_long | overlong_2 | two_conts | surrogate | too_large),
+					static_cast<char>(too_long | overlong_2 | two_conts | surrogate | too_large),
+					too_short, too_short, too_short, too_short);
+
+				const __m128i low_nibble = _mm_set1_epi8(0x0F);
+				const __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+				const __m128i byte_1_high = _mm_shuffle_epi8(byte_1_high_table, _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble));
+				const __m128i byte_1_low = _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev1, low_nibble));
+				const __m128i byte_2_high = _mm_shuffle_epi8(byte_2_high_table, _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble));
+				const __m128i special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+				// bytes 2 / 3 back >= 0xE0 / 0xF0 make this one a required continuation, which the tables saw as `two_conts`
+				const __m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+				const __m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+				const __m128i is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+				const __m128i is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+				const __m128i must_be_continuation = _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(static_cast<char>(0x80)));
+				error = _mm_or_si128(error, _mm_xor_si128(must_be_continuation, special_cases));
+
+				// a lead byte in the last 3 positions needs bytes from the next block
+				const __m128i max_value = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+					static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+				prev_incomplete = _mm_subs_epu8(input, max_value);
+				prev_input = input;
+			}
+
+			_CUTIL_TARGET_SSSE3 bool has_error() const
+			{
+				return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) != 0xFFFF;
+			}
+		};
+
+		_CUTIL_TARGET_SSSE3 inline const char* validate_utf8_ssse3(const char* first, const char* last) noexcept
+		{
+			utf8_lookup_checker checker;
+			const char* p = first;
+			const char* checked = first; // no error before this
+			bool failed = false;
+			while (last - p >= 64) {
+				const __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+				const __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16));
+				const __m128i b2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 32));
+				const __m128i b3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 48));
+				if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(b0, b1), _mm_or_si128(b2, b3))) == 0) {
+					checker.check_ascii(b3);
+				} else {
+					checker.check(b0);
+					checker.check(b1);
+					checker.check(b2);
+					checker.check(b3);
+				}
+				if (checker.has_error()) {
+					failed = true;
+					break;
+				}
+				p += 64;
+				checked = p;
+			}
+			if (!failed) {
+				while (last - p >= 16) {
+					checker.check(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+					p += 16;
+				}
+				// the rest padded with ASCII, which also flags a sequence cut off by the end of the input
+				alignas(16) char tail[16] = {};
+				std::memcpy(tail, p, static_cast<size_t>(last - p));
+				checker.check(_mm_load_si128(reinterpret_cast<const __m128i*>(tail)));
+				if (!checker.has_error()) {
+					return last;
+				}
+			}
+			// locate the error with the scalar validator, from the start of the last sequence before `checked`,
+			// which may be cut off there: up to 3 continuation bytes back, and the lead byte before them
+			for (int k = 0; k < 3 && checked != first && (static_cast<uint8_t>(checked[-1]) & 0xC0) == 0x80; ++k) {
+				--checked;
+			}
+			if (checked != first && static_cast<uint8_t>(checked[-1]) >= 0xC0) {
+				--checked;
+			}
+			return validate_utf8_scalar(checked, last);
+		}
+	#endif
+
+
+		//* decoding tables of one double-byte code page, see <ConsoleUtil/CppEncodingTables.hpp>
+		struct dbcs_codec {
+			const uint8_t* lead_rows;
+			const uint16_t* singles;
+			const uint16_t* to_unicode;
+			const uint16_t* decode_only;
+			size_t decode_only_count;
+			uint8_t trail_first;
+			uint8_t trail_last;
+		};
+
+		inline const dbcs_codec* find_dbcs_codec(codepage cp) noexcept
+		{
+			static const dbcs_codec cp936 = [] {
+				size_t count;
+				const uint16_t* decode_only = cp936_decode_only(count);
+				return dbcs_codec{cp936_lead_rows(), cp936_singles(), cp936_to_unicode(), decode_only, count, 0x40, 0xFE};
+			}();
+			static const dbcs_codec cp950 = [] {
+				size_t count;
+				const uint16_t* decode_only = cp950_decode_only(count);
+				return dbcs_codec{cp950_lead_rows(), cp950_singles(), cp950_to_unicode(), decode_only, count, 0x40, 0xFE};
+			}();
+			static const dbcs_codec cp932 = [] {
+				size_t count;
+				const uint16_t* decode_only = cp932_decode_only(count);
+				return dbcs_codec{cp932_lead_rows(), cp932_singles(), cp932_to_unicode(), decode_only, count, 0x40, 0xFC};
+			}();
+			switch (cp) {
+				case codepage::gbk:			return &cp936;
+				case codepage::big5:		return &cp950;
+				case codepage::shift_jis:	return &cp932;
+			}
+			return nullptr;
+		}
+
+		//* inverts the decoding tables: UTF-16 code unit -> (lead << 8 | trail), or the single byte; 0 = no mapping
+		inline std::unique_ptr<uint16_t[]> build_from_unicode(const dbcs_codec& codec)
+		{
+			std::unique_ptr<uint16_t[]> table(new uint16_t[0x10000]());
+			for (uint16_t b = 0; b < 0x80; ++b) {
+				table[b] = b;
+			}
+			for (uint16_t b = 0x80; b < 0x100; ++b) {
+				const uint16_t u = codec.singles[b - 0x80];
+				if (u != 0 && table[u] == 0) {
+					table[u] = b;
+				}
+			}
+			const size_t width = static_cast<size_t>(codec.trail_last - codec.trail_first) + 1;
+			for (uint16_t lead = 0x80; lead < 0x100; ++lead) {
+				const uint8_t row = codec.lead_rows[lead];
+				if (row == 0) {
+					continue;
+				}
+				for (size_t t = 0; t < width; ++t) {
+					const uint16_t u = codec.to_unicode[(row - 1) * width + t];
+					const uint16_t code = static_cast<uint16_t>((lead << 8) | (codec.trail_first + t));
+					if (u != 0 && table[u] == 0
+						&& !std::binary_search(codec.decode_only, codec.decode_only + codec.decode_only_count, code)) {
+						table[u] = code;
+					}
+				}
+			}
+			return table;
+		}
+
+		//* built on first use, 128 KB per code page
+		inline const uint16_t* from_unicode_table(codepage cp)
+		{
+			switch (cp) {
+				case codepage::gbk: {
+					static const std::unique_ptr<uint16_t[]> table = build_from_unicode(*find_dbcs_codec(cp));
+					return table.get();
+				}
+				case codepage::big5: {
+					static const std::unique_ptr<uint16_t[]> table = build_from_unicode(*find_dbcs_codec(cp));
+					return table.get();
+				}
+				case codepage::shift_jis: {
+					static const std::unique_ptr<uint16_t[]> table = build_from_unicode(*find_dbcs_codec(cp));
+					return table.get();
+				}
+			}
+			return nullptr;
+		}
+
+		//* copies the ASCII run at the start of the input, as far as the output has room
+		inline void copy_ascii(const char* src, size_t src_size, char* dst, size_t dst_size, size_t& i, size_t& o) noexcept
+		{
+			const size_t run = ascii_prefix(src + i, std::min(src_size - i, dst_size - o));
+			std::memcpy(dst + o, src + i, run);
+			i += run;
+			o += run;
+		}
+
+		inline transcode_result dbcs_to_utf8(const dbcs_codec& codec, const char* src, size_t src_size, char* dst, size_t dst_size, bool replace) noexcept
+		{
+			const size_t width = static_cast<size_t>(codec.trail_last - codec.trail_first) + 1;
+			size_t i = 0, o = 0;
+			while (i < src_size) {
+				const uint8_t c = static_cast<uint8_t>(src[i]);
+				if (c < 0x80) {
+					if (o == dst_size) {
+						return {i, o, std::errc::value_too_large};
+					}
+					copy_ascii(src, src_size, dst, dst_size, i, o);
+					continue;
+				}
+
+				uint32_t u = codec.singles[c - 0x80];
+				size_t len = 1;
+				if (u == 0) {
+					const uint8_t row = codec.lead_rows[c];
+					const bool has_trail = row != 0 && i + 1 < src_size
+						&& static_cast<uint8_t>(src[i + 1]) >= codec.trail_first && static_cast<uint8_t>(src[i + 1]) <= codec.trail_last;
+					if (has_trail) {
+						u = codec.to_unicode[(row - 1) * width + (static_cast<uint8_t>(src[i + 1]) - codec.trail_first)];
+						len = 2;
+					}
+					if (u == 0) {
+						if (!replace) {
+							return {i, o, std::errc::illegal_byte_sequence};
+						}
+						u = 0xFFFD; // a pair with a proper trail byte is dropped as a whole, anything else byte by byte
+					}
+				}
+
+				const size_t n = u < 0x800 ? 2 : 3;
+				if (dst_size - o < n) {
+					return {i, o, std::errc::value_too_large};
+				}
+				if (n == 2) {
+					dst[o] = static_cast<char>(0xC0 | (u >> 6));
+					dst[o + 1] = static_cast<char>(0x80 | (u & 0x3F));
+				} else {
+					dst[o] = static_cast<char>(0xE0 | (u >> 12));
+					dst[o + 1] = static_cast<char>(0x80 | ((u >> 6) & 0x3F));
+					dst[o + 2] = static_cast<char>(0x80 | (u & 0x3F));
+				}
+				i += len;
+				o += n;
+			}
+			return {i, o, std::errc()};
+		}
+
+		inline transcode_result utf8_to_dbcs(const uint16_t* from_unicode, const char* src, size_t src_size, char* dst, size_t dst_size, bool replace) noexcept
+		{
+			const uint8_t* const last = reinterpret_cast<const uint8_t*>(src) + src_size;
+			size_t i = 0, o = 0;
+			while (i < src_size) {
+				const uint8_t c = static_cast<uint8_t>(src[i]);
+				if (c < 0x80) {
+					if (o == dst_size) {
+						return {i, o, std::errc::value_too_large};
+					}
+					copy_ascii(src, src_size, dst, dst_size, i, o);
+					continue;
+				}
+
+				uint32_t u = 0;
+				size_t len = decode_utf8(reinterpret_cast<const uint8_t*>(src) + i, last, u);
+				uint16_t code = (len != 0 && u < 0x10000) ? from_unicode[u] : 0;
+				if (code == 0) {
+					if (!replace) {
+						return {i, o, std::errc::illegal_byte_sequence};
+					}
+					code = '?'; // every byte of malformed input becomes one '?'
+					len = len == 0 ? 1 : len;
+				}
+
+				const size_t n = code > 0xFF ? 2 : 1;
+				if (dst_size - o < n) {
+					return {i, o, std::errc::value_too_large};
+				}
+				if (n == 2) {
+					dst[o] = static_cast<char>(code >> 8);
+					dst[o + 1] = static_cast<char>(code & 0xFF);
+				} else {
+					dst[o] = static_cast<char>(code);
+				}
+				i += len;
+				o += n;
+			}
+			return {i, o, std::errc()};
+		}
+	}
+
+
+	/**
+	 * @brief Checks that [first, last) is well-formed UTF-8: no overlong forms, surrogates, code points above U+10FFFF,
+	 *        stray continuation bytes or truncated sequences.
+	 *        ASCII is skipped 8 bytes at a time (16 with SSSE3); on x86-64 CPUs with SSSE3, the rest is checked 16 bytes at a time too.
+	 * @return `ptr` is the start of the first malformed sequence with `ec == std::errc::illegal_byte_sequence`,
+	 *         or `last` with `ec == std::errc()`.
+	 */
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	parse_result validate_utf8(const char* first, const char* last) noexcept
+	{
+	#ifdef _CUTIL_ENCODING_USE_SSSE3
+		const char* bad = internal::cpu_has_ssse3() ? internal::validate_utf8_ssse3(first, last)
+													: internal::validate_utf8_scalar(first, last);
+	#else
+		const char* bad = internal::validate_utf8_scalar(first, last);
+	#endif
+		return {bad, bad == last ? std::errc() : std::errc::illegal_byte_sequence};
+	}
+
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	bool is_valid_utf8(const char* data, size_t size) noexcept
+	{
+		return validate_utf8(data, data + size).ec == std::errc();
+	}
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	bool is_valid_utf8(const std::string& str) noexcept
+	{
+		return is_valid_utf8(str.data(), str.size());
+	}
+
+	//* output size that always fits `to_utf8()` of `src_size` bytes
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline constexpr
+	size_t max_utf8_size(size_t src_size) noexcept { return src_size * 3; }
+	//* output size that always fits `from_utf8()` of `src_size` bytes
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline constexpr
+	size_t max_codepage_size(size_t src_size) noexcept { return src_size; }
+
+	/**
+	 * @brief Converts text in a double-byte code page to UTF-8, table driven, into a caller buffer.
+	 * @param cp - encoding of `src`.
+	 * @param src, src_size - input text.
+	 * @param dst, dst_size - output buffer, `max_utf8_size(src_size)` is always enough.
+	 * @param replace_invalid - write U+FFFD for malformed or unmapped input instead of stopping.
+	 * @return bytes read and written, and why it stopped. A lead byte at the very end of `src` is malformed input,
+	 *         keep it for the next chunk when converting a stream.
+	 */
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	transcode_result to_utf8(codepage cp, const char* src, size_t src_size, char* dst, size_t dst_size, bool replace_invalid = false) noexcept
+	{
+		const internal::dbcs_codec* codec = internal::find_dbcs_codec(cp);
+		if (codec == nullptr) {
+			return {0, 0, std::errc::invalid_argument};
+		}
+		return internal::dbcs_to_utf8(*codec, src, src_size, dst, dst_size, replace_invalid);
+	}
+
+	/**
+	 * @brief Converts UTF-8 text to a double-byte code page, table driven, into a caller buffer.
+	 *        The encoding table of `cp` (128 KB) is built on first use.
+	 * @param cp - target encoding.
+	 * @param src, src_size - UTF-8 input.
+	 * @param dst, dst_size - output buffer, `max_codepage_size(src_size)` is always enough.
+	 * @param replace_invalid - write '?' for characters the code page does not have, and for each byte of malformed UTF-8.
+	 * @return bytes read and written, and why it stopped.
+	 */
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	transcode_result from_utf8(codepage cp, const char* src, size_t src_size, char* dst, size_t dst_size, bool replace_invalid = false)
+	{
+		const uint16_t* table = internal::from_unicode_table(cp);
+		if (table == nullptr) {
+			return {0, 0, std::errc::invalid_argument};
+		}
+		return internal::utf8_to_dbcs(table, src, src_size, dst, dst_size, replace_invalid);
+	}
+
+	//* `to_utf8()` of a whole string, malformed or unmapped input becomes U+FFFD
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	std::string to_utf8(codepage cp, const std::string& str)
+	{
+		std::string result(max_utf8_size(str.size()), '\0');
+		const transcode_result res = to_utf8(cp, str.data(), str.size(), &result[0], result.size(), true);
+		result.resize(res.written);
+		return result;
+	}
+
+	//* `from_utf8()` of a whole string, characters the code page does not have become '?'
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	std::string from_utf8(codepage cp, const std::string& str)
+	{
+		std::string result(max_codepage_size(str.size()), '\0');
+		const transcode_result res = from_utf8(cp, str.data(), str.size(), &result[0], result.size(), true);
+		result.resize(res.written);
+		return result;
+	}
+/*
+	bool ok = cutil::str::is_valid_utf8(line);
+	auto res = cutil::str::validate_utf8(line.data(), line.data() + line.size()); // res.ptr: first bad byte
+
+	char buf[256];
+	auto r = cutil::str::to_utf8(cutil::str::codepage::gbk, gbk_text, gbk_size, buf, sizeof(buf));
+	if (r.ec == std::errc::value_too_large) { ... }	// flush buf[0, r.written), continue from gbk_text + r.read
+
+	std::string gbk = cutil::str::from_utf8(cutil::str::codepage::gbk, u8_text);
+	std::string sjis = cutil::str::from_utf8(cutil::str::codepage::shift_jis, "\xE6\x97\xA5\xE6\x9C\xAC"); // "日本" -> "\x93\xFA\x96\x7B"
+*/
+
+} // namespace str
+_CUTIL_NAMESPACE_END
+#endif /* CONSOLEUTIL_CPP_ENCODING_HPP__ */
@@ -0,0 +1,319 @@
+#ifndef CONSOLEUTIL_CPP_HASH_HPP__
+#define CONSOLEUTIL_CPP_HASH_HPP__
+/* UTF-8 encoding
+* Project URL: https://github.com/BH2WFR/ConsoleUtil
+  Author:		BH2WFR
+  Updated:		19 OCT 2026
+  License:		MIT License
+* You can include this header in header files.
+* C++14 or later is required.
+*
+* Non-cryptographic hashes of strings and byte buffers, with the same results on every standard library:
+*   `cutil::fnv1a_32()` / `fnv1a_64()` - FNV-1a, `constexpr`: for hashes computed at compile time, short keys, or checksums in file formats.
+*   `cutil::hash_bytes()`              - 64-bit, seeded, after wyhash: 128-bit multiplies over 16 or 48 bytes at a time,
+*                                        several GB/s on long inputs and a few ns on short keys.
+*   `cutil::hash_stream`               - `hash_bytes()` over a stream of chunks, same result as hashing them joined.
+*   `cutil::string_hash`               - transparent hasher for `std::unordered_map<std::string, T>` and friends.
+* Not for untrusted keys where collisions are an attack, nor for anything cryptographic.
+* `hash_bytes()` reads words as little-endian, so results do not depend on the CPU either.
+*/
+#include <ConsoleUtil/Base.h>
+#include <ConsoleUtil/CppBase.hpp>
+#include <ConsoleUtil/CppBit.hpp>
+#include <ConsoleUtil/External/Span.hpp>
+
+#ifndef CUTIL_CPP14_SUPPORTED
+	#error ">= C++14 is required"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#ifdef CUTIL_CPP17_SUPPORTED
+	#include <string_view>
+#endif
+#if defined(CUTIL_COMPILER_MSVC) && defined(CUTIL_CPU_ARCH_X86_64)
+	#include <intrin.h>
+#endif
+
+
+_CUTIL_NAMESPACE_BEGIN
+
+
+namespace internal {
+	static constexpr uint32_t fnv1a_32_basis = 0x811C9DC5u;
+	static constexpr uint32_t fnv1a_32_prime = 0x01000193u;
+	static constexpr uint64_t fnv1a_64_basis = 0xCBF29CE484222325u;
+	static constexpr uint64_t fnv1a_64_prime = 0x00000100000001B3u;
+
+	static constexpr uint64_t wy_secret[4] = {0x2D358DCCAA6C78A5u, 0x8BB84B93962EACC9u, 0x4B33A62ED433D4A3u, 0x4D5A2DA51DE1AA47u};
+
+	//* full 64 x 64 -> 128-bit product: `a` gets the low half, `b` the high half
+	inline void wy_mum(uint64_t& a, uint64_t& b) noexcept
+	{
+	#if defined(__SIZEOF_INT128__)
+		const __uint128_t r = static_cast<__uint128_t>(a) * b;
+		a = static_cast<uint64_t>(r);
+		b = static_cast<uint64_t>(r >> 64);
+	#elif defined(CUTIL_COMPILER_MSVC) && defined(CUTIL_CPU_ARCH_X86_64)
+		a = _umul128(a, b, &b);
+	#else
+		const uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a), lb = static_cast<uint32_t>(b);
+		const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+		const uint64_t t = rl + (rm0 << 32);
+		const uint64_t lo = t + (rm1 << 32);
+		const uint64_t carry = static_cast<uint64_t>(t < rl) + static_cast<uint64_t>(lo < t);
+		b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+		a = lo;
+	#endif
+	}
+	inline uint64_t wy_mix(uint64_t a, uint64_t b) noexcept
+	{
+		wy_mum(a, b);
+		return a ^ b;
+	}
+
+	inline uint64_t wy_read8(const uint8_t* p) noexcept
+	{
+		uint64_t v;
+		std::memcpy(&v, p, 8);
+	#ifdef CUTIL_CPU_BIG_ENDIAN
+		v = cutil::byteswap(v);
+	#endif
+		return v;
+	}
+	inline uint64_t wy_read4(const uint8_t* p) noexcept
+	{
+		uint32_t v;
+		std::memcpy(&v, p, 4);
+	#ifdef CUTIL_CPU_BIG_ENDIAN
+		v = cutil::byteswap(v);
+	#endif
+		return v;
+	}
+
+	inline uint64_t wy_seed(uint64_t seed) noexcept
+	{
+		return seed ^ wy_mix(seed ^ wy_secret[0], wy_secret[1]);
+	}
+
+	//* 48 bytes at a time in three independent lanes, as long as more than 48 bytes are left; returns the bytes consumed
+	inline size_t wy_blocks(const uint8_t* p, size_t size, uint64_t& seed, uint64_t& see1, uint64_t& see2) noexcept
+	{
+		size_t i = 0;
+		for (; size - i > 48; i += 48) {
+			seed = wy_mix(wy_read8(p + i) ^ wy_secret[1], wy_read8(p + i + 8) ^ seed);
+			see1 = wy_mix(wy_read8(p + i + 16) ^ wy_secret[2], wy_read8(p + i + 24) ^ see1);
+			see2 = wy_mix(wy_read8(p + i + 32) ^ wy_secret[3], wy_read8(p + i + 40) ^ see2);
+		}
+		return i;
+	}
+
+	//* the last 1 - 48 bytes (all of them if `len` <= 16), `len` is the whole input;
+	//  when `len` > 16 the last 16 bytes are read even if they start before `p`
+	inline uint64_t wy_finish(const uint8_t* p, size_t size, uint64_t len, uint64_t seed) noexcept
+	{
+		uint64_t a, b;
+		if (len <= 16) {
+			if (size >= 4) {
+				const size_t step = (size >> 3) << 2;
+				a = (wy_read4(p) << 32) | wy_read4(p + step);
+				b = (wy_read4(p + size - 4) << 32) | wy_read4(p + size - 4 - step);
+			} else if (size > 0) {
+				a = (static_cast<uint64_t>(p[0]) << 16) | (static_cast<uint64_t>(p[size >> 1]) << 8) | p[size - 1];
+				b = 0;
+			} else {
+				a = b = 0;
+			}
+		} else {
+			for (; size > 16; size -= 16, p += 16) {
+				seed = wy_mix(wy_read8(p) ^ wy_secret[1], wy_read8(p + 8) ^ seed);
+			}
+			a = wy_read8(p + size - 16);
+			b = wy_read8(p + size - 8);
+		}
+		a ^= wy_secret[1];
+		b ^= seed;
+		wy_mum(a, b);
+		return wy_mix(a ^ wy_secret[0] ^ len, b ^ wy_secret[1]);
+	}
+} // namespace internal
+
+
+inline namespace hashing { // inline
+	//* FNV-1a 32-bit, usable at compile time; `basis` continues from an earlier result
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline constexpr
+	uint32_t fnv1a_32(const char* data, size_t size, uint32_t basis = internal::fnv1a_32_basis) noexcept
+	{
+		for (size_t i = 0; i < size; ++i) {
+			basis = (basis ^ static_cast<uint8_t>(data[i])) * internal::fnv1a_32_prime;
+		}
+		return basis;
+	}
+	//* FNV-1a 64-bit, usable at compile time; `basis` continues from an earlier result
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline constexpr
+	uint64_t fnv1a_64(const char* data, size_t size, uint64_t basis = internal::fnv1a_64_basis) noexcept
+	{
+		for (size_t i = 0; i < size; ++i) {
+			basis = (basis ^ static_cast<uint8_t>(data[i])) * internal::fnv1a_64_prime;
+		}
+		return basis;
+	}
+	//* string literals, without the '\0'
+	template<size_t N> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
+	inline constexpr uint32_t fnv1a_32(const char (&literal)[N]) noexcept { return fnv1a_32(literal, N - 1); }
+	template<size_t N> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
+	inline constexpr uint64_t fnv1a_64(const char (&literal)[N]) noexcept { return fnv1a_64(literal, N - 1); }
+#ifdef CUTIL_CPP17_SUPPORTED
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline constexpr
+	uint32_t fnv1a_32(std::string_view str) noexcept { return fnv1a_32(str.data(), str.size()); }
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline constexpr
+	uint64_t fnv1a_64(std::string_view str) noexcept { return fnv1a_64(str.data(), str.size()); }
+#endif
+
+
+	/**
+	 * @brief 64-bit hash of `size` bytes, after wyhash. Different seeds give unrelated hashes,
+	 *        e.g. to rehash a table after too many collisions, or to keep two tables from sharing their weaknesses.
+	 */
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	uint64_t hash_bytes(const void* data, size_t size, uint64_t seed = 0) noexcept
+	{
+		const uint8_t* p = static_cast<const uint8_t*>(data);
+		seed = internal::wy_seed(seed);
+		size_t done = 0;
+		if (size > 48) {
+			uint64_t see1 = seed, see2 = seed;
+			done = internal::wy_blocks(p, size, seed, see1, see2);
+			seed ^= see1 ^ see2;
+		}
+		return internal::wy_finish(p + done, size - done, size, seed);
+	}
+	//* the bytes of the elements, for arrays of integers, chars, or other types without padding
+	template<typename T> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
+	inline uint64_t hash_bytes(cutil::span<T> elements, uint64_t seed = 0) noexcept
+	{
+		static_assert(std::is_trivially_copyable<typename std::remove_cv<T>::type>::value, "hash_bytes(): the elements must be trivially copyable");
+		return hash_bytes(elements.data(), elements.size_bytes(), seed);
+	}
+
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	uint64_t hash_string(const std::string& str, uint64_t seed = 0) noexcept { return hash_bytes(str.data(), str.size(), seed); }
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	uint64_t hash_string(const char* str, uint64_t seed = 0) noexcept { return hash_bytes(str, std::strlen(str), seed); }
+#ifdef CUTIL_CPP17_SUPPORTED
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	uint64_t hash_string(std::string_view str, uint64_t seed = 0) noexcept { return hash_bytes(str.data(), str.size(), seed); }
+#endif
+
+	//* combines two hashes (or a hash and an integer) into one, the order matters
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	uint64_t hash_combine(uint64_t seed, uint64_t value) noexcept
+	{
+		return internal::wy_mix(seed ^ internal::wy_secret[0], value ^ internal::wy_secret[1]);
+	}
+
+
+	/**
+	 * @brief `hash_bytes()` of data that arrives in chunks of any size: `digest()` is the hash of all chunks joined.
+	 *        Keeps at most 64 bytes, whole 48-byte blocks are hashed straight from the chunks.
+	 */
+	class hash_stream {
+	public:
+		explicit hash_stream(uint64_t seed = 0) noexcept { reset(seed); }
+
+		//* starts a new stream
+		void reset(uint64_t seed = 0) noexcept
+		{
+			seed_ = see1_ = see2_ = internal::wy_seed(seed);
+			total_ = 0;
+			pending_ = 0;
+		}
+
+		hash_stream& update(const void* data, size_t size) noexcept
+		{
+			const uint8_t* p = static_cast<const uint8_t*>(data);
+			total_ += size;
+			if (pending_ + size <= 48) { // a block is only hashed once more bytes follow it, the last one goes to `wy_finish()`
+				std::memcpy(buf_ + 16 + pending_, p, size);
+				pending_ += size;
+				return *this;
+			}
+			if (pending_ != 0) {
+				const size_t fill = 48 - pending_;
+				std::memcpy(buf_ + 16 + pending_, p, fill);
+				p += fill;
+				size -= fill;
+				internal::wy_blocks(buf_ + 16, 49, seed_, see1_, see2_); // exactly one block
+				std::memcpy(buf_, buf_ + 48, 16);
+				pending_ = 0;
+			}
+			if (size > 48) {
+				const size_t done = internal::wy_blocks(p, size, seed_, see1_, see2_);
+				p += done;
+				size -= done;
+				std::memcpy(buf_, p - 16, 16);
+			}
+			std::memcpy(buf_ + 16, p, size);
+			pending_ = size;
+			return *this;
+		}
+		hash_stream& update(const std::string& str) noexcept { return update(str.data(), str.size()); }
+	#ifdef CUTIL_CPP17_SUPPORTED
+		hash_stream& update(std::string_view str) noexcept { return update(str.data(), str.size()); }
+	#endif
+
+		//* hash of everything so far; more can be added afterwards
+		_CUTIL_NODISCARD uint64_t digest() const noexcept
+		{
+			const uint64_t seed = total_ > 48 ? seed_ ^ see1_ ^ see2_ : seed_;
+			return internal::wy_finish(buf_ + 16, pending_, total_, seed);
+		}
+
+		_CUTIL_NODISCARD uint64_t size() const noexcept { return total_; }
+
+	private:
+		uint64_t seed_, see1_, see2_;
+		uint64_t total_;
+		size_t pending_;
+		uint8_t buf_[64]; // the 16 bytes before the pending ones, then up to 48 pending bytes
+	};
+
+
+	/**
+	 * @brief `hash_string()` as a hash functor. Transparent: with `std::equal_to<>`, the C++20 `std::unordered_map<std::string, T>`
+	 *        looks up `std::string_view` and `const char*` keys without building a `std::string`.
+	 */
+	struct string_hash {
+		using is_transparent = void;
+
+	#ifdef CUTIL_CPP17_SUPPORTED
+		size_t operator()(std::string_view str) const noexcept { return static_cast<size_t>(hash_bytes(str.data(), str.size())); }
+	#endif
+		size_t operator()(const std::string& str) const noexcept { return static_cast<size_t>(hash_bytes(str.data(), str.size())); }
+		size_t operator()(const char* str) const noexcept { return static_cast<size_t>(hash_bytes(str, std::strlen(str))); }
+	};
+/*
+	constexpr uint64_t id = cutil::fnv1a_64("texture/grass.png");	// at compile time
+	static_assert(cutil::fnv1a_32("") == 0x811C9DC5);
+
+	uint64_t h = cutil::hash_string(name);						// same value on every standard library
+	uint64_t h2 = cutil::hash_bytes(buffer.data(), buffer.size(), 42);	// seeded
+	uint64_t h3 = cutil::hash_bytes(cutil::span<const int>(values));		// element bytes
+	uint64_t key = cutil::hash_combine(cutil::hash_string(section), cutil::hash_string(name));
+
+	cutil::hash_stream stream;									// chunks: same as hashing the whole file
+	while (read_chunk(chunk)) { stream.update(chunk.data(), chunk.size()); }
+	uint64_t file_hash = stream.digest();
+
+	std::unordered_map<std::string, int, cutil::string_hash, std::equal_to<>> map;
+	map.find(std::string_view("key"));							// C++20: no temporary std::string
+*/
+
+} // namespace hashing
+
+
+_CUTIL_NAMESPACE_END
+#endif /* CONSOLEUTIL_CPP_HASH_HPP__ */
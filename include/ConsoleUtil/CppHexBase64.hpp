@@ -0,0 +1,908 @@
+#ifndef CONSOLEUTIL_CPP_HEX_BASE64_HPP__
+#define CONSOLEUTIL_CPP_HEX_BASE64_HPP__
+/* UTF-8 encoding
+* Project URL: https://github.com/BH2WFR/ConsoleUtil
+  Author:		BH2WFR
+  Updated:		19 OCT 2026
+  License:		MIT License
+* You can include this header in header files.
+* C++14 or later is required.
+*
+* Binary buffers (e.g. from `cutil::read_memory()` / `cutil::memcpy_type()`) as text, and back:
+*   `cutil::str::hex_encode()` / `hex_decode()`       - two digits per byte, strict on decode.
+*   `cutil::str::base64_encode()` / `base64_decode()` - RFC 4648 standard or URL-safe alphabet, strict on decode.
+*   `cutil::str::base64_encoder` / `base64_decoder`   - the same over a stream of chunks.
+* The bulk runs 32 or 64 bytes at a time with AVX2, 16 or 32 with SSSE3 (both checked at runtime on x86-64),
+* or with NEON on AArch64; the scalar code does the rest, and finds the exact place of a decoding error.
+*/
+#include <ConsoleUtil/Base.h>
+#include <ConsoleUtil/CppBase.hpp>
+#include <ConsoleUtil/CppEncoding.hpp>
+
+#ifndef CUTIL_CPP14_SUPPORTED
+	#error ">= C++14 is required"
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+
+#ifdef _CUTIL_ENCODING_USE_SSSE3 // x86-64, from <ConsoleUtil/CppEncoding.hpp>
+	#ifdef CUTIL_COMPILER_MSVC
+		#define _CUTIL_TARGET_AVX2
+	#else
+		#define _CUTIL_TARGET_AVX2 __attribute__((target("avx2")))
+	#endif
+#elif defined(CUTIL_CPU_ARCH_ARM64) && defined(CUTIL_CPU_HAS_NEON)
+	#define _CUTIL_HEX_BASE64_USE_NEON
+	#include <arm_neon.h>
+#endif
+
+
+_CUTIL_NAMESPACE_BEGIN
+namespace str
+{
+	enum class base64_alphabet : uint8_t {
+		standard,	// A-Z a-z 0-9 + /
+		url_safe,	// A-Z a-z 0-9 - _
+	};
+
+	//* output size of `hex_encode()`
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline constexpr
+	size_t hex_encoded_size(size_t src_size) noexcept { return src_size * 2; }
+	//* output size of `base64_encode()`
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline constexpr
+	size_t base64_encoded_size(size_t src_size, bool pad = true) noexcept
+	{
+		return pad ? (src_size + 2) / 3 * 4 : src_size / 3 * 4 + (src_size % 3 == 0 ? 0 : src_size % 3 + 1);
+	}
+	//* output size that always fits `base64_decode()` of `src_size` chars
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline constexpr
+	size_t base64_decoded_max_size(size_t src_size) noexcept { return (src_size + 3) / 4 * 3; }
+
+
+	namespace internal{
+		static constexpr char hex_digits[2][17] = {"0123456789abcdef", "0123456789ABCDEF"};
+		static constexpr char base64_chars[2][65] = {
+			"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+			"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_",
+		};
+
+		//* value of each char: a hex digit, a char of either base64 alphabet, or 0xFF when it is not one
+		struct binary_text_tables {
+			uint8_t hex[256];
+			uint8_t base64[2][256];
+
+			constexpr binary_text_tables() : hex(), base64()
+			{
+				for (size_t c = 0; c < 256; ++c) {
+					hex[c] = 0xFF;
+					base64[0][c] = 0xFF;
+					base64[1][c] = 0xFF;
+				}
+				for (uint8_t v = 0; v < 16; ++v) {
+					hex[static_cast<uint8_t>(hex_digits[0][v])] = v;
+					hex[static_cast<uint8_t>(hex_digits[1][v])] = v;
+				}
+				for (uint8_t v = 0; v < 64; ++v) {
+					base64[0][static_cast<uint8_t>(base64_chars[0][v])] = v;
+					base64[1][static_cast<uint8_t>(base64_chars[1][v])] = v;
+				}
+			}
+		};
+		static constexpr binary_text_tables binary_text_table{};
+
+		//* the 62nd and 63rd chars, the only ones that differ between the alphabets
+		inline char base64_char_62(base64_alphabet alphabet) noexcept { return alphabet == base64_alphabet::standard ? '+' : '-'; }
+		inline char base64_char_63(base64_alphabet alphabet) noexcept { return alphabet == base64_alphabet::standard ? '/' : '_'; }
+
+
+		//*================ SIMD kernels: each does as much of the bulk as it can and returns how much it did ================
+	#ifdef _CUTIL_ENCODING_USE_SSSE3
+		inline bool cpu_has_avx2() noexcept
+		{
+			static const bool has = [] {
+			#ifdef CUTIL_COMPILER_MSVC
+				int info[4];
+				__cpuid(info, 1);
+				const bool os_saves_ymm = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+				__cpuidex(info, 7, 0);
+				return os_saves_ymm && (info[1] & (1 << 5)) != 0;
+			#else
+				return __builtin_cpu_supports("avx2") != 0;
+			#endif
+			}();
+			return has;
+		}
+
+		//* nibbles -> hex digits, 16 bytes -> 32 chars
+		_CUTIL_TARGET_SSSE3 inline size_t hex_encode_ssse3(const uint8_t* src, size_t n, char* dst, bool upper) noexcept
+		{
+			const __m128i digits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hex_digits[upper ? 1 : 0]));
+			const __m128i low4 = _mm_set1_epi8(0x0F);
+			size_t i = 0;
+			for (; i + 16 <= n; i += 16) {
+				const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+				const __m128i hi = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(x, 4), low4));
+				const __m128i lo = _mm_shuffle_epi8(digits, _mm_and_si128(x, low4));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * i), _mm_unpacklo_epi8(hi, lo));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+			}
+			return i;
+		}
+
+		_CUTIL_TARGET_AVX2 inline size_t hex_encode_avx2(const uint8_t* src, size_t n, char* dst, bool upper) noexcept
+		{
+			const __m256i digits = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hex_digits[upper ? 1 : 0])));
+			const __m256i low4 = _mm256_set1_epi8(0x0F);
+			size_t i = 0;
+			for (; i + 32 <= n; i += 32) {
+				const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+				const __m256i hi = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(x, 4), low4));
+				const __m256i lo = _mm256_shuffle_epi8(digits, _mm256_and_si256(x, low4));
+				const __m256i first = _mm256_unpacklo_epi8(hi, lo);	// bytes 0-7 | 16-23
+				const __m256i second = _mm256_unpackhi_epi8(hi, lo);	// bytes 8-15 | 24-31
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 2 * i), _mm256_permute2x128_si256(first, second, 0x20));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 2 * i + 32), _mm256_permute2x128_si256(first, second, 0x31));
+			}
+			return i;
+		}
+
+		//* hex digits -> nibbles, `ok` is 0xFF for the valid ones
+		_CUTIL_TARGET_SSSE3 inline __m128i hex_values_sse(__m128i c, __m128i& ok) noexcept
+		{
+			const __m128i digit = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+			const __m128i letter = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+			const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+			const __m128i is_letter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+			ok = _mm_or_si128(is_digit, is_letter);
+			return _mm_or_si128(_mm_and_si128(is_digit, digit), _mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+		}
+
+		//* 32 chars -> 16 bytes; stops before a block with an invalid char
+		_CUTIL_TARGET_SSSE3 inline size_t hex_decode_ssse3(const char* src, size_t n, uint8_t* dst) noexcept
+		{
+			const __m128i weights = _mm_set1_epi16(0x0110); // high nibble * 16 + low nibble
+			size_t i = 0;
+			for (; i + 32 <= n; i += 32) {
+				__m128i ok0, ok1;
+				const __m128i v0 = hex_values_sse(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), ok0);
+				const __m128i v1 = hex_values_sse(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 16)), ok1);
+				if (_mm_movemask_epi8(_mm_and_si128(ok0, ok1)) != 0xFFFF) {
+					break;
+				}
+				const __m128i bytes = _mm_packus_epi16(_mm_maddubs_epi16(v0, weights), _mm_maddubs_epi16(v1, weights));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i / 2), bytes);
+			}
+			return i;
+		}
+
+		_CUTIL_TARGET_AVX2 inline __m256i hex_values_avx2(__m256i c, __m256i& ok) noexcept
+		{
+			const __m256i digit = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+			const __m256i letter = _mm256_sub_epi8(_mm256_or_si256(c, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+			const __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+			const __m256i is_letter = _mm256_cmpeq_epi8(_mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+			ok = _mm256_or_si256(is_digit, is_letter);
+			return _mm256_or_si256(_mm256_and_si256(is_digit, digit), _mm256_and_si256(is_letter, _mm256_add_epi8(letter, _mm256_set1_epi8(10))));
+		}
+
+		_CUTIL_TARGET_AVX2 inline size_t hex_decode_avx2(const char* src, size_t n, uint8_t* dst) noexcept
+		{
+			const __m256i weights = _mm256_set1_epi16(0x0110);
+			size_t i = 0;
+			for (; i + 64 <= n; i += 64) {
+				__m256i ok0, ok1;
+				const __m256i v0 = hex_values_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), ok0);
+				const __m256i v1 = hex_values_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 32)), ok1);
+				if (_mm256_movemask_epi8(_mm256_and_si256(ok0, ok1)) != -1) {
+					break;
+				}
+				const __m256i bytes = _mm256_packus_epi16(_mm256_maddubs_epi16(v0, weights), _mm256_maddubs_epi16(v1, weights));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i / 2), _mm256_permute4x64_epi64(bytes, 0xD8)); // undo the per-lane packing
+			}
+			return i;
+		}
+
+		//* 6-bit indices -> chars: one pshufb of offsets, selected by the range each index is in (W. Muła)
+		_CUTIL_TARGET_SSSE3 inline __m128i base64_chars_sse(__m128i indices, __m128i offsets) noexcept
+		{
+			__m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));	// 0: 26-51, 1-10: digits, 11: 62, 12: 63
+			range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13))); // 13: A-Z
+			return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, range));
+		}
+		inline void base64_offsets(base64_alphabet alphabet, int8_t (&offsets)[16]) noexcept
+		{
+			const int8_t table[16] = {'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+				static_cast<int8_t>(base64_char_62(alphabet) - 62), static_cast<int8_t>(base64_char_63(alphabet) - 63), 'A', 0, 0};
+			std::memcpy(offsets, table, sizeof(table));
+		}
+
+		//* 12 bytes -> 16 chars, reading 16 bytes each step
+		_CUTIL_TARGET_SSSE3 inline size_t base64_encode_ssse3(const uint8_t* src, size_t n, char* dst, base64_alphabet alphabet) noexcept
+		{
+			int8_t table[16];
+			base64_offsets(alphabet, table);
+			const __m128i offsets = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table));
+			const __m128i spread = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+			size_t i = 0;
+			for (; i + 16 <= n; i += 12) {
+				const __m128i in = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), spread);
+				const __m128i ac = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+				const __m128i bd = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i / 3 * 4), base64_chars_sse(_mm_or_si128(ac, bd), offsets));
+			}
+			return i;
+		}
+
+		_CUTIL_TARGET_AVX2 inline __m256i base64_chars_avx2(__m256i indices, __m256i offsets) noexcept
+		{
+			__m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+			range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+			return _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, range));
+		}
+
+		//* 24 bytes -> 32 chars, 12 per lane, reading 28 bytes each step
+		_CUTIL_TARGET_AVX2 inline size_t base64_encode_avx2(const uint8_t* src, size_t n, char* dst, base64_alphabet alphabet) noexcept
+		{
+			int8_t table[16];
+			base64_offsets(alphabet, table);
+			const __m256i offsets = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+			const __m256i spread = _mm256_broadcastsi128_si256(_mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+			size_t i = 0;
+			for (; i + 28 <= n; i += 24) {
+				const __m256i raw = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))),
+					_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 12)), 1);
+				const __m256i in = _mm256_shuffle_epi8(raw, spread);
+				const __m256i ac = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+				const __m256i bd = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i / 3 * 4), base64_chars_avx2(_mm256_or_si256(ac, bd), offsets));
+			}
+			return i;
+		}
+
+		//* chars -> 6-bit values by range checks, so one kernel serves both alphabets; `ok` is 0xFF for the valid ones
+		_CUTIL_TARGET_SSSE3 inline __m128i base64_values_sse(__m128i c, __m128i c62, __m128i c63, __m128i& ok) noexcept
+		{
+			const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('Z' + 1)));
+			const __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('z' + 1)));
+			const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+			const __m128i is62 = _mm_cmpeq_epi8(c, c62);
+			const __m128i is63 = _mm_cmpeq_epi8(c, c63);
+			ok = _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, _mm_or_si128(is62, is63)));
+			const __m128i shift = _mm_or_si128(_mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')), _mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))),
+				_mm_or_si128(_mm_and_si128(digit, _mm_set1_epi8(52 - '0')),
+					_mm_or_si128(_mm_and_si128(is62, _mm_sub_epi8(_mm_set1_epi8(62), c62)), _mm_and_si128(is63, _mm_sub_epi8(_mm_set1_epi8(63), c63)))));
+			return _mm_add_epi8(c, shift);
+		}
+
+		//* 16 chars -> 12 bytes, writing 16 bytes each step; stops before a block with a char outside the alphabet ('=' included)
+		_CUTIL_TARGET_SSSE3 inline size_t base64_decode_ssse3(const char* src, size_t n, uint8_t* dst, size_t dst_size, base64_alphabet alphabet) noexcept
+		{
+			const __m128i c62 = _mm_set1_epi8(base64_char_62(alphabet));
+			const __m128i c63 = _mm_set1_epi8(base64_char_63(alphabet));
+			const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+			size_t i = 0;
+			for (; i + 16 <= n && i / 4 * 3 + 16 <= dst_size; i += 16) {
+				__m128i ok;
+				const __m128i values = base64_values_sse(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), c62, c63, ok);
+				if (_mm_movemask_epi8(ok) != 0xFFFF) {
+					break;
+				}
+				// 4 x 6 bits -> 24 bits per dword, then the 3 bytes of each, big end first
+				const __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+				const __m128i words = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i / 4 * 3), _mm_shuffle_epi8(words, pack));
+			}
+			return i;
+		}
+
+		_CUTIL_TARGET_AVX2 inline __m256i base64_values_avx2(__m256i c, __m256i c62, __m256i c63, __m256i& ok) noexcept
+		{
+			const __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), c));
+			const __m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), c));
+			const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), c));
+			const __m256i is62 = _mm256_cmpeq_epi8(c, c62);
+			const __m256i is63 = _mm256_cmpeq_epi8(c, c63);
+			ok = _mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, _mm256_or_si256(is62, is63)));
+			const __m256i shift = _mm256_or_si256(_mm256_or_si256(_mm256_and_si256(upper, _mm256_set1_epi8(-'A')), _mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a'))),
+				_mm256_or_si256(_mm256_and_si256(digit, _mm256_set1_epi8(52 - '0')),
+					_mm256_or_si256(_mm256_and_si256(is62, _mm256_sub_epi8(_mm256_set1_epi8(62), c62)), _mm256_and_si256(is63, _mm256_sub_epi8(_mm256_set1_epi8(63), c63)))));
+			return _mm256_add_epi8(c, shift);
+		}
+
+		//* 32 chars -> 24 bytes, writing 32 bytes each step
+		_CUTIL_TARGET_AVX2 inline size_t base64_decode_avx2(const char* src, size_t n, uint8_t* dst, size_t dst_size, base64_alphabet alphabet) noexcept
+		{
+			const __m256i c62 = _mm256_set1_epi8(base64_char_62(alphabet));
+			const __m256i c63 = _mm256_set1_epi8(base64_char_63(alphabet));
+			const __m256i pack = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+												  2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+			const __m256i join = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7); // the 12 bytes of each lane, next to each other
+			size_t i = 0;
+			for (; i + 32 <= n && i / 4 * 3 + 32 <= dst_size; i += 32) {
+				__m256i ok;
+				const __m256i values = base64_values_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i)), c62, c63, ok);
+				if (_mm256_movemask_epi8(ok) != -1) {
+					break;
+				}
+				const __m256i pairs = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+				const __m256i words = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i / 4 * 3), _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(words, pack), join));
+			}
+			return i;
+		}
+	#endif // _CUTIL_ENCODING_USE_SSSE3
+
+	#ifdef _CUTIL_HEX_BASE64_USE_NEON
+		inline size_t hex_encode_neon(const uint8_t* src, size_t n, char* dst, bool upper) noexcept
+		{
+			const uint8x16_t digits = vld1q_u8(reinterpret_cast<const uint8_t*>(hex_digits[upper ? 1 : 0]));
+			size_t i = 0;
+			for (; i + 16 <= n; i += 16) {
+				const uint8x16_t x = vld1q_u8(src + i);
+				uint8x16x2_t out;
+				out.val[0] = vqtbl1q_u8(digits, vshrq_n_u8(x, 4));
+				out.val[1] = vqtbl1q_u8(digits, vandq_u8(x, vdupq_n_u8(0x0F)));
+				vst2q_u8(reinterpret_cast<uint8_t*>(dst + 2 * i), out); // interleaved: high, low, high, low, ...
+			}
+			return i;
+		}
+
+		inline uint8x16_t hex_values_neon(uint8x16_t c, uint8x16_t& ok) noexcept
+		{
+			const uint8x16_t digit = vsubq_u8(c, vdupq_n_u8('0'));
+			const uint8x16_t letter = vsubq_u8(vorrq_u8(c, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+			const uint8x16_t is_digit = vcltq_u8(digit, vdupq_n_u8(10));
+			const uint8x16_t is_letter = vcltq_u8(letter, vdupq_n_u8(6));
+			ok = vorrq_u8(is_digit, is_letter);
+			return vbslq_u8(is_digit, digit, vaddq_u8(letter, vdupq_n_u8(10)));
+		}
+
+		inline size_t hex_decode_neon(const char* src, size_t n, uint8_t* dst) noexcept
+		{
+			size_t i = 0;
+			for (; i + 32 <= n; i += 32) {
+				const uint8x16x2_t c = vld2q_u8(reinterpret_cast<const uint8_t*>(src + i)); // even chars, odd chars
+				uint8x16_t ok_hi, ok_lo;
+				const uint8x16_t hi = hex_values_neon(c.val[0], ok_hi);
+				const uint8x16_t lo = hex_values_neon(c.val[1], ok_lo);
+				if (vminvq_u8(vandq_u8(ok_hi, ok_lo)) != 0xFF) {
+					break;
+				}
+				vst1q_u8(dst + i / 2, vorrq_u8(vshlq_n_u8(hi, 4), lo));
+			}
+			return i;
+		}
+
+		//* 48 bytes -> 64 chars: three byte lanes become four index lanes, then one 64-entry table lookup
+		inline size_t base64_encode_neon(const uint8_t* src, size_t n, char* dst, base64_alphabet alphabet) noexcept
+		{
+			const char* chars = base64_chars[alphabet == base64_alphabet::standard ? 0 : 1];
+			uint8x16x4_t table;
+			for (int k = 0; k < 4; ++k) {
+				table.val[k] = vld1q_u8(reinterpret_cast<const uint8_t*>(chars + 16 * k));
+			}
+			const uint8x16_t low6 = vdupq_n_u8(0x3F);
+			size_t i = 0;
+			for (; i + 48 <= n; i += 48) {
+				const uint8x16x3_t in = vld3q_u8(src + i);
+				uint8x16x4_t out;
+				out.val[0] = vshrq_n_u8(in.val[0], 2);
+				out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), low6);
+				out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), low6);
+				out.val[3] = vandq_u8(in.val[2], low6);
+				for (int k = 0; k < 4; ++k) {
+					out.val[k] = vqtbl4q_u8(table, out.val[k]);
+				}
+				vst4q_u8(reinterpret_cast<uint8_t*>(dst + i / 3 * 4), out);
+			}
+			return i;
+		}
+
+		inline uint8x16_t base64_values_neon(uint8x16_t c, uint8x16_t c62, uint8x16_t c63, uint8x16_t& ok) noexcept
+		{
+			const uint8x16_t upper = vcltq_u8(vsubq_u8(c, vdupq_n_u8('A')), vdupq_n_u8(26));
+			const uint8x16_t lower = vcltq_u8(vsubq_u8(c, vdupq_n_u8('a')), vdupq_n_u8(26));
+			const uint8x16_t digit = vcltq_u8(vsubq_u8(c, vdupq_n_u8('0')), vdupq_n_u8(10));
+			const uint8x16_t is62 = vceqq_u8(c, c62);
+			const uint8x16_t is63 = vceqq_u8(c, c63);
+			ok = vorrq_u8(vorrq_u8(upper, lower), vorrq_u8(digit, vorrq_u8(is62, is63)));
+			uint8x16_t v = vandq_u8(is63, vdupq_n_u8(63));
+			v = vbslq_u8(is62, vdupq_n_u8(62), v);
+			v = vbslq_u8(digit, vaddq_u8(c, vdupq_n_u8(52 - '0')), v);
+			v = vbslq_u8(lower, vsubq_u8(c, vdupq_n_u8('a' - 26)), v);
+			return vbslq_u8(upper, vsubq_u8(c, vdupq_n_u8('A')), v);
+		}
+
+		//* 64 chars -> 48 bytes
+		inline size_t base64_decode_neon(const char* src, size_t n, uint8_t* dst, size_t dst_size, base64_alphabet alphabet) noexcept
+		{
+			const uint8x16_t c62 = vdupq_n_u8(static_cast<uint8_t>(base64_char_62(alphabet)));
+			const uint8x16_t c63 = vdupq_n_u8(static_cast<uint8_t>(base64_char_63(alphabet)));
+			size_t i = 0;
+			for (; i + 64 <= n && i / 4 * 3 + 48 <= dst_size; i += 64) {
+				const uint8x16x4_t c = vld4q_u8(reinterpret_cast<const uint8_t*>(src + i));
+				uint8x16_t ok[4];
+				uint8x16_t v[4];
+				for (int k = 0; k < 4; ++k) {
+					v[k] = base64_values_neon(c.val[k], c62, c63, ok[k]);
+				}
+				if (vminvq_u8(vandq_u8(vandq_u8(ok[0], ok[1]), vandq_u8(ok[2], ok[3]))) != 0xFF) {
+					break;
+				}
+				uint8x16x3_t out;
+				out.val[0] = vorrq_u8(vshlq_n_u8(v[0], 2), vshrq_n_u8(v[1], 4));
+				out.val[1] = vorrq_u8(vshlq_n_u8(v[1], 4), vshrq_n_u8(v[2], 2));
+				out.val[2] = vorrq_u8(vshlq_n_u8(v[2], 6), v[3]);
+				vst3q_u8(dst + i / 4 * 3, out);
+			}
+			return i;
+		}
+	#endif // _CUTIL_HEX_BASE64_USE_NEON
+
+
+		//*================ dispatch, then the scalar rest ================
+		inline void hex_encode(const uint8_t* src, size_t n, char* dst, bool upper) noexcept
+		{
+			size_t i = 0;
+		#ifdef _CUTIL_ENCODING_USE_SSSE3
+			if (cpu_has_avx2()) {
+				i = hex_encode_avx2(src, n, dst, upper);
+			} else if (cpu_has_ssse3()) {
+				i = hex_encode_ssse3(src, n, dst, upper);
+			}
+		#elif defined(_CUTIL_HEX_BASE64_USE_NEON)
+			i = hex_encode_neon(src, n, dst, upper);
+		#endif
+			const char* digits = hex_digits[upper ? 1 : 0];
+			for (; i < n; ++i) {
+				dst[2 * i] = digits[src[i] >> 4];
+				dst[2 * i + 1] = digits[src[i] & 0x0F];
+			}
+		}
+
+		//* decodes pairs of digits, returns the number of chars decoded: `n`, or the start of the first invalid pair
+		inline size_t hex_decode(const char* src, size_t n, uint8_t* dst) noexcept
+		{
+			size_t i = 0;
+		#ifdef _CUTIL_ENCODING_USE_SSSE3
+			if (cpu_has_avx2()) {
+				i = hex_decode_avx2(src, n, dst);
+			} else if (cpu_has_ssse3()) {
+				i = hex_decode_ssse3(src, n, dst);
+			}
+		#elif defined(_CUTIL_HEX_BASE64_USE_NEON)
+			i = hex_decode_neon(src, n, dst);
+		#endif
+			for (; i + 2 <= n; i += 2) {
+				const uint8_t hi = binary_text_table.hex[static_cast<uint8_t>(src[i])];
+				const uint8_t lo = binary_text_table.hex[static_cast<uint8_t>(src[i + 1])];
+				if ((hi | lo) > 15) {
+					break;
+				}
+				dst[i / 2] = static_cast<uint8_t>((hi << 4) | lo);
+			}
+			return i;
+		}
+
+		inline void base64_encode_group(const uint8_t* src, char* dst, const char* chars) noexcept
+		{
+			const uint32_t v = (static_cast<uint32_t>(src[0]) << 16) | (static_cast<uint32_t>(src[1]) << 8) | src[2];
+			dst[0] = chars[v >> 18];
+			dst[1] = chars[(v >> 12) & 0x3F];
+			dst[2] = chars[(v >> 6) & 0x3F];
+			dst[3] = chars[v & 0x3F];
+		}
+
+		//* whole 3-byte groups of `src`, returns the number of bytes encoded
+		inline size_t base64_encode_groups(const uint8_t* src, size_t n, char* dst, base64_alphabet alphabet) noexcept
+		{
+			size_t i = 0;
+		#ifdef _CUTIL_ENCODING_USE_SSSE3
+			if (cpu_has_avx2()) {
+				i = base64_encode_avx2(src, n, dst, alphabet);
+			} else if (cpu_has_ssse3()) {
+				i = base64_encode_ssse3(src, n, dst, alphabet);
+			}
+		#elif defined(_CUTIL_HEX_BASE64_USE_NEON)
+			i = base64_encode_neon(src, n, dst, alphabet);
+		#endif
+			const char* chars = base64_chars[alphabet == base64_alphabet::standard ? 0 : 1];
+			for (; i + 3 <= n; i += 3) {
+				base64_encode_group(src + i, dst + i / 3 * 4, chars);
+			}
+			return i;
+		}
+
+		//* the last 1 or 2 bytes, returns the number of chars written
+		inline size_t base64_encode_tail(const uint8_t* src, size_t n, char* dst, base64_alphabet alphabet, bool pad) noexcept
+		{
+			if (n == 0) {
+				return 0;
+			}
+			uint8_t group[3] = {src[0], n > 1 ? src[1] : uint8_t(0), 0};
+			char chars[4];
+			base64_encode_group(group, chars, base64_chars[alphabet == base64_alphabet::standard ? 0 : 1]);
+			const size_t used = n + 1;
+			std::memcpy(dst, chars, used);
+			if (!pad) {
+				return used;
+			}
+			std::memset(dst + used, '=', 4 - used);
+			return 4;
+		}
+
+		//* whole 4-char groups without padding, as long as the output fits;
+		//  returns the number of chars decoded: `n`, the start of the first group with a char outside the alphabet, or where `dst` is full
+		inline size_t base64_decode_groups(const char* src, size_t n, uint8_t* dst, size_t dst_size, base64_alphabet alphabet) noexcept
+		{
+			size_t i = 0;
+		#ifdef _CUTIL_ENCODING_USE_SSSE3
+			if (cpu_has_avx2()) {
+				i = base64_decode_avx2(src, n, dst, dst_size, alphabet);
+			} else if (cpu_has_ssse3()) {
+				i = base64_decode_ssse3(src, n, dst, dst_size, alphabet);
+			}
+		#elif defined(_CUTIL_HEX_BASE64_USE_NEON)
+			i = base64_decode_neon(src, n, dst, dst_size, alphabet);
+		#endif
+			const uint8_t* values = binary_text_table.base64[alphabet == base64_alphabet::standard ? 0 : 1];
+			for (; i + 4 <= n && i / 4 * 3 + 3 <= dst_size; i += 4) {
+				const uint8_t a = values[static_cast<uint8_t>(src[i])];
+				const uint8_t b = values[static_cast<uint8_t>(src[i + 1])];
+				const uint8_t c = values[static_cast<uint8_t>(src[i + 2])];
+				const uint8_t d = values[static_cast<uint8_t>(src[i + 3])];
+				if ((a | b | c | d) & 0x80) {
+					break;
+				}
+				const uint32_t v = (static_cast<uint32_t>(a) << 18) | (static_cast<uint32_t>(b) << 12) | (static_cast<uint32_t>(c) << 6) | d;
+				uint8_t* out = dst + i / 4 * 3;
+				out[0] = static_cast<uint8_t>(v >> 16);
+				out[1] = static_cast<uint8_t>(v >> 8);
+				out[2] = static_cast<uint8_t>(v);
+			}
+			return i;
+		}
+
+		//* the final group of 2 - 4 chars, where '=' may pad it to 4; the unused low bits have to be zero.
+		//  returns the number of bytes written, or -1 if the group is malformed
+		inline int base64_decode_final(const char* src, size_t n, uint8_t* dst, base64_alphabet alphabet) noexcept
+		{
+			size_t chars = n;
+			if (n == 4) {
+				chars -= src[3] == '=' ? (src[2] == '=' ? 2 : 1) : 0;
+			}
+			if (chars < 2 || (chars < n && n != 4)) {
+				return -1;
+			}
+			const uint8_t* values = binary_text_table.base64[alphabet == base64_alphabet::standard ? 0 : 1];
+			uint32_t v = 0;
+			for (size_t k = 0; k < chars; ++k) {
+				const uint8_t value = values[static_cast<uint8_t>(src[k])];
+				if (value & 0x80) {
+					return -1;
+				}
+				v |= static_cast<uint32_t>(value) << (18 - 6 * k);
+			}
+			const int bytes = static_cast<int>(chars) - 1;
+			if ((v & (0xFFFFFFu >> (8 * bytes))) != 0) { // non-canonical: bits past the last byte
+				return -1;
+			}
+			for (int k = 0; k < bytes; ++k) {
+				dst[k] = static_cast<uint8_t>(v >> (16 - 8 * k));
+			}
+			return bytes;
+		}
+	}
+
+
+	/**
+	 * @brief Writes two hex digits per byte into a caller buffer of `hex_encoded_size(size)` chars, no '\0' is appended.
+	 * @return number of chars written.
+	 */
+	_CUTIL_FUNC_STATIC inline
+	size_t hex_encode(const void* data, size_t size, char* dst, bool uppercase = false) noexcept
+	{
+		internal::hex_encode(static_cast<const uint8_t*>(data), size, dst, uppercase);
+		return hex_encoded_size(size);
+	}
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	std::string to_hex(const void* data, size_t size, bool uppercase = false)
+	{
+		std::string result(hex_encoded_size(size), '\0');
+		internal::hex_encode(static_cast<const uint8_t*>(data), size, &result[0], uppercase);
+		return result;
+	}
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	std::string to_hex(const std::string& bytes, bool uppercase = false)
+	{
+		return to_hex(bytes.data(), bytes.size(), uppercase);
+	}
+
+	/**
+	 * @brief Decodes pairs of hex digits (either case) into a caller buffer, strictly: no blanks, prefixes or separators.
+	 * @return bytes read and written, and why it stopped:
+	 *         `illegal_byte_sequence` at the first pair that is not two hex digits, or at a single digit left at the end
+	 *         (keep it for the next chunk when decoding a stream), `value_too_large` when `dst` is full.
+	 */
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	transcode_result hex_decode(const char* src, size_t src_size, void* dst, size_t dst_size) noexcept
+	{
+		const size_t fit = std::min(src_size / 2, dst_size) * 2;
+		const size_t read = internal::hex_decode(src, fit, static_cast<uint8_t*>(dst));
+		if (read < fit || (read == src_size / 2 * 2 && read < src_size)) {
+			return {read, read / 2, std::errc::illegal_byte_sequence};
+		}
+		return {read, read / 2, read < src_size ? std::errc::value_too_large : std::errc()};
+	}
+	//* whole `hex` into `bytes`, false if it is not valid hex (`bytes` is then unspecified)
+	_CUTIL_FUNC_STATIC inline
+	bool from_hex(const std::string& hex, std::string& bytes)
+	{
+		bytes.resize(hex.size() / 2);
+		return hex_decode(hex.data(), hex.size(), &bytes[0], bytes.size()).ok();
+	}
+/*
+	uint32_t value = 0x12345678;
+	cutil::str::to_hex(&value, sizeof(value));				// -> "78563412" on little-endian CPUs
+	char line[64];
+	size_t n = cutil::str::hex_encode(buffer, 16, line, true); // uppercase, into a caller buffer
+	std::string bytes;
+	cutil::str::from_hex("DEADbeef", bytes);				// -> true, "\xDE\xAD\xBE\xEF"
+*/
+
+
+	/**
+	 * @brief Encodes `size` bytes as base64 into a caller buffer of `base64_encoded_size(size, pad)` chars, no '\0' is appended.
+	 * @param pad - complete the last group with '=', usually left out with the URL-safe alphabet.
+	 * @return number of chars written.
+	 */
+	_CUTIL_FUNC_STATIC inline
+	size_t base64_encode(const void* data, size_t size, char* dst, base64_alphabet alphabet = base64_alphabet::standard, bool pad = true) noexcept
+	{
+		const uint8_t* src = static_cast<const uint8_t*>(data);
+		const size_t done = internal::base64_encode_groups(src, size, dst, alphabet);
+		return done / 3 * 4 + internal::base64_encode_tail(src + done, size - done, dst + done / 3 * 4, alphabet, pad);
+	}
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	std::string to_base64(const void* data, size_t size, base64_alphabet alphabet = base64_alphabet::standard, bool pad = true)
+	{
+		std::string result(base64_encoded_size(size, pad), '\0');
+		base64_encode(data, size, &result[0], alphabet, pad);
+		return result;
+	}
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	std::string to_base64(const std::string& bytes, base64_alphabet alphabet = base64_alphabet::standard, bool pad = true)
+	{
+		return to_base64(bytes.data(), bytes.size(), alphabet, pad);
+	}
+
+	/**
+	 * @brief Decodes base64 into a caller buffer of `base64_decoded_max_size(src_size)` bytes, strictly:
+	 *        only chars of `alphabet`, no blanks or line breaks, '=' only to pad the last group to 4 chars (padding is optional),
+	 *        and the unused bits of the last group must be zero, so every byte sequence has one accepted text.
+	 * @return bytes read and written, and why it stopped: `illegal_byte_sequence` at the start of a malformed group,
+	 *         `value_too_large` when `dst` is full.
+	 */
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	transcode_result base64_decode(const char* src, size_t src_size, void* dst, size_t dst_size
+								 , base64_alphabet alphabet = base64_alphabet::standard) noexcept
+	{
+		uint8_t* out = static_cast<uint8_t*>(dst);
+		const size_t tail = src_size % 4 != 0 ? src_size % 4 : (src_size != 0 && src[src_size - 1] == '=' ? 4 : 0);
+		const size_t body = src_size - tail;
+		const size_t read = internal::base64_decode_groups(src, body, out, dst_size, alphabet);
+		const size_t written = read / 4 * 3;
+		if (read < body) {
+			uint8_t group[3];
+			const bool full = written + 3 > dst_size && internal::base64_decode_groups(src + read, 4, group, 3, alphabet) == 4;
+			return {read, written, full ? std::errc::value_too_large : std::errc::illegal_byte_sequence};
+		}
+		if (tail == 0) {
+			return {read, written, std::errc()};
+		}
+		uint8_t last[3];
+		const int bytes = internal::base64_decode_final(src + read, tail, last, alphabet);
+		if (bytes < 0) {
+			return {read, written, std::errc::illegal_byte_sequence};
+		}
+		if (written + static_cast<size_t>(bytes) > dst_size) {
+			return {read, written, std::errc::value_too_large};
+		}
+		std::memcpy(out + written, last, static_cast<size_t>(bytes));
+		return {src_size, written + static_cast<size_t>(bytes), std::errc()};
+	}
+	//* whole `text` into `bytes`, false if it is not valid base64 (`bytes` is then unspecified)
+	_CUTIL_FUNC_STATIC inline
+	bool from_base64(const std::string& text, std::string& bytes, base64_alphabet alphabet = base64_alphabet::standard)
+	{
+		bytes.resize(base64_decoded_max_size(text.size()));
+		const transcode_result res = base64_decode(text.data(), text.size(), &bytes[0], bytes.size(), alphabet);
+		bytes.resize(res.written);
+		return res.ok();
+	}
+
+
+	/**
+	 * @brief Base64 over a stream of chunks: keeps the 1 or 2 bytes that do not fill a group until the next chunk.
+	 */
+	class base64_encoder {
+	public:
+		explicit base64_encoder(base64_alphabet alphabet = base64_alphabet::standard, bool pad = true) noexcept
+			: alphabet_(alphabet), pad_(pad) {}
+
+		//* output size that always fits `update()` of `size` bytes
+		_CUTIL_NODISCARD static constexpr size_t max_output_size(size_t size) noexcept { return (size + 2) / 3 * 4; }
+
+		//* encodes the whole groups of the kept bytes and `data`, returns the number of chars written to `dst`
+		size_t update(const void* data, size_t size, char* dst) noexcept
+		{
+			const uint8_t* src = static_cast<const uint8_t*>(data);
+			size_t written = 0;
+			if (kept_ != 0) {
+				while (kept_ < 3 && size != 0) {
+					keep_[kept_++] = *src++;
+					--size;
+				}
+				if (kept_ < 3) {
+					return 0;
+				}
+				internal::base64_encode_groups(keep_, 3, dst, alphabet_);
+				written = 4;
+				kept_ = 0;
+			}
+			const size_t done = internal::base64_encode_groups(src, size, dst + written, alphabet_);
+			for (size_t i = done; i < size; ++i) {
+				keep_[kept_++] = src[i];
+			}
+			return written + done / 3 * 4;
+		}
+
+		//* the kept bytes as the last group (up to 4 chars), then the encoder is ready for a new stream
+		size_t finish(char* dst) noexcept
+		{
+			const size_t written = internal::base64_encode_tail(keep_, kept_, dst, alphabet_, pad_);
+			kept_ = 0;
+			return written;
+		}
+
+	private:
+		base64_alphabet alphabet_;
+		bool pad_;
+		uint8_t keep_[3] = {};
+		size_t kept_ = 0;
+	};
+
+	/**
+	 * @brief Strict base64 decoding (see `base64_decode()`) over a stream of chunks cut anywhere:
+	 *        keeps an incomplete group until the next chunk; a padded group ends the stream.
+	 */
+	class base64_decoder {
+	public:
+		explicit base64_decoder(base64_alphabet alphabet = base64_alphabet::standard) noexcept : alphabet_(alphabet) {}
+
+		//* output size that always fits `update()` of `size` chars
+		_CUTIL_NODISCARD static constexpr size_t max_output_size(size_t size) noexcept { return (size + 3) / 4 * 3; }
+
+		/**
+		 * @return chars of `src` read and bytes written, `illegal_byte_sequence` at a malformed group (or data after padding),
+		 *         `value_too_large` when `dst` is full: call again with the rest.
+		 */
+		transcode_result update(const char* src, size_t size, void* dst, size_t dst_size) noexcept
+		{
+			uint8_t* out = static_cast<uint8_t*>(dst);
+			size_t read = 0;
+			size_t written = 0;
+			if (kept_ == 4) { // the group that did not fit last time
+				const transcode_result res = decode_group(keep_, out, dst_size);
+				if (!res.ok()) {
+					return {0, 0, res.ec};
+				}
+				written = res.written;
+				kept_ = 0;
+			}
+			while (read < size) {
+				if (ended_) {
+					return {read, written, std::errc::illegal_byte_sequence};
+				}
+				if (kept_ != 0 || size - read < 4) { // assemble one group from the kept chars and the new ones
+					while (kept_ < 4 && read < size) {
+						keep_[kept_++] = src[read++];
+					}
+					if (kept_ < 4) {
+						break;
+					}
+					const transcode_result res = decode_group(keep_, out + written, dst_size - written);
+					if (!res.ok()) {
+						return {read, written, res.ec}; // the group stays kept, it began in an earlier chunk
+					}
+					written += res.written;
+					kept_ = 0;
+					continue;
+				}
+				const size_t body = (size - read) / 4 * 4;
+				const size_t done = internal::base64_decode_groups(src + read, body, out + written, dst_size - written, alphabet_);
+				read += done;
+				written += done / 4 * 3;
+				if (done < body) { // '=', a bad char, or `dst` is full: the group goes through `decode_group()`
+					const transcode_result res = decode_group(src + read, out + written, dst_size - written);
+					if (!res.ok()) {
+						return {read, written, res.ec};
+					}
+					read += 4;
+					written += res.written;
+				}
+			}
+			return {read, written, std::errc()};
+		}
+
+		//* the kept chars as an unpadded last group; then the decoder is ready for a new stream
+		transcode_result finish(void* dst, size_t dst_size) noexcept
+		{
+			transcode_result res{0, 0, std::errc()};
+			if (kept_ != 0) {
+				uint8_t last[3];
+				const int bytes = internal::base64_decode_final(reinterpret_cast<const char*>(keep_), kept_, last, alphabet_);
+				if (bytes < 0) {
+					res.ec = std::errc::illegal_byte_sequence;
+				} else if (static_cast<size_t>(bytes) > dst_size) {
+					res.ec = std::errc::value_too_large;
+				} else {
+					std::memcpy(dst, last, static_cast<size_t>(bytes));
+					res.written = static_cast<size_t>(bytes);
+				}
+			}
+			if (res.ec != std::errc::value_too_large) {
+				kept_ = 0;
+				ended_ = false;
+			}
+			return res;
+		}
+
+	private:
+		//* one complete 4-char group, padded or not
+		transcode_result decode_group(const char* group, uint8_t* dst, size_t dst_size) noexcept
+		{
+			uint8_t bytes[3];
+			const bool padded = group[3] == '=';
+			const int n = padded ? internal::base64_decode_final(group, 4, bytes, alphabet_)
+								 : (internal::base64_decode_groups(group, 4, bytes, 3, alphabet_) == 4 ? 3 : -1);
+			if (n < 0) {
+				return {0, 0, std::errc::illegal_byte_sequence};
+			}
+			if (static_cast<size_t>(n) > dst_size) {
+				return {0, 0, std::errc::value_too_large};
+			}
+			std::memcpy(dst, bytes, static_cast<size_t>(n));
+			ended_ = padded;
+			return {4, static_cast<size_t>(n), std::errc()};
+		}
+		transcode_result decode_group(const uint8_t* group, uint8_t* dst, size_t dst_size) noexcept
+		{
+			return decode_group(reinterpret_cast<const char*>(group), dst, dst_size);
+		}
+
+		base64_alphabet alphabet_;
+		uint8_t keep_[4] = {};
+		size_t kept_ = 0;
+		bool ended_ = false;
+	};
+/*
+	std::string text = cutil::str::to_base64(packet.data(), packet.size());		// "SGVsbG8=" style
+	std::string token = cutil::str::to_base64(id, cutil::str::base64_alphabet::url_safe, false); // no '+', '/' or '='
+	std::string bytes;
+	if (!cutil::str::from_base64(text, bytes)) { ... }						// strict: rejects blanks, bad padding
+
+	cutil::str::base64_encoder enc;										// streaming, chunks of any size
+	out.resize(cutil::str::base64_encoder::max_output_size(chunk.size()));
+	out.resize(enc.update(chunk.data(), chunk.size(), &out[0]));
+	...
+	char last[4];
+	size_t n = enc.finish(last);
+*/
+
+} // namespace str
+_CUTIL_NAMESPACE_END
+#endif /* CONSOLEUTIL_CPP_HEX_BASE64_HPP__ */
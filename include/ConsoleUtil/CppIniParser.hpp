@@ -0,0 +1,259 @@
+#ifndef CONSOLEUTIL_CPP_INI_PARSER_HPP__
+#define CONSOLEUTIL_CPP_INI_PARSER_HPP__
+/* UTF-8 encoding
+* Project URL: https://github.com/BH2WFR/ConsoleUtil
+  Author:		BH2WFR
+  Updated:		19 OCT 2026
+  License:		MIT License
+* You can include this header in header files.
+* C++17 or later is required.
+*
+* `[section] key = value` configs in one linear pass, without regex and without a copy per token:
+*   `cutil::str::ini_tokenizer` - yields (section, key, value) as `std::string_view`s into the text.
+*   `cutil::str::ini_config`    - owns the text, keeps the entries in a flat vector sorted by (section, key) for lookup.
+*/
+#include <ConsoleUtil/Base.h>
+#include <ConsoleUtil/CppBase.hpp>
+#include <ConsoleUtil/External/Span.hpp>
+
+#ifndef CUTIL_CPP17_SUPPORTED
+	#error ">= C++17 is required"
+#endif
+
+#include <cstring>
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+
+_CUTIL_NAMESPACE_BEGIN
+namespace str
+{
+	struct ini_entry {
+		std::string_view section;	// "" before the first `[section]`
+		std::string_view key;
+		std::string_view value;		// "" for a key without '='
+	};
+
+	/**
+	 * @brief Splits config text into entries, `std::string_view`s into the text:
+	 *        `[name]` starts a section; an entry `key = value` ends at a line break or at `separator`;
+	 *        an entry starting with `comment` runs to the end of the line and is skipped.
+	 *        Keys and values are trimmed, a value in double quotes may hold the separator and keeps its inner blanks.
+	 * @note  Classic INI files, where ';' starts a comment: `ini_tokenizer(text, '\n', ';')`.
+	 */
+	class ini_tokenizer {
+	public:
+		/**
+		 * @param text - config text, must outlive the entries.
+		 * @param separator - ends an entry besides '\n', as in "[abc] name = 123; size = 4;".
+		 * @param comment - a line starting with it is skipped.
+		 * @param assign - between key and value.
+		 */
+		explicit ini_tokenizer(std::string_view text, char separator = ';', char comment = '#', char assign = '=') noexcept
+			: p_(text.data()), last_(text.data() + text.size()), separator_(separator), comment_(comment), assign_(assign) {}
+
+		//* next key of the text, false at the end
+		bool next(ini_entry& entry) noexcept
+		{
+			for (;;) {
+				while (p_ != last_ && (is_blank(*p_) || *p_ == '\n' || *p_ == separator_)) {
+					++p_;
+				}
+				if (p_ == last_) {
+					return false;
+				}
+				if (*p_ == comment_) {
+					skip_line();
+					continue;
+				}
+				if (*p_ == '[') {
+					const char* close = p_ + 1;
+					while (close != last_ && *close != ']' && *close != '\n') {
+						++close;
+					}
+					if (close == last_ || *close != ']') {
+						++errors_; // unclosed section name: the line is dropped
+						skip_line();
+						continue;
+					}
+					section_ = trimmed(p_ + 1, close);
+					p_ = close + 1;
+					continue;
+				}
+
+				const char* key_first = p_;
+				while (p_ != last_ && *p_ != assign_ && *p_ != separator_ && *p_ != '\n') {
+					++p_;
+				}
+				const std::string_view key = trimmed(key_first, p_);
+				std::string_view value;
+				if (p_ != last_ && *p_ == assign_) {
+					value = read_value();
+				}
+				if (key.empty()) {
+					++errors_; // "= value"
+					continue;
+				}
+				entry = ini_entry{section_, key, value};
+				return true;
+			}
+		}
+
+		//* malformed entries skipped so far: unclosed `[section`, or a value without key
+		_CUTIL_NODISCARD size_t errors() const noexcept { return errors_; }
+
+	private:
+		static bool is_blank(char c) noexcept { return c == ' ' || c == '\t' || c == '\r'; }
+
+		static std::string_view trimmed(const char* first, const char* last) noexcept
+		{
+			while (first != last && is_blank(*first)) {
+				++first;
+			}
+			while (last != first && is_blank(last[-1])) {
+				--last;
+			}
+			return std::string_view(first, static_cast<size_t>(last - first));
+		}
+
+		void skip_line() noexcept
+		{
+			const void* eol = std::memchr(p_, '\n', static_cast<size_t>(last_ - p_));
+			p_ = eol ? static_cast<const char*>(eol) + 1 : last_;
+		}
+
+		//* after the `assign` character, up to the end of the entry
+		std::string_view read_value() noexcept
+		{
+			++p_;
+			while (p_ != last_ && is_blank(*p_)) {
+				++p_;
+			}
+			if (p_ != last_ && *p_ == '"') {
+				const void* close = std::memchr(p_ + 1, '"', static_cast<size_t>(last_ - p_ - 1));
+				if (close != nullptr) {
+					const std::string_view value(p_ + 1, static_cast<size_t>(static_cast<const char*>(close) - p_ - 1));
+					p_ = static_cast<const char*>(close) + 1;
+					while (p_ != last_ && *p_ != separator_ && *p_ != '\n') { // anything up to the end of the entry is ignored
+						++p_;
+					}
+					return value;
+				}
+			}
+			const char* first = p_;
+			while (p_ != last_ && *p_ != separator_ && *p_ != '\n') {
+				++p_;
+			}
+			return trimmed(first, p_);
+		}
+
+		const char* p_;
+		const char* last_;
+		std::string_view section_;
+		size_t errors_ = 0;
+		char separator_;
+		char comment_;
+		char assign_;
+	};
+
+
+	/**
+	 * @brief A parsed config: owns its text, and keeps the entries in one vector sorted by (section, key),
+	 *        so lookups are binary searches over views and loading allocates twice (text and vector).
+	 *        A key given more than once in a section keeps its last value, like assigning into a `std::map`.
+	 * @note  Copies share the immutable text.
+	 */
+	class ini_config {
+	public:
+		ini_config() = default;
+
+		//* see `ini_tokenizer` for the syntax and the parameters
+		explicit ini_config(std::string text, char separator = ';', char comment = '#', char assign = '=')
+			: text_(std::make_shared<const std::string>(std::move(text)))
+		{
+			ini_tokenizer tokenizer(*text_, separator, comment, assign);
+			ini_entry entry;
+			while (tokenizer.next(entry)) {
+				entries_.push_back(entry);
+			}
+			errors_ = tokenizer.errors();
+
+			std::stable_sort(entries_.begin(), entries_.end(), less);
+			size_t kept = 0;
+			for (size_t i = 0; i < entries_.size(); ++i) {
+				if (kept != 0 && !less(entries_[kept - 1], entries_[i])) {
+					entries_[kept - 1] = entries_[i]; // same key again, the later one wins
+				} else {
+					entries_[kept++] = entries_[i];
+				}
+			}
+			entries_.resize(kept);
+		}
+
+		//* value of `key` in `section` ("" for keys before the first section)
+		_CUTIL_NODISCARD std::optional<std::string_view> find(std::string_view section, std::string_view key) const
+		{
+			const ini_entry probe{section, key, {}};
+			const auto it = std::lower_bound(entries_.begin(), entries_.end(), probe, less);
+			if (it != entries_.end() && it->section == section && it->key == key) {
+				return it->value;
+			}
+			return std::nullopt;
+		}
+
+		//* value of `key` in `section`, or `fallback`
+		_CUTIL_NODISCARD std::string_view get(std::string_view section, std::string_view key, std::string_view fallback = {}) const
+		{
+			return find(section, key).value_or(fallback);
+		}
+
+		_CUTIL_NODISCARD bool contains(std::string_view section, std::string_view key) const { return find(section, key).has_value(); }
+
+		//* the entries of one section, sorted by key
+		_CUTIL_NODISCARD cutil::span<const ini_entry> section(std::string_view name) const
+		{
+			const auto range = std::equal_range(entries_.begin(), entries_.end(), ini_entry{name, {}, {}},
+				[](const ini_entry& a, const ini_entry& b) { return a.section < b.section; });
+			return cutil::span<const ini_entry>(entries_.data() + (range.first - entries_.begin()), static_cast<size_t>(range.second - range.first));
+		}
+
+		//* all entries, sorted by (section, key)
+		_CUTIL_NODISCARD const std::vector<ini_entry>& entries() const noexcept { return entries_; }
+		_CUTIL_NODISCARD size_t size() const noexcept { return entries_.size(); }
+		_CUTIL_NODISCARD bool empty() const noexcept { return entries_.empty(); }
+		//* malformed entries that were skipped, see `ini_tokenizer::errors()`
+		_CUTIL_NODISCARD size_t errors() const noexcept { return errors_; }
+
+	private:
+		static bool less(const ini_entry& a, const ini_entry& b) noexcept
+		{
+			return std::tie(a.section, a.key) < std::tie(b.section, b.key);
+		}
+
+		std::shared_ptr<const std::string> text_;
+		std::vector<ini_entry> entries_;
+		size_t errors_ = 0;
+	};
+/*
+	cutil::str::ini_config cfg("[abc] name = 123; [abd] name = 456; size = \"4; 5\"");
+	cfg.get("abc", "name");						// -> "123"
+	cfg.find("abd", "size");					// -> "4; 5"
+	cfg.find("abd", "none");					// -> std::nullopt
+	auto n = cutil::str::to_number_opt<int>(cfg.get("abd", "name")); // -> 456
+	for (const auto& entry : cfg.section("abd")) { ... }			// "name", "size"
+
+	cutil::str::ini_config ini(file_text, '\n', ';');	// classic INI: one entry per line, ';' comments
+
+	cutil::str::ini_tokenizer tok(text);		// no lookup needed: walk the entries in order
+	cutil::str::ini_entry entry;
+	while (tok.next(entry)) { ... }
+*/
+
+} // namespace str
+_CUTIL_NAMESPACE_END
+#endif /* CONSOLEUTIL_CPP_INI_PARSER_HPP__ */
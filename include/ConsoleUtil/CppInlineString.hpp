@@ -0,0 +1,213 @@
+#ifndef CONSOLEUTIL_CPP_INLINE_STRING_HPP__
+#define CONSOLEUTIL_CPP_INLINE_STRING_HPP__
+/* UTF-8 encoding
+* Project URL: https://github.com/BH2WFR/ConsoleUtil
+  Author:		BH2WFR
+  Updated:		19 OCT 2026
+  License:		MIT License
+* You can include this header in header files.
+* C++17 or later is required.
+*
+* `cutil::str::inline_string<N>` - up to N chars stored in the object itself, for short tokens:
+*   trivially copyable, usable in constant expressions, and `sizeof(inline_string<N>) == N + 1`,
+*   so `std::vector<inline_string<31>>` is one contiguous array of 32-byte tokens without heap pointers.
+* <ConsoleUtil/CppStringUtil.hpp> produces it with `split_inline()`, and takes it wherever a string-like value is accepted.
+*/
+#include <ConsoleUtil/Base.h>
+#include <ConsoleUtil/CppBase.hpp>
+
+#ifndef CUTIL_CPP17_SUPPORTED
+	#error ">= C++17 is required"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+
+_CUTIL_NAMESPACE_BEGIN
+namespace str
+{
+	template<size_t N>
+	class inline_string;
+	
+	template<typename T>
+	struct is_inline_string : std::false_type {};
+	template<size_t N>
+	struct is_inline_string<inline_string<N>> : std::true_type {};
+	
+	/**
+	 * @brief String of at most `N` chars (1 - 255) kept inside the object, always '\0' terminated.
+	 *        The last byte holds `N - size()`, which is itself the terminator once the string is full,
+	 *        so no byte is spent on the length.
+	 *        Converts implicitly to `std::string_view`; building one from a longer text throws `std::length_error`,
+	 *        check with `fits()` first where that is expected.
+	 */
+	template<size_t N>
+	class inline_string {
+		static_assert(N > 0 && N < 256, "inline_string<N>: N must be within 1 - 255");
+	public:
+		using value_type = char;
+		using size_type = size_t;
+		using iterator = char*;
+		using const_iterator = const char*;
+
+		constexpr inline_string() noexcept : data_{}
+		{
+			data_[N] = static_cast<char>(N);
+		}
+		//* from a string literal, its length is checked at compile time
+		template<size_t M>
+		constexpr inline_string(const char (&literal)[M]) noexcept : data_{}
+		{
+			static_assert(M - 1 <= N, "inline_string<N>: the literal is longer than N");
+			set_size(std::char_traits<char>::length(literal));
+			for (size_t i = 0; i < size(); ++i) {
+				data_[i] = literal[i];
+			}
+		}
+		//* throws `std::length_error` if `str` is longer than `N`
+		constexpr explicit inline_string(std::string_view str) : data_{}
+		{
+			assign(str);
+		}
+
+		_CUTIL_NODISCARD static constexpr bool fits(std::string_view str) noexcept { return str.size() <= N; }
+
+		//* throws `std::length_error` if `str` is longer than `N`
+		constexpr inline_string& assign(std::string_view str)
+		{
+			check_length(str.size());
+			for (size_t i = 0; i < str.size(); ++i) {
+				data_[i] = str[i];
+			}
+			set_size(str.size());
+			return *this;
+		}
+		//* throws `std::length_error` if the result would be longer than `N`
+		constexpr inline_string& append(std::string_view str)
+		{
+			const size_t old_size = size();
+			check_length(old_size + str.size());
+			for (size_t i = 0; i < str.size(); ++i) {
+				data_[old_size + i] = str[i];
+			}
+			set_size(old_size + str.size());
+			return *this;
+		}
+		constexpr inline_string& operator+=(std::string_view str) { return append(str); }
+		constexpr inline_string& operator+=(char c)
+		{
+			push_back(c);
+			return *this;
+		}
+		constexpr void push_back(char c)
+		{
+			const size_t old_size = size();
+			check_length(old_size + 1);
+			data_[old_size] = c;
+			set_size(old_size + 1);
+		}
+		constexpr void pop_back() noexcept { set_size(size() - 1); }
+		//* new chars are `c`; throws `std::length_error` if `count` is greater than `N`
+		constexpr void resize(size_t count, char c = '\0')
+		{
+			check_length(count);
+			for (size_t i = size(); i < count; ++i) {
+				data_[i] = c;
+			}
+			set_size(count);
+		}
+		constexpr void clear() noexcept { set_size(0); }
+
+		_CUTIL_NODISCARD constexpr size_t size() const noexcept { return N - static_cast<uint8_t>(data_[N]); }
+		_CUTIL_NODISCARD constexpr size_t length() const noexcept { return size(); }
+		_CUTIL_NODISCARD constexpr bool empty() const noexcept { return size() == 0; }
+		_CUTIL_NODISCARD static constexpr size_t capacity() noexcept { return N; }
+		_CUTIL_NODISCARD static constexpr size_t max_size() noexcept { return N; }
+
+		_CUTIL_NODISCARD constexpr char* data() noexcept { return data_; }
+		_CUTIL_NODISCARD constexpr const char* data() const noexcept { return data_; }
+		_CUTIL_NODISCARD constexpr const char* c_str() const noexcept { return data_; }
+		constexpr char& operator[](size_t pos) noexcept { return data_[pos]; }
+		constexpr const char& operator[](size_t pos) const noexcept { return data_[pos]; }
+		constexpr char& front() noexcept { return data_[0]; }
+		constexpr const char& front() const noexcept { return data_[0]; }
+		constexpr char& back() noexcept { return data_[size() - 1]; }
+		constexpr const char& back() const noexcept { return data_[size() - 1]; }
+		constexpr iterator begin() noexcept { return data_; }
+		constexpr iterator end() noexcept { return data_ + size(); }
+		constexpr const_iterator begin() const noexcept { return data_; }
+		constexpr const_iterator end() const noexcept { return data_ + size(); }
+
+		_CUTIL_NODISCARD constexpr std::string_view view() const noexcept { return std::string_view(data_, size()); }
+		constexpr operator std::string_view() const noexcept { return view(); }
+		_CUTIL_NODISCARD std::string str() const { return std::string(data_, size()); }
+
+		// comparisons with anything convertible to `std::string_view`, including inline strings of other sizes
+	#define _CUTIL_INLINE_STRING_COMPARISON(_OP)																	\
+		template<typename T, typename std::enable_if<std::is_convertible<const T&, std::string_view>::value, bool>::type = false>	\
+		friend constexpr bool operator _OP(const inline_string& a, const T& b) noexcept { return a.view() _OP std::string_view(b); }	\
+		template<typename T, typename std::enable_if<std::is_convertible<const T&, std::string_view>::value						\
+			&& !is_inline_string<T>::value, bool>::type = false>													\
+		friend constexpr bool operator _OP(const T& a, const inline_string& b) noexcept { return std::string_view(a) _OP b.view(); }
+
+		_CUTIL_INLINE_STRING_COMPARISON(==)
+		_CUTIL_INLINE_STRING_COMPARISON(!=)
+		_CUTIL_INLINE_STRING_COMPARISON(<)
+		_CUTIL_INLINE_STRING_COMPARISON(<=)
+		_CUTIL_INLINE_STRING_COMPARISON(>)
+		_CUTIL_INLINE_STRING_COMPARISON(>=)
+	#undef _CUTIL_INLINE_STRING_COMPARISON
+
+		friend std::ostream& operator<<(std::ostream& os, const inline_string& str) { return os << str.view(); }
+
+	private:
+		static constexpr void check_length(size_t size)
+		{
+			if (size > N) {
+				throw std::length_error("inline_string: longer than its capacity");
+			}
+		}
+		constexpr void set_size(size_t size) noexcept
+		{
+			data_[size] = '\0';
+			data_[N] = static_cast<char>(N - size); // 0 when full, the terminator written above
+		}
+
+		char data_[N + 1];
+	};
+
+/*
+	cutil::str::inline_string<15> name = "Content-Type";	// 16 bytes, no heap
+	constexpr cutil::str::inline_string<7> tag = "GET";		// also at compile time
+	std::string_view view = name;							// implicit
+	name == "content-type";									// -> false, compares as std::string_view
+	cutil::str::inline_string<3>(std::string_view("toolong"));	// throws std::length_error, a literal does not compile
+	cutil::str::inline_string<3>::fits("toolong");			// -> false
+
+	std::vector<cutil::str::inline_string<31>> tokens;		// 32 bytes per token, one contiguous array
+	cutil::str::split_inline("GET /index.html HTTP/1.1", ' ', tokens);
+*/
+
+} // namespace str
+_CUTIL_NAMESPACE_END
+
+
+namespace std
+{
+	template<size_t N>
+	struct hash<cutil::str::inline_string<N>> {
+		size_t operator()(const cutil::str::inline_string<N>& str) const noexcept
+		{
+			return std::hash<std::string_view>()(str.view()); // same as for std::string
+		}
+	};
+}
+
+#endif /* CONSOLEUTIL_CPP_INLINE_STRING_HPP__ */
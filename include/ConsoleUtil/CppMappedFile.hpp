@@ -0,0 +1,393 @@
+#ifndef CONSOLEUTIL_CPP_MAPPED_FILE_HPP__
+#define CONSOLEUTIL_CPP_MAPPED_FILE_HPP__
+/* UTF-8 encoding
+* Project URL: https://github.com/BH2WFR/ConsoleUtil
+  Author:		BH2WFR
+  Updated:		19 OCT 2026
+  License:		MIT License
+* You can include this header in header files.
+* C++17 or later is required.
+*
+* Splitting files of any size into records and fields without a `std::string` per line:
+*   `cutil::str::file_splitter`   - maps the file read-only (`mmap()` / `MapViewOfFile()`), or reads it block by block
+*                                   when it cannot be mapped, and hands out records, or chunks of whole records.
+*   `cutil::str::record_cursor`   - walks the records of a chunk as `std::string_view`s.
+* Fields of a record are split with `cutil::str::split_view()` / `split_any_view()` from <ConsoleUtil/CppStringUtil.hpp>.
+*/
+#include <ConsoleUtil/Base.h>
+#include <ConsoleUtil/CppBase.hpp>
+#include <ConsoleUtil/CppStringUtil.hpp>
+
+#ifndef CUTIL_CPP17_SUPPORTED
+	#error ">= C++17 is required"
+#endif
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#if defined(CUTIL_OS_WINDOWS)
+	#define _CUTIL_MAPPED_FILE_WIN32
+	#include <windows.h>
+#elif defined(__has_include)
+	#if __has_include(<sys/mman.h>)
+		#define _CUTIL_MAPPED_FILE_POSIX
+		#include <fcntl.h>
+		#include <sys/mman.h>
+		#include <sys/stat.h>
+		#include <unistd.h>
+	#endif
+#endif
+
+
+_CUTIL_NAMESPACE_BEGIN
+namespace str
+{
+	/**
+	 * @brief Walks the records of `text` separated by `delim`, as views into `text`.
+	 *        A delimiter at the very end does not start another record, so "a\nb\n" has 2 records, and "" has none;
+	 *        with `delim == '\n'`, a '\r' before it is dropped too.
+	 */
+	class record_cursor {
+	public:
+		record_cursor() noexcept = default;
+		explicit record_cursor(std::string_view text, char delim = '\n') noexcept
+			: p_(text.data()), last_(text.data() + text.size()), delim_(delim) {}
+
+		bool next(std::string_view& record) noexcept
+		{
+			if (p_ == last_) {
+				return false;
+			}
+			const void* hit = std::memchr(p_, delim_, static_cast<size_t>(last_ - p_));
+			const char* end = hit ? static_cast<const char*>(hit) : last_;
+			record = std::string_view(p_, static_cast<size_t>(end - p_));
+			p_ = hit ? end + 1 : last_;
+			if (delim_ == '\n' && !record.empty() && record.back() == '\r') {
+				record.remove_suffix(1);
+			}
+			return true;
+		}
+
+	private:
+		const char* p_ = nullptr;
+		const char* last_ = nullptr;
+		char delim_ = '\n';
+	};
+
+	//* calls `func(std::string_view record)` for each record of `text`, see `record_cursor`; returns the number of records
+	template<typename Func> _CUTIL_FUNC_STATIC
+	inline size_t for_each_record(std::string_view text, char delim, Func&& func)
+	{
+		record_cursor cursor(text, delim);
+		std::string_view record;
+		size_t count = 0;
+		while (cursor.next(record)) {
+			func(record);
+			++count;
+		}
+		return count;
+	}
+
+	//* whole records of a file, safe to hand to another thread
+	struct file_chunk {
+		std::string_view data;				// ends right after a delimiter, or at the end of the file
+		std::shared_ptr<const void> owner;	// keeps `data` alive: the file mapping, or the block it was read into
+		uint64_t offset = 0;				// of `data` in the file
+	};
+
+
+	namespace internal{
+		//* read-only mapping of a whole file, unmapped with the last `shared_ptr`
+		class file_mapping {
+		public:
+			file_mapping(const file_mapping&) = delete;
+			file_mapping& operator=(const file_mapping&) = delete;
+			~file_mapping()
+			{
+			#if defined(_CUTIL_MAPPED_FILE_WIN32)
+				::UnmapViewOfFile(data_);
+			#elif defined(_CUTIL_MAPPED_FILE_POSIX)
+				::munmap(const_cast<char*>(data_), size_);
+			#endif
+			}
+
+			//* nullptr with `ec` set if the file cannot be opened, nullptr alone if it is there but cannot be mapped
+			//  (empty, not a regular file, too big for the address space, ...)
+			static std::shared_ptr<file_mapping> map(const std::string& path, std::error_code& ec)
+			{
+			#if defined(_CUTIL_MAPPED_FILE_WIN32)
+				const HANDLE file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+												  OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+				if (file == INVALID_HANDLE_VALUE) {
+					ec = std::error_code(static_cast<int>(::GetLastError()), std::system_category());
+					return nullptr;
+				}
+				LARGE_INTEGER size;
+				const bool mappable = ::GetFileSizeEx(file, &size) && size.QuadPart > 0
+					&& static_cast<uint64_t>(size.QuadPart) <= static_cast<uint64_t>(SIZE_MAX);
+				const HANDLE mapping = mappable ? ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+				::CloseHandle(file);
+				if (mapping == nullptr) {
+					return nullptr;
+				}
+				const void* data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+				::CloseHandle(mapping); // the view keeps the mapping object alive
+				if (data == nullptr) {
+					return nullptr;
+				}
+				return std::shared_ptr<file_mapping>(new file_mapping(static_cast<const char*>(data), static_cast<size_t>(size.QuadPart)));
+			#elif defined(_CUTIL_MAPPED_FILE_POSIX)
+				const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+				if (fd < 0) {
+					ec = std::error_code(errno, std::generic_category());
+					return nullptr;
+				}
+				struct stat st;
+				const bool mappable = ::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0
+					&& static_cast<uint64_t>(st.st_size) <= static_cast<uint64_t>(SIZE_MAX);
+				void* data = mappable ? ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+				::close(fd); // the mapping stays valid
+				if (data == MAP_FAILED) {
+					return nullptr;
+				}
+			#ifdef MADV_SEQUENTIAL
+				::madvise(data, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL); // aggressive read-ahead, early reclaim behind
+			#endif
+				return std::shared_ptr<file_mapping>(new file_mapping(static_cast<const char*>(data), static_cast<size_t>(st.st_size)));
+			#else
+				(void)path;
+				(void)ec;
+				return nullptr;
+			#endif
+			}
+
+			const char* data() const noexcept { return data_; }
+			size_t size() const noexcept { return size_; }
+
+			//* asks the kernel to start reading [offset, offset + size) in, before a worker gets to it
+			void will_need(size_t offset, size_t size) const noexcept
+			{
+			#if defined(_CUTIL_MAPPED_FILE_POSIX) && defined(MADV_WILLNEED)
+				static const size_t page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+				const size_t first = offset / page * page; // madvise() wants a page aligned address
+				::madvise(const_cast<char*>(data_) + first, offset + size - first, MADV_WILLNEED);
+			#else
+				(void)offset;
+				(void)size;
+			#endif
+			}
+
+		private:
+			file_mapping(const char* data, size_t size) noexcept : data_(data), size_(size) {}
+
+			const char* data_;
+			size_t size_;
+		};
+
+		struct file_closer {
+			void operator()(std::FILE* file) const noexcept { std::fclose(file); }
+		};
+	}
+
+
+	/**
+	 * @brief Reads a file as records separated by a delimiter, without copying them when the file can be mapped.
+	 *        Regular files are mapped read-only with a sequential access hint, so files larger than memory work as well
+	 *        and only the pages being read stay resident. Pipes, empty files and files that cannot be mapped
+	 *        are read block by block instead, with a record cut by a block boundary carried into the next block.
+	 *        `next_record()` walks the file record by record; `next_chunk()` hands out chunks of whole records
+	 *        that stay valid on their own and can be split in other threads.
+	 * @note  Not thread-safe itself: call it from one thread, and send the chunks to the workers.
+	 */
+	class file_splitter {
+	public:
+		static constexpr size_t default_chunk_size = size_t(4) << 20;
+
+		file_splitter() = default;
+		file_splitter(file_splitter&&) noexcept = default;
+		file_splitter& operator=(file_splitter&&) noexcept = default;
+
+		/**
+		 * @param path - file to read.
+		 * @param record_delim - record separator, '\n' drops a '\r' before it too (`record_cursor`).
+		 * @param allow_mmap - false always reads block by block.
+		 * @return the error of opening the file, or an empty `std::error_code`.
+		 */
+		std::error_code open(const std::string& path, char record_delim = '\n', bool allow_mmap = true)
+		{
+			*this = file_splitter();
+			delim_ = record_delim;
+			std::error_code ec;
+			if (allow_mmap) {
+				mapping_ = internal::file_mapping::map(path, ec);
+				if (ec) {
+					return ec;
+				}
+			}
+			if (mapping_ == nullptr) {
+				file_.reset(std::fopen(path.c_str(), "rb"));
+				if (file_ == nullptr) {
+					return std::error_code(errno, std::generic_category());
+				}
+			}
+			return {};
+		}
+
+		void close() { *this = file_splitter(); }
+
+		_CUTIL_NODISCARD bool is_open() const noexcept { return mapping_ != nullptr || file_ != nullptr; }
+		_CUTIL_NODISCARD bool is_mapped() const noexcept { return mapping_ != nullptr; }
+		//* read error met while reading block by block, the records before it were handed out
+		_CUTIL_NODISCARD std::error_code error() const noexcept { return error_; }
+		//* record separator given to `open()`
+		_CUTIL_NODISCARD char record_delim() const noexcept { return delim_; }
+		//* bytes handed out in chunks so far
+		_CUTIL_NODISCARD uint64_t offset() const noexcept { return offset_; }
+
+		/**
+		 * @brief Hands out the next chunk of whole records, about `target_size` bytes:
+		 *        it ends after the first delimiter from there on, so a record longer than `target_size` makes a bigger chunk.
+		 *        Mapped files give views into the mapping, other files a freshly read block.
+		 * @return false at the end of the file.
+		 */
+		bool next_chunk(file_chunk& chunk, size_t target_size = default_chunk_size)
+		{
+			target_size = std::max<size_t>(target_size, 1);
+			if (mapping_ != nullptr) {
+				return next_mapped_chunk(chunk, target_size);
+			}
+			if (file_ != nullptr) {
+				return next_read_chunk(chunk, target_size);
+			}
+			return false;
+		}
+
+		/**
+		 * @brief Gives the next record, without its delimiter.
+		 *        The view stays valid until the next call for files read block by block, and while this object lives for mapped ones.
+		 * @return false at the end of the file.
+		 */
+		bool next_record(std::string_view& record)
+		{
+			for (;;) {
+				if (cursor_.next(record)) {
+					return true;
+				}
+				if (!next_chunk(current_, record_block_size)) {
+					return false;
+				}
+				cursor_ = record_cursor(current_.data, delim_);
+			}
+		}
+
+	private:
+		static constexpr size_t record_block_size = size_t(1) << 20;
+
+		bool next_mapped_chunk(file_chunk& chunk, size_t target_size)
+		{
+			const char* const data = mapping_->data();
+			const size_t size = mapping_->size();
+			const size_t first = static_cast<size_t>(offset_);
+			if (first >= size) {
+				return false;
+			}
+			size_t last = first + std::min(target_size, size - first);
+			if (last < size) { // extend to the end of the record the target size falls in
+				const void* hit = std::memchr(data + last - 1, delim_, size - (last - 1));
+				last = hit ? static_cast<size_t>(static_cast<const char*>(hit) - data) + 1 : size;
+			}
+			mapping_->will_need(first, last - first);
+			chunk.data = std::string_view(data + first, last - first);
+			chunk.owner = mapping_;
+			chunk.offset = offset_;
+			offset_ = last;
+			return true;
+		}
+
+		bool next_read_chunk(file_chunk& chunk, size_t target_size)
+		{
+			size_t capacity = std::max(target_size, carry_.size() * 2);
+			std::shared_ptr<char[]> block(new char[capacity]);
+			std::memcpy(block.get(), carry_.data(), carry_.size());
+			size_t used = carry_.size();
+			size_t last = 0;
+			for (;;) {
+				if (!eof_) {
+					used += std::fread(block.get() + used, 1, capacity - used, file_.get());
+					if (used < capacity) {
+						if (std::ferror(file_.get())) {
+							error_ = std::error_code(errno != 0 ? errno : EIO, std::generic_category());
+						}
+						eof_ = true;
+					}
+				}
+				if (eof_) {
+					last = used;
+					break;
+				}
+				last = used;
+				while (last != 0 && block[last - 1] != delim_) {
+					--last;
+				}
+				if (last != 0) {
+					break;
+				}
+				// no delimiter in the whole block: one record is longer than it, read on into a bigger one
+				std::shared_ptr<char[]> bigger(new char[capacity * 2]);
+				std::memcpy(bigger.get(), block.get(), used);
+				block = std::move(bigger);
+				capacity *= 2;
+			}
+			carry_.assign(block.get() + last, used - last);
+			if (last == 0) {
+				return false;
+			}
+			chunk.data = std::string_view(block.get(), last);
+			chunk.owner = std::move(block);
+			chunk.offset = offset_;
+			offset_ += last;
+			return true;
+		}
+
+		std::shared_ptr<internal::file_mapping> mapping_;
+		std::unique_ptr<std::FILE, internal::file_closer> file_;
+		std::string carry_;		// start of a record cut by the end of the last block
+		bool eof_ = false;
+		char delim_ = '\n';
+		uint64_t offset_ = 0;
+		std::error_code error_;
+		file_chunk current_;	// of `next_record()`
+		record_cursor cursor_;
+	};
+/*
+	cutil::str::file_splitter file;
+	if (std::error_code ec = file.open("access.log")) {
+		std::cerr << ec.message();
+	}
+	std::string_view line;
+	std::vector<std::string_view> fields;
+	while (file.next_record(line)) {
+		cutil::str::split_view(line, '\t', fields);
+		...
+	}
+
+	// with worker threads: each chunk ends on a record boundary and owns its memory
+	cutil::str::file_chunk chunk;
+	while (file.next_chunk(chunk, 8 << 20)) {
+		pool.submit([chunk] {
+			cutil::str::for_each_record(chunk.data, '\n', [](std::string_view line) { ... });
+		});
+	}
+*/
+
+} // namespace str
+_CUTIL_NAMESPACE_END
+#endif /* CONSOLEUTIL_CPP_MAPPED_FILE_HPP__ */
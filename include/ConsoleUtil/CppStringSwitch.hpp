@@ -0,0 +1,289 @@
+#ifndef CONSOLEUTIL_CPP_STRING_SWITCH_HPP__
+#define CONSOLEUTIL_CPP_STRING_SWITCH_HPP__
+/* UTF-8 encoding
+* Project URL: https://github.com/BH2WFR/ConsoleUtil
+  Author:		BH2WFR
+  Updated:		19 OCT 2026
+  License:		MIT License
+* You can include this header in header files.
+* C++17 or later is required.
+*
+* `cutil::str::string_switch` - `switch` over strings: a perfect hash of a fixed list of keys, built at compile time,
+*   maps a string to the position of its key in the list, which is a constant usable in `case` labels.
+*   A lookup costs one hash of the string (a multiply per 8 chars), two table reads and one comparison with the only candidate,
+*   whatever the number of keys, instead of comparing with each key in turn in an `if / else if` chain.
+*/
+#include <ConsoleUtil/Base.h>
+#include <ConsoleUtil/CppBase.hpp>
+
+#ifndef CUTIL_CPP17_SUPPORTED
+	#error ">= C++17 is required"
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+
+_CUTIL_NAMESPACE_BEGIN
+namespace str
+{
+	namespace internal{
+		constexpr char switch_fold(char c) noexcept { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c; }
+
+		//* ASCII letters of 8 bytes to lower case at once
+		constexpr uint64_t switch_fold_8(uint64_t w) noexcept
+		{
+			constexpr uint64_t ones = 0x0101010101010101u;
+			const uint64_t low7 = w & ~(ones * 0x80);
+			const uint64_t upper = ((low7 + ones * (0x80 - 'A')) ^ (low7 + ones * (0x80 - 'Z' - 1))) & ~w & (ones * 0x80);
+			return w | (upper >> 2);
+		}
+
+		//* little-endian words, one load at run time and the same value at compile time
+		constexpr uint64_t switch_read4(const char* p) noexcept
+		{
+		#ifdef CUTIL_CPU_LITTLE_ENDIAN
+			if (!cutil::is_constant_evaluated()) {
+				uint32_t v = 0;
+				std::memcpy(&v, p, 4);
+				return v;
+			}
+		#endif
+			return static_cast<uint64_t>(static_cast<uint8_t>(p[0])) | (static_cast<uint64_t>(static_cast<uint8_t>(p[1])) << 8)
+				| (static_cast<uint64_t>(static_cast<uint8_t>(p[2])) << 16) | (static_cast<uint64_t>(static_cast<uint8_t>(p[3])) << 24);
+		}
+		constexpr uint64_t switch_read8(const char* p) noexcept
+		{
+		#ifdef CUTIL_CPU_LITTLE_ENDIAN
+			if (!cutil::is_constant_evaluated()) {
+				uint64_t v = 0;
+				std::memcpy(&v, p, 8);
+				return v;
+			}
+		#endif
+			return switch_read4(p) | (switch_read4(p + 4) << 32);
+		}
+
+		template<bool IgnoreCase>
+		constexpr uint64_t switch_step(uint64_t h, uint64_t w) noexcept
+		{
+			if constexpr (IgnoreCase) {
+				w = switch_fold_8(w);
+			}
+			h = (h ^ w) * 0xD6E8FEB86659FD93u;
+			return h ^ (h >> 32);
+		}
+
+		//* a multiply per 8 bytes; the last 1 - 8 bytes are read as two overlapping halves, so keys of up to 8 chars take one step
+		template<bool IgnoreCase>
+		constexpr uint64_t switch_hash(std::string_view str) noexcept
+		{
+			const char* p = str.data();
+			size_t n = str.size();
+			uint64_t h = (n + 1) * 0x9E3779B97F4A7C15u; // the length spread over all bits, apart from the chars
+			for (; n > 8; n -= 8, p += 8) {
+				h = switch_step<IgnoreCase>(h, switch_read8(p));
+			}
+			uint64_t w = 0;
+			if (n >= 4) {
+				w = switch_read4(p) | (switch_read4(p + n - 4) << 32);
+			} else if (n > 0) {
+				w = static_cast<uint64_t>(static_cast<uint8_t>(p[0])) | (static_cast<uint64_t>(static_cast<uint8_t>(p[n / 2])) << 8)
+					| (static_cast<uint64_t>(static_cast<uint8_t>(p[n - 1])) << 16);
+			}
+			return switch_step<IgnoreCase>(h, w);
+		}
+
+		template<bool IgnoreCase>
+		constexpr bool switch_equal(std::string_view a, std::string_view b) noexcept
+		{
+			if constexpr (IgnoreCase) {
+				if (a.size() != b.size()) {
+					return false;
+				}
+				for (size_t i = 0; i < a.size(); ++i) {
+					if (switch_fold(a[i]) != switch_fold(b[i])) {
+						return false;
+					}
+				}
+				return true;
+			} else {
+				return a == b;
+			}
+		}
+
+		//* slot of a hash under displacement `d`, a multiply and two shifts
+		constexpr uint64_t switch_slot(uint64_t h, uint32_t d) noexcept
+		{
+			h ^= d * 0x9E3779B97F4A7C15u;
+			h *= 0xD6E8FEB86659FD93u;
+			return h ^ (h >> 32);
+		}
+
+		constexpr size_t switch_pow2_at_least(size_t n) noexcept
+		{
+			size_t m = 1;
+			while (m < n) {
+				m <<= 1;
+			}
+			return m;
+		}
+	}
+
+	/**
+	 * @brief Maps each of `N` keys to its position in the list, anything else to `npos`, in constant time.
+	 *        Built by hash-and-displace: keys are grouped into buckets by their hash, then each bucket, largest first,
+	 *        gets the smallest displacement that moves all its keys to free slots of a table twice as large as `N`.
+	 *        `IgnoreCase` folds ASCII letters, like `compare_ignore_case()` in the "C" locale.
+	 * @note  Duplicate keys are a compile error in a `constexpr` switch, and throw `std::invalid_argument` at runtime.
+	 *        Hundreds of keys can exceed the compiler's constant evaluation limit (MSVC `/constexpr:steps`, Clang `-fconstexpr-steps`).
+	 *        The keys are views: literals, or strings that outlive the switch.
+	 */
+	template<size_t N, bool IgnoreCase = false>
+	class string_switch {
+		static_assert(N > 0 && N < 65535, "string_switch<N>: N must be within 1 - 65534");
+	public:
+		static constexpr size_t npos = static_cast<size_t>(-1);
+
+		template<typename... Keys, typename std::enable_if<sizeof...(Keys) == N
+			&& std::conjunction<std::is_convertible<const Keys&, std::string_view>...>::value, bool>::type = false>
+		constexpr explicit string_switch(const Keys&... keys) : keys_{std::string_view(keys)...}
+		{
+			build();
+		}
+		constexpr explicit string_switch(const std::array<std::string_view, N>& keys)
+		{
+			for (size_t i = 0; i < N; ++i) {
+				keys_[i] = keys[i];
+			}
+			build();
+		}
+
+		//* position of `str` in the key list, or `npos`
+		_CUTIL_NODISCARD constexpr size_t find(std::string_view str) const noexcept
+		{
+			const uint64_t h = internal::switch_hash<IgnoreCase>(str);
+			const size_t index = slots_[internal::switch_slot(h, displacements_[bucket_of(h)]) & (table_size - 1)];
+			return index < N && internal::switch_equal<IgnoreCase>(keys_[index], str) ? index : npos;
+		}
+		_CUTIL_NODISCARD constexpr size_t operator()(std::string_view str) const noexcept { return find(str); }
+		_CUTIL_NODISCARD constexpr bool contains(std::string_view str) const noexcept { return find(str) != npos; }
+
+		_CUTIL_NODISCARD static constexpr size_t size() noexcept { return N; }
+		_CUTIL_NODISCARD constexpr std::string_view operator[](size_t index) const noexcept { return keys_[index]; }
+		_CUTIL_NODISCARD constexpr const std::string_view* begin() const noexcept { return keys_; }
+		_CUTIL_NODISCARD constexpr const std::string_view* end() const noexcept { return keys_ + N; }
+
+	private:
+		static constexpr size_t table_size = internal::switch_pow2_at_least(2 * N);
+		static constexpr size_t bucket_count = table_size / 4 == 0 ? 1 : table_size / 4; // 1 - 2 keys per bucket
+
+		static constexpr size_t bucket_of(uint64_t h) noexcept { return static_cast<size_t>(h >> 40) & (bucket_count - 1); }
+
+		constexpr void build()
+		{
+			for (size_t s = 0; s < table_size; ++s) {
+				slots_[s] = static_cast<uint16_t>(N); // empty
+			}
+			// keys by bucket (a counting sort), and their hashes
+			uint64_t hashes[N] = {};
+			uint16_t first[bucket_count + 1] = {};
+			for (size_t i = 0; i < N; ++i) {
+				hashes[i] = internal::switch_hash<IgnoreCase>(keys_[i]);
+				++first[bucket_of(hashes[i]) + 1];
+			}
+			size_t largest = 0;
+			for (size_t b = 0; b < bucket_count; ++b) {
+				largest = first[b + 1] > largest ? first[b + 1] : largest;
+				first[b + 1] += first[b];
+			}
+			uint16_t order[N] = {};
+			uint16_t filled[bucket_count] = {};
+			for (size_t i = 0; i < N; ++i) {
+				const size_t b = bucket_of(hashes[i]);
+				order[first[b] + filled[b]++] = static_cast<uint16_t>(i);
+			}
+
+			for (size_t count = largest; count > 0; --count) { // the fullest buckets first, while the table is still empty
+				for (size_t b = 0; b < bucket_count; ++b) {
+					if (static_cast<size_t>(first[b + 1] - first[b]) == count) {
+						place(b, order + first[b], count, hashes);
+					}
+				}
+			}
+		}
+
+		constexpr void place(size_t bucket, const uint16_t* members, size_t count, const uint64_t* hashes)
+		{
+			for (size_t i = 0; i < count; ++i) {
+				for (size_t j = 0; j < i; ++j) {
+					if (internal::switch_equal<IgnoreCase>(keys_[members[i]], keys_[members[j]])) {
+						throw std::invalid_argument("string_switch: duplicate key"); // same hash for every displacement
+					}
+				}
+			}
+			for (uint32_t d = 0; d < (1u << 20); ++d) {
+				size_t slots[16] = {}; // buckets hold 2 keys on average, more than 16 does not happen in practice
+				bool free = count <= 16;
+				for (size_t i = 0; i < count && free; ++i) {
+					slots[i] = internal::switch_slot(hashes[members[i]], d) & (table_size - 1);
+					free = slots_[slots[i]] == N;
+					for (size_t j = 0; j < i && free; ++j) {
+						free = slots[j] != slots[i];
+					}
+				}
+				if (free) {
+					displacements_[bucket] = d;
+					for (size_t i = 0; i < count; ++i) {
+						slots_[slots[i]] = members[i];
+					}
+					return;
+				}
+			}
+			throw std::logic_error("string_switch: no displacement found");
+		}
+
+		std::string_view keys_[N] = {};
+		uint16_t slots_[table_size] = {};			// position of the key in the slot, `N` when empty
+		uint32_t displacements_[bucket_count] = {};
+	};
+
+	template<typename... Keys>
+	string_switch(const Keys&...) -> string_switch<sizeof...(Keys)>;
+
+	//* `string_switch` of literals or string views, case-sensitive
+	template<typename... Keys> _CUTIL_NODISCARD
+	constexpr string_switch<sizeof...(Keys)> make_string_switch(const Keys&... keys)
+	{
+		return string_switch<sizeof...(Keys)>(keys...);
+	}
+	//* `string_switch` that folds ASCII letters: "Open", "OPEN" and "open" are the same key
+	template<typename... Keys> _CUTIL_NODISCARD
+	constexpr string_switch<sizeof...(Keys), true> make_string_switch_ignore_case(const Keys&... keys)
+	{
+		return string_switch<sizeof...(Keys), true>(keys...);
+	}
+/*
+	static constexpr cutil::str::string_switch commands("open", "close", "list", "quit");
+	switch (commands(input)) {							// one hash, one comparison
+		case commands("open"):  open_file();  break;	// -> 0, computed at compile time
+		case commands("close"): close_file(); break;	// -> 1
+		case commands("list"):  list_dir();   break;
+		case commands("quit"):  return 0;
+		default: printf("unknown command\n");			// `commands.npos`
+	}
+
+	static constexpr auto methods = cutil::str::make_string_switch_ignore_case("GET", "POST", "PUT", "DELETE");
+	methods("post");									// -> 1
+	methods.contains("PATCH");							// -> false
+	methods[3];											// -> "DELETE"
+*/
+
+} // namespace str
+_CUTIL_NAMESPACE_END
+#endif /* CONSOLEUTIL_CPP_STRING_SWITCH_HPP__ */
@@ -16,21 +16,33 @@
 #define CONSOLEUTIL_EXTERNAL_STRING_UTIL_H__
 #include <ConsoleUtil/Base.h>
 #include <ConsoleUtil/CppBase.hpp>
+#include <ConsoleUtil/CppBit.hpp>
+#include <ConsoleUtil/CppCharConv.hpp>
+#include <ConsoleUtil/External/Span.hpp>
 
 #ifndef CUTIL_CPP14_SUPPORTED
 	#error ">= C++14 is required"
 #endif
 
 
+#include <cerrno>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <type_traits>
 #include <algorithm>
+#include <array>
 #include <cctype>
+#include <functional>
 #include <map>
+#include <memory>
 #include <regex>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <system_error>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
 #ifndef CUTIL_STRINGUTIL_DO_NOT_USE_PARALLEL
@@ -44,6 +56,16 @@
 #ifdef CUTIL_CPP17_SUPPORTED
 	#include <optional>
 	#include <charconv>
+	#include <string_view>
+	#include <tuple>
+	#include <shared_mutex>
+	#include <ConsoleUtil/CppInlineString.hpp>
+#endif
+#if defined(CUTIL_CPP17_SUPPORTED) && defined(__has_include)
+	#if __has_include(<memory_resource>)
+		#define _CUTIL_STRINGUTIL_USE_PMR //* allocator-aware overloads in cutil::str::pmr (>=C++17)
+		#include <memory_resource>
+	#endif
 #endif
 
 
@@ -51,14 +73,200 @@ _CUTIL_NAMESPACE_BEGIN
 namespace str
 {
 	namespace internal{
+		//* string sorting: multikey quicksort (Bentley & Sedgewick) over cached 8-byte keys.
+		//  every entry carries the next 8 bytes of its string as a big-endian integer, so partitioning compares
+		//  integers in one flat array instead of chasing string pointers, and the keys are reloaded once per 8 levels.
+		struct string_sort_entry {
+			uint64_t key;		// bytes [depth, depth + 8) of the string, zero padded
+			const char* data;
+			size_t size;
+			size_t index;		// position in the vector being sorted
+		};
+		
+		inline uint64_t load_sort_key(const char* data, size_t size, size_t depth)
+		{
+			const size_t left = size - depth;
+			uint64_t key = 0;
+			if (left >= 8) {
+				std::memcpy(&key, data + depth, sizeof(key));
+			#ifdef CUTIL_CPU_LITTLE_ENDIAN
+				key = cutil::byteswap(key);
+			#endif
+				return key;
+			}
+			for (size_t i = 0; i < left; ++i) {
+				key |= static_cast<uint64_t>(static_cast<uint8_t>(data[depth + i])) << (56 - 8 * i);
+			}
+			return key;
+		}
+		
+		//* same order as `std::string::compare()`, for strings equal up to `depth`
+		inline bool string_sort_less(const string_sort_entry& a, const string_sort_entry& b, size_t depth)
+		{
+			if (a.key != b.key) {
+				return a.key < b.key;
+			}
+			const size_t skip = depth + 8;
+			if (a.size <= skip || b.size <= skip) { // the shorter one is a prefix of the other
+				return a.size < b.size;
+			}
+			const int c = std::memcmp(a.data + skip, b.data + skip, std::min(a.size, b.size) - skip);
+			return c != 0 ? c < 0 : a.size < b.size;
+		}
+		
+		inline void string_insertion_sort(string_sort_entry* first, string_sort_entry* last, size_t depth)
+		{
+			for (string_sort_entry* i = first + 1; i < last; ++i) {
+				const string_sort_entry tmp = *i;
+				string_sort_entry* j = i;
+				for (; j != first && string_sort_less(tmp, *(j - 1), depth); --j) {
+					*j = *(j - 1);
+				}
+				*j = tmp;
+			}
+		}
+		
+		//* sorts entries whose strings are all equal up to `depth`, with keys loaded at `depth`
+		inline void multikey_quicksort(string_sort_entry* first, string_sort_entry* last, size_t depth)
+		{
+			while (last - first > 32) {
+				const uint64_t a = first->key, b = first[(last - first) / 2].key, c = (last - 1)->key;
+				const uint64_t pivot = a < b ? (b < c ? b : (a < c ? c : a)) : (a < c ? a : (b < c ? c : b));
+				
+				// [first, lt) < pivot, [lt, gt) == pivot, [gt, last) > pivot
+				string_sort_entry* lt = first;
+				string_sort_entry* gt = last;
+				for (string_sort_entry* i = first; i < gt; ) {
+					if (i->key < pivot) {
+						std::swap(*lt++, *i++);
+					} else if (i->key > pivot) {
+						std::swap(*i, *--gt);
+					} else {
+						++i;
+					}
+				}
+				
+				// among equal keys, strings ending inside the key are prefixes of the rest: they go first, shortest first
+				string_sort_entry* ended = std::partition(lt, gt, [depth](const string_sort_entry& e){ return e.size <= depth + 8; });
+				std::sort(lt, ended, [](const string_sort_entry& x, const string_sort_entry& y){ return x.size < y.size; });
+				if (gt - ended > 1) {
+					for (string_sort_entry* e = ended; e != gt; ++e) {
+						e->key = load_sort_key(e->data, e->size, depth + 8);
+					}
+					multikey_quicksort(ended, gt, depth + 8);
+				}
+				
+				// recurse into the smaller side, loop on the larger one
+				if (lt - first < last - gt) {
+					multikey_quicksort(first, lt, depth);
+					first = gt;
+				} else {
+					multikey_quicksort(gt, last, depth);
+					last = lt;
+				}
+			}
+			string_insertion_sort(first, last, depth);
+		}
+		
+		//* MSD radix sort on the top 16 bits of the keys, then the buckets are sorted concurrently
+		inline void multikey_quicksort_par(std::vector<string_sort_entry>& entries)
+		{
+			const size_t bucket_count = size_t(1) << 16;
+			std::vector<size_t> offsets(bucket_count + 1, 0);
+			for (const string_sort_entry& e : entries) {
+				++offsets[(e.key >> 48) + 1];
+			}
+			for (size_t b = 0; b < bucket_count; ++b) {
+				offsets[b + 1] += offsets[b];
+			}
+			std::vector<string_sort_entry> buckets(entries.size());
+			{
+				std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+				for (const string_sort_entry& e : entries) {
+					buckets[fill[e.key >> 48]++] = e;
+				}
+			}
+			entries.swap(buckets);
+			buckets = std::vector<string_sort_entry>();
+			
+			std::vector<size_t> ids;
+			for (size_t b = 0; b < bucket_count; ++b) {
+				if (offsets[b + 1] - offsets[b] > 1) {
+					ids.push_back(b);
+				}
+			}
+			const auto sort_bucket = [&](size_t b) {
+				multikey_quicksort(entries.data() + offsets[b], entries.data() + offsets[b + 1], 0);
+			};
+		#ifdef _CUTIL_STRINGUTIL_USE_PARALLEL
+			std::for_each(std::execution::par, ids.begin(), ids.end(), sort_bucket);
+		#else
+			std::for_each(ids.begin(), ids.end(), sort_bucket);
+		#endif
+		}
+		
+		template<typename T>
+		inline void sort_strings(std::vector<T>& vec, bool descending)
+		{
+			const size_t n = vec.size();
+			std::vector<string_sort_entry> entries(n);
+			for (size_t i = 0; i < n; ++i) {
+				entries[i] = {load_sort_key(vec[i].data(), vec[i].size(), 0), vec[i].data(), vec[i].size(), i};
+			}
+		#ifdef _CUTIL_STRINGUTIL_USE_PARALLEL
+			if (n >= (size_t(1) << 16)) {
+				multikey_quicksort_par(entries);
+			} else
+		#endif
+			{
+				multikey_quicksort(entries.data(), entries.data() + n, 0);
+			}
+			if (descending) {
+				std::reverse(entries.begin(), entries.end());
+			}
+			
+			// gathering into a new vector moves every element once, in output order
+			std::vector<T> sorted;
+			sorted.reserve(n);
+			for (const string_sort_entry& e : entries) {
+				sorted.push_back(std::move(vec[e.index]));
+			}
+			vec.swap(sorted);
+		}
+		
+		template<typename T>
+		struct is_radix_sortable : std::false_type {};
+		template<>
+		struct is_radix_sortable<std::string> : std::true_type {};
+	#ifdef CUTIL_CPP17_SUPPORTED
+		template<>
+		struct is_radix_sortable<std::string_view> : std::true_type {};
+	#endif
+		
 		template<typename T, typename Compare>
-		inline void sort(std::vector<T>& vec, Compare comp = std::less<T>()) {
+		inline void sort(std::vector<T>& vec, Compare comp, std::false_type) {
 		#ifdef _CUTIL_STRINGUTIL_USE_PARALLEL
 			std::sort(std::execution::par_unseq, vec.begin(), vec.end(), comp);
 		#else
 			std::sort(vec.begin(), vec.end(), comp);
 		#endif
 		}
+		template<typename T>
+		inline void sort(std::vector<T>& vec, std::less<T>, std::true_type) {
+			sort_strings(vec, false);
+		}
+		template<typename T>
+		inline void sort(std::vector<T>& vec, std::greater<T>, std::true_type) {
+			sort_strings(vec, true);
+		}
+		
+		//* strings in their natural order go through `sort_strings()`, anything else through `std::sort()`
+		template<typename T, typename Compare>
+		inline void sort(std::vector<T>& vec, Compare comp = std::less<T>()) {
+			using radix = std::integral_constant<bool, is_radix_sortable<T>::value
+				&& (std::is_same<Compare, std::less<T>>::value || std::is_same<Compare, std::greater<T>>::value)>;
+			sort(vec, comp, radix());
+		}
 		
 		template <typename T>
 		struct is_arithmetic : std::integral_constant<bool, std::is_arithmetic<T>::value && !std::is_same<T, bool>::value> {};
@@ -68,41 +276,444 @@ namespace str
 		
 		template <typename T>
 		struct is_floating_point : std::integral_constant<bool, std::is_floating_point<T>::value> {};
+		
+		//* `std::string`, `std::string_view`, `const char*`, and string literals
+		template <typename T, typename D = typename std::decay<T>::type>
+		struct is_string_like : std::integral_constant<bool
+					, std::is_same<D, std::string>::value
+					|| std::is_same<D, const char*>::value
+					|| std::is_same<D, char*>::value
+				#ifdef CUTIL_CPP17_SUPPORTED
+					|| std::is_same<D, std::string_view>::value
+					|| is_inline_string<D>::value
+				#endif
+				> {};
+		
+		//* non-owning (data, size) pair, usable before C++17
+		struct str_ref {
+			const char* data;
+			size_t size;
+		};
+		inline str_ref make_str_ref(const std::string& str) { return {str.data(), str.size()}; }
+		inline str_ref make_str_ref(const char* str) { return {str, std::char_traits<char>::length(str)}; }
+	#ifdef CUTIL_CPP17_SUPPORTED
+		inline str_ref make_str_ref(std::string_view str) { return {str.data(), str.size()}; }
+		template<size_t N>
+		inline str_ref make_str_ref(const inline_string<N>& str) { return {str.data(), str.size()}; }
+	#endif
+		
+		//* big enough for any arithmetic type, including `long double` in scientific notation
+		static constexpr size_t number_buffer_size = 128;
+		
+		//* writes `value` into [first, last), returns the end of the written characters
+		template <typename T, typename std::enable_if<is_integral<T>::value, bool>::type = false>
+		inline char* number_to_chars(char* first, char* last, T value)
+		{
+		#ifdef CUTIL_CPP17_SUPPORTED
+			return std::to_chars(first, last, value).ptr;
+		#else
+			(void)last;
+			char tmp[number_buffer_size];
+			char* p = tmp + sizeof(tmp);
+			using U = typename std::make_unsigned<T>::type;
+			U u = static_cast<U>(value);
+			const bool negative = value < 0;
+			if (negative) {
+				u = static_cast<U>(U(0) - u);
+			}
+			do {
+				*--p = static_cast<char>('0' + u % 10);
+				u = static_cast<U>(u / 10);
+			} while (u != 0);
+			if (negative) {
+				*--p = '-';
+			}
+			return std::copy(p, tmp + sizeof(tmp), first);
+		#endif
+		}
+		//* shortest round-trip text
+		inline char* number_to_chars(char* first, char* last, float value) { return float_to_chars(first, last, value); }
+		inline char* number_to_chars(char* first, char* last, double value) { return float_to_chars(first, last, value); }
+		inline char* number_to_chars(char* first, char* last, long double value)
+		{
+		#ifdef CUTIL_CPP17_SUPPORTED
+			return std::to_chars(first, last, value).ptr;
+		#else
+			const int n = std::snprintf(first, static_cast<size_t>(last - first), "%.*Lg"
+										, std::numeric_limits<long double>::max_digits10, value);
+			return first + n;
+		#endif
+		}
+	}
+	
+	
+	namespace internal{
+		//* value of a digit in bases up to 36, or 0xFF for non-digits
+		inline uint8_t digit_value(char c)
+		{
+			if (c >= '0' && c <= '9') {
+				return static_cast<uint8_t>(c - '0');
+			}
+			if (c >= 'a' && c <= 'z') {
+				return static_cast<uint8_t>(c - 'a' + 10);
+			}
+			if (c >= 'A' && c <= 'Z') {
+				return static_cast<uint8_t>(c - 'A' + 10);
+			}
+			return 0xFF;
+		}
+		
+		//* digits of [first, last) without sign, accumulated in the unsigned type of T.
+		//  overflow is checked against |min| or max before each step, so nothing wider than T is needed.
+		template<typename T>
+		inline parse_result parse_integer_magnitude(const char* first, const char* last, bool negative, int base, T& value)
+		{
+			using U = typename std::make_unsigned<T>::type;
+			const U limit = negative ? static_cast<U>(U(0) - static_cast<U>(std::numeric_limits<T>::min()))
+									 : static_cast<U>(std::numeric_limits<T>::max());
+			const char* p = first;
+			U u = 0;
+			bool overflow = false;
+		#ifdef CUTIL_CPU_LITTLE_ENDIAN
+			if (base == 10 && sizeof(U) >= 4) // 8 digits do not fit into smaller types
+			{
+				while (last - p >= 8)
+				{
+					uint64_t chunk;
+					std::memcpy(&chunk, p, sizeof(chunk));
+					if (!is_eight_digits(chunk))
+					{
+						break;
+					}
+					const U eight = static_cast<U>(parse_eight_digits(chunk));
+					if (eight > limit || u > static_cast<U>((limit - eight) / 100000000u))
+					{
+						overflow = true;
+					}
+					u = static_cast<U>(u * 100000000u + eight);
+					p += 8;
+				}
+			}
+		#endif
+			const U ubase = static_cast<U>(base);
+			const U limit_div = static_cast<U>(limit / ubase);
+			const U limit_mod = static_cast<U>(limit % ubase);
+			for (; p != last; ++p)
+			{
+				const uint8_t d = digit_value(*p);
+				if (d >= base)
+				{
+					break;
+				}
+				if (u > limit_div || (u == limit_div && d > limit_mod))
+				{
+					overflow = true;
+				}
+				u = static_cast<U>(u * ubase + d);
+			}
+			if (p == first)
+			{
+				return {first, std::errc::invalid_argument};
+			}
+			if (overflow)
+			{
+				return {p, std::errc::result_out_of_range};
+			}
+			value = negative ? static_cast<T>(static_cast<U>(U(0) - u)) : static_cast<T>(u);
+			return {p, std::errc()};
+		}
+	}
+	
+	/**
+	 * @brief Parses an integer from the beginning of [first, last) without throwing, like `std::from_chars()`.
+	 *        Decimal input is converted 8 digits at a time (SWAR), and range is checked without widening.
+	 * @param first, last - the input; no leading spaces, '+' or base prefix ("0x") is accepted.
+	 * @param value - receives the result, untouched on failure.
+	 * @param base - 2 to 36.
+	 * @return `{ptr, ec}`, check `ptr == last` to require the whole input to be consumed.
+	 * @note '-' is only accepted for signed types.
+	 */
+	template<typename T, typename std::enable_if<internal::is_integral<T>::value, bool>::type = false>
+		_CUTIL_FUNC_STATIC inline
+	parse_result parse_integer(const char* first, const char* last, T& value, int base = 10) noexcept
+	{
+		if (base < 2 || base > 36)
+		{
+			return {first, std::errc::invalid_argument};
+		}
+		const bool negative = std::is_signed<T>::value && first != last && *first == '-';
+		parse_result res = internal::parse_integer_magnitude(first + negative, last, negative, base, value);
+		if (res.ec == std::errc::invalid_argument)
+		{
+			res.ptr = first;
+		}
+		return res;
 	}
 	
+	/**
+	 * @brief Parses a whole string as an integer without throwing, see `parse_integer()`.
+	 * @return `std::errc()` on success, `std::errc::invalid_argument` if the string is not entirely a number,
+	 *         or `std::errc::result_out_of_range`.
+	 */
+	template<typename T, typename std::enable_if<internal::is_integral<T>::value, bool>::type = false>
+		_CUTIL_FUNC_STATIC inline
+	std::errc parse_integer_exact(const std::string & str, T& value, int base = 10) noexcept
+	{
+		const char* last = str.data() + str.size();
+		T result = T();
+		const parse_result res = parse_integer(str.data(), last, result, base);
+		if (res.ec != std::errc())
+		{
+			return res.ec;
+		}
+		if (res.ptr != last)
+		{
+			return std::errc::invalid_argument;
+		}
+		value = result;
+		return std::errc();
+	}
+	
+	/**
+	 * @brief Parses a whole string as a floating-point number without throwing, see `parse_float()`.
+	 * @return `std::errc()` on success, `std::errc::invalid_argument` if the string is not entirely a number,
+	 *         or `std::errc::result_out_of_range`.
+	 */
+	template<typename T, typename std::enable_if<std::is_floating_point<T>::value, bool>::type = false>
+		_CUTIL_FUNC_STATIC inline
+	std::errc parse_float_exact(const std::string & str, T& value) noexcept
+	{
+		const char* last = str.data() + str.size();
+		T result = T();
+		const parse_result res = parse_float(str.data(), last, result);
+		if (res.ec != std::errc())
+		{
+			return res.ec;
+		}
+		if (res.ptr != last)
+		{
+			return std::errc::invalid_argument;
+		}
+		value = result;
+		return std::errc();
+	}
+/*
+	int32_t value = 0;
+	auto res = cutil::str::parse_integer(str.data(), str.data() + str.size(), value);
+	if (res.ec == std::errc() && res.ptr == str.data() + str.size()) { ... } // whole string is a number
+	
+	if (cutil::str::parse_integer_exact("ff", value, 16) == std::errc()) { ... } // value = 255
+	
+	double d = 0;
+	cutil::str::parse_float_exact("5.245f", d);	// -> std::errc::invalid_argument, d untouched
+*/
+	
+	
+	namespace internal{
+		//* conversion strategy of `to_string()` / `parse_string()` for a datatype
+		struct conv_stream_tag {};	// user types, through operator<< and operator>>
+		struct conv_bool_tag {};	// "1" / "0", like a stream without `std::boolalpha`
+		struct conv_char_tag {};	// a single character, like a stream does for char types
+		struct conv_int_tag {};
+		struct conv_float_tag {};
+		
+		template <typename T>
+		struct is_char_like : std::integral_constant<bool
+					, std::is_same<T, char>::value || std::is_same<T, signed char>::value || std::is_same<T, unsigned char>::value
+				> {};
+		
+		template <typename T>
+		struct is_plain_integer : std::integral_constant<bool
+					, is_integral<T>::value && !is_char_like<T>::value
+					&& !std::is_same<T, wchar_t>::value && !std::is_same<T, char16_t>::value && !std::is_same<T, char32_t>::value
+				#ifdef CUTIL_CPP20_SUPPORTED
+					&& !std::is_same<T, char8_t>::value
+				#endif
+				> {};
+		
+		template <typename T>
+		using conv_tag = typename std::conditional<std::is_same<T, bool>::value, conv_bool_tag
+						, typename std::conditional<is_char_like<T>::value, conv_char_tag
+						, typename std::conditional<is_plain_integer<T>::value, conv_int_tag
+						, typename std::conditional<is_floating_point<T>::value, conv_float_tag
+						, conv_stream_tag>::type>::type>::type>::type;
+		
+		//* `%g` with 6 significant digits, the default format of `std::ostream`, kept for long double
+		inline char* float_to_chars_general(char* first, char* last, long double value)
+		{
+		#ifdef CUTIL_CPP17_SUPPORTED
+			return std::to_chars(first, last, value, std::chars_format::general, 6).ptr;
+		#else
+			const int n = std::snprintf(first, static_cast<size_t>(last - first), "%.6Lg", value);
+			return first + n;
+		#endif
+		}
+		
+		template <typename T>
+		inline char* to_chars(char* first, char* /*last*/, T value, conv_bool_tag)
+		{
+			*first = value ? '1' : '0';
+			return first + 1;
+		}
+		template <typename T>
+		inline char* to_chars(char* first, char* /*last*/, T value, conv_char_tag)
+		{
+			*first = static_cast<char>(value);
+			return first + 1;
+		}
+		template <typename T>
+		inline char* to_chars(char* first, char* last, T value, conv_int_tag)
+		{
+			return number_to_chars(first, last, value);
+		}
+		inline char* to_chars(char* first, char* last, float value, conv_float_tag) { return float_to_chars(first, last, value); }
+		inline char* to_chars(char* first, char* last, double value, conv_float_tag) { return float_to_chars(first, last, value); }
+		inline char* to_chars(char* first, char* last, long double value, conv_float_tag) { return float_to_chars_general(first, last, value); }
+		
+		template <typename T, typename Tag>
+		inline std::string to_string(const T& value, Tag tag)
+		{
+			char buf[number_buffer_size];
+			return std::string(buf, internal::to_chars(buf, buf + sizeof(buf), value, tag));
+		}
+		template <typename T>
+		inline std::string to_string(const T& value, conv_stream_tag)
+		{
+			std::stringstream ss;
+			ss << value;
+			return ss.str();
+		}
+		
+		inline const char* skip_spaces(const char* first, const char* last)
+		{
+			while (first != last && std::isspace(static_cast<uint8_t>(*first)))
+			{
+				++first;
+			}
+			return first;
+		}
+		
+		template <typename T>
+		inline T parse_chars(const char* first, const char* last, conv_int_tag)
+		{
+			first = skip_spaces(first, last);
+			if (last - first > 1 && first[0] == '+' && first[1] != '-')
+			{
+				++first; // `std::from_chars()` rejects the plus sign
+			}
+			T result = T();
+			const parse_result res = cutil::str::parse_integer(first, last, result);
+			if (res.ec == std::errc::result_out_of_range) // saturate, like a stream does
+			{
+				return (*first == '-') ? std::numeric_limits<T>::min() : std::numeric_limits<T>::max();
+			}
+			return result;
+		}
+		template <typename T>
+		inline T parse_chars(const char* first, const char* last, conv_bool_tag)
+		{
+			return parse_chars<int>(first, last, conv_int_tag()) == 1;
+		}
+		template <typename T>
+		inline T parse_chars(const char* first, const char* last, conv_char_tag)
+		{
+			first = skip_spaces(first, last);
+			return first != last ? static_cast<T>(*first) : T();
+		}
+		template <typename T>
+		inline T parse_chars(const char* first, const char* last, conv_float_tag)
+		{
+			first = skip_spaces(first, last);
+			if (last - first > 1 && first[0] == '+' && first[1] != '-')
+			{
+				++first;
+			}
+			T result = T();
+			cutil::str::parse_float(first, last, result);
+			return result;
+		}
+		template <typename T>
+		inline T parse_chars(const char* first, const char* last, conv_stream_tag)
+		{
+			T result;
+			std::istringstream(std::string(first, last)) >> result;
+			return result;
+		}
+	}
 	
 	/**
 	 * @brief Converts any datatype into std::string.
-	 *        Datatype must support << operator.
+	 *        Arithmetic types are formatted into a stack buffer, without locale.
+	 *        Integers give the same text as `std::ostream` would; float and double give the shortest text
+	 *        that reads back to the same value (`cutil::str::float_to_chars()`), long double keeps the 6 digits of a stream.
+	 *        Other datatypes must support << operator.
 	 * @tparam T
 	 * @param value - will be converted into std::string.
 	 * @return Converted value as std::string.
 	 */
-	template<typename T> _CUTIL_FUNC_STATIC
+	template<typename T> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
 	inline std::string to_string(T value)
 	{
-		std::stringstream ss;
-		ss << value;
-		return ss.str();
+		return internal::to_string(value, internal::conv_tag<T>());
 	}
-
+	
+	/**
+	 * @brief Converts arithmetic value into caller's buffer, with the same text as `to_string()`.
+	 * @tparam T - arithmetic datatype.
+	 * @param value - will be converted.
+	 * @param buf - destination buffer.
+	 * @param size - size of the buffer.
+	 * @return Length of the text, or 0 if the buffer is too small. '\0' is appended if there is room left.
+	 */
+	template<typename T, typename std::enable_if<std::is_arithmetic<T>::value, bool>::type = false>
+		_CUTIL_FUNC_STATIC inline
+	size_t to_string(T value, char* buf, size_t size)
+	{
+		char tmp[internal::number_buffer_size];
+		const char* end = internal::to_chars(tmp, tmp + sizeof(tmp), value, internal::conv_tag<T>());
+		const size_t len = static_cast<size_t>(end - tmp);
+		if (len > size)
+		{
+			return 0;
+		}
+		std::copy(tmp, tmp + len, buf);
+		if (len < size)
+		{
+			buf[len] = '\0';
+		}
+		return len;
+	}
+	
 	/**
 	 * @brief Converts std::string into any datatype.
-	 *        Datatype must support << operator.
+	 *        Arithmetic types are parsed with `cutil::str::parse_integer()` / `cutil::str::parse_float()`, without locale.
+	 *        Like a stream, leading spaces and trailing characters are ignored, and an overflowed integer saturates.
+	 *        Other datatypes must support >> operator.
 	 * @tparam T
 	 * @param str - std::string that will be converted into datatype T.
-	 * @return Variable of datatype T.
+	 * @return Variable of datatype T, or T() if the string does not start with a valid value.
 	 */
-	template<typename T> _CUTIL_FUNC_STATIC
+	template<typename T> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
 	inline T parse_string(const std::string & str)
 	{
-		T result;
-		std::istringstream(str) >> result;
-		return result;
+		return internal::parse_chars<T>(str.data(), str.data() + str.size(), internal::conv_tag<T>());
+	}
+	template<typename T> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
+	inline T parse_string(const char* str)
+	{
+		return internal::parse_chars<T>(str, str + std::char_traits<char>::length(str), internal::conv_tag<T>());
+	}
+	template<typename T> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
+	inline T parse_string(const char* data, size_t size)
+	{
+		return internal::parse_chars<T>(data, data + size, internal::conv_tag<T>());
 	}
 /*
 	EXPECT_EQ(-255, cutil::str::parse_string<long int>("-255"));
 	EXPECT_EQ("5.245", cutil::str::to_string<float>(5.245f));
+	
+	char buf[32];
+	size_t len = cutil::str::to_string(-255, buf, sizeof(buf)); // -> 4, buf = "-255"
 */
 	
 	
@@ -357,7 +968,7 @@ namespace str
 
 	/**
 	 * @brief Replaces (in-place) all occurrences of target with replacement.
-	 *        Taken from: http://stackoverflow.com/questions/3418231/c-replace-part-of-a-string-with-another-string.
+	 *        Matches are counted first, so the result is sized once and built in a single pass.
 	 * @param str - input std::string that will be modified.
 	 * @param target - substring that will be replaced with replacement.
 	 * @param replacement - substring that will replace target.
@@ -370,14 +981,285 @@ namespace str
 		{
 			return false;
 		}
-		size_t start_pos = 0;
-		const bool found_substring = str.find(target, start_pos) != std::string::npos;
-		while ((start_pos = str.find(target, start_pos)) != std::string::npos)
+		const size_t first_pos = str.find(target);
+		if (first_pos == std::string::npos)
+		{
+			return false;
+		}
+		const size_t target_len = target.length();
+		if (target_len == replacement.length()) // same length, overwrite in-place
+		{
+			for (size_t pos = first_pos; pos != std::string::npos; pos = str.find(target, pos + target_len))
+			{
+				std::copy(replacement.begin(), replacement.end(), str.begin() + pos);
+			}
+			return true;
+		}
+		size_t count = 0;
+		for (size_t pos = first_pos; pos != std::string::npos; pos = str.find(target, pos + target_len))
+		{
+			++count;
+		}
+		std::string result;
+		result.reserve(str.length() - count * target_len + count * replacement.length());
+		size_t last_pos = 0;
+		for (size_t pos = first_pos; pos != std::string::npos; pos = str.find(target, pos + target_len))
+		{
+			result.append(str, last_pos, pos - last_pos);
+			result.append(replacement);
+			last_pos = pos + target_len;
+		}
+		result.append(str, last_pos, std::string::npos);
+		str.swap(result);
+		return true;
+	}
+	
+	
+	namespace internal{
+		//* Aho-Corasick automaton, compiled into a dense DFA over byte equivalence classes.
+		//  bytes that do not appear in any pattern share class 0, so a row only has (distinct pattern bytes + 1) cells.
+		//  a second DFA over the reversed patterns gives the longest pattern starting at each position,
+		//  so leftmost-longest matching reads every byte a bounded number of times, however patterns overlap.
+		class aho_corasick {
+		public:
+			static constexpr uint32_t no_pattern = 0xFFFFFFFFu;
+			
+			aho_corasick() = default;
+			
+			//* `Iter` dereferences to anything with `data()` and `size()`; empty patterns are ignored.
+			//  for duplicated patterns, the first one wins.
+			//  if `ignore_case`, bytes are folded with `std::tolower()` like `compare_ignore_case()` does.
+			template<typename Iter>
+			void build(Iter first, Iter last, bool ignore_case = false)
+			{
+				lens_.clear();
+				max_len_ = 0;
+				class_of_.fill(0);
+				num_classes_ = 1;
+				const auto fold = [ignore_case](uint8_t c) -> uint8_t {
+					return ignore_case ? static_cast<uint8_t>(std::tolower(c)) : c;
+				};
+				for (Iter it = first; it != last; ++it)
+				{
+					const auto* p = reinterpret_cast<const uint8_t*>(it->data());
+					for (size_t i = 0; i < it->size(); ++i)
+					{
+						const uint8_t c = fold(p[i]);
+						if (class_of_[c] == 0)
+						{
+							class_of_[c] = static_cast<uint16_t>(num_classes_++);
+						}
+					}
+					lens_.push_back(it->size());
+					max_len_ = std::max(max_len_, it->size());
+				}
+				if (ignore_case)
+				{
+					for (size_t c = 0; c < class_of_.size(); ++c)
+					{
+						class_of_[c] = class_of_[fold(static_cast<uint8_t>(c))];
+					}
+				}
+				build_dfa(forward_, first, last, false);
+				build_dfa(backward_, first, last, true);
+			}
+			
+			_CUTIL_NODISCARD bool empty() const { return max_len_ == 0; }
+			_CUTIL_NODISCARD size_t pattern_count() const { return lens_.size(); }
+			_CUTIL_NODISCARD size_t pattern_size(uint32_t id) const { return lens_[id]; }
+			
+			//* true if any pattern occurs in the text, stops at the first one found.
+			_CUTIL_NODISCARD bool contains(const char* data, size_t size) const
+			{
+				if (empty())
+				{
+					return false;
+				}
+				const auto* p = reinterpret_cast<const uint8_t*>(data);
+				uint32_t state = 0;
+				for (size_t i = 0; i < size; ++i)
+				{
+					state = forward_.trans[state * num_classes_ + class_of_[p[i]]];
+					if (forward_.out[state] != no_pattern)
+					{
+						return true;
+					}
+				}
+				return false;
+			}
+			
+			//* calls `on_match(start, pattern_id)` for every leftmost-longest, non-overlapping match, in order.
+			//  the text goes block by block: the reversed DFA runs backwards over the block, from `max_len_ - 1` bytes
+			//  past its end, and leaves the longest pattern starting at each position; then matches are picked greedily.
+			template<typename Func>
+			void scan(const char* data, size_t size, Func&& on_match) const
+			{
+				if (empty() || size == 0)
+				{
+					return;
+				}
+				const auto* p = reinterpret_cast<const uint8_t*>(data);
+				const size_t block = std::max(size_t(16 * 1024), max_len_ * 4); // bytes read at most 1.25 times
+				std::vector<uint32_t> longest(std::min(size, block));
+				size_t pos = 0;
+				for (size_t first = 0; first < size; first += block)
+				{
+					const size_t last = std::min(size, first + block);
+					uint32_t state = 0;
+					for (size_t j = std::min(size, last + max_len_ - 1); j > last; --j)
+					{
+						state = backward_.trans[state * num_classes_ + class_of_[p[j - 1]]];
+					}
+					for (size_t j = last; j > first; --j)
+					{
+						state = backward_.trans[state * num_classes_ + class_of_[p[j - 1]]];
+						longest[j - 1 - first] = backward_.out[state];
+					}
+					while (pos < last) // a match may have carried `pos` past this block already
+					{
+						const uint32_t id = longest[pos - first];
+						if (id == no_pattern)
+						{
+							++pos;
+							continue;
+						}
+						on_match(pos, id);
+						pos += lens_[id];
+					}
+				}
+			}
+		
+		private:
+			struct dfa {
+				std::vector<uint32_t> trans; // row-major, `num_classes_` cells per state
+				std::vector<uint32_t> out;   // longest pattern that is a suffix of the text spelled by each state
+			};
+			
+			std::array<uint16_t, 256> class_of_{}; // up to 257 classes: class 0 is "in no pattern"
+			uint32_t num_classes_ = 1;
+			dfa forward_;
+			dfa backward_; // over the reversed patterns
+			std::vector<size_t> lens_;
+			size_t max_len_ = 0;
+			
+			template<typename Iter>
+			void build_dfa(dfa& a, Iter first, Iter last, bool reversed) const
+			{
+				//* trie, 0 means "no child" here since the root is never a child
+				a.trans.assign(num_classes_, 0);
+				a.out.assign(1, uint32_t(no_pattern));
+				uint32_t id = 0;
+				for (Iter it = first; it != last; ++it, ++id)
+				{
+					const auto* p = reinterpret_cast<const uint8_t*>(it->data());
+					const size_t len = it->size();
+					if (len == 0)
+					{
+						continue;
+					}
+					uint32_t state = 0;
+					for (size_t i = 0; i < len; ++i)
+					{
+						const uint8_t c = reversed ? p[len - 1 - i] : p[i];
+						uint32_t& next = a.trans[state * num_classes_ + class_of_[c]];
+						if (next == 0)
+						{
+							next = static_cast<uint32_t>(a.out.size());
+							a.out.push_back(uint32_t(no_pattern));
+							a.trans.resize(a.trans.size() + num_classes_, 0);
+						}
+						state = a.trans[state * num_classes_ + class_of_[c]]; // `next` may dangle after resize
+					}
+					if (a.out[state] == no_pattern)
+					{
+						a.out[state] = id;
+					}
+				}
+				
+				//* BFS over the trie, filling missing transitions from the failure state
+				std::vector<uint32_t> fail(a.out.size(), 0);
+				std::vector<uint32_t> queue;
+				queue.reserve(a.out.size());
+				for (uint32_t c = 0; c < num_classes_; ++c)
+				{
+					if (a.trans[c] != 0)
+					{
+						queue.push_back(a.trans[c]);
+					}
+				}
+				for (size_t head = 0; head < queue.size(); ++head)
+				{
+					const uint32_t u = queue[head];
+					const uint32_t f = fail[u];
+					if (a.out[u] == no_pattern)
+					{
+						a.out[u] = a.out[f];
+					}
+					for (uint32_t c = 0; c < num_classes_; ++c)
+					{
+						uint32_t& v = a.trans[u * num_classes_ + c];
+						if (v != 0)
+						{
+							fail[v] = a.trans[f * num_classes_ + c];
+							queue.push_back(v);
+						}
+						else
+						{
+							v = a.trans[f * num_classes_ + c];
+						}
+					}
+				}
+			}
+		};
+	}
+	
+	/**
+	 * @brief Replaces (in-place) all occurrences of every `from` in the table with its `to`, in a single scan.
+	 *        Uses one Aho-Corasick automaton, so the string is not rescanned for each pattern.
+	 * @param str - input std::string that will be modified.
+	 * @param table - list of {from, to} pairs. empty `from` is ignored, and for duplicated `from`, the first pair wins.
+	 * @return True if at least one replacement was done, false otherwise.
+	 * @note Matching is leftmost-longest and non-overlapping, replaced text is never scanned again.
+	 */
+	_CUTIL_FUNC_STATIC inline
+	bool replace_all_multi(std::string & str, const std::vector<std::pair<std::string, std::string>> & table)
+	{
+		struct from_view {
+			const std::string* s;
+			const char* data() const { return s->data(); }
+			size_t size() const { return s->size(); }
+		};
+		std::vector<from_view> froms;
+		froms.reserve(table.size());
+		for (const auto& each : table)
+		{
+			froms.push_back({&each.first});
+		}
+		internal::aho_corasick ac;
+		ac.build(froms.begin(), froms.end());
+		
+		std::vector<std::pair<size_t, uint32_t>> matches;
+		size_t result_len = str.length();
+		ac.scan(str.data(), str.length(), [&](size_t start, uint32_t id){
+			matches.emplace_back(start, id);
+			result_len = result_len - table[id].first.length() + table[id].second.length();
+		});
+		if (matches.empty())
+		{
+			return false;
+		}
+		std::string result;
+		result.reserve(result_len);
+		size_t last_pos = 0;
+		for (const auto& m : matches)
 		{
-			str.replace(start_pos, target.length(), replacement);
-			start_pos += replacement.length();
+			result.append(str, last_pos, m.first - last_pos);
+			result.append(table[m.second].second);
+			last_pos = m.first + table[m.second].first.length();
 		}
-		return found_substring;
+		result.append(str, last_pos, std::string::npos);
+		str.swap(result);
+		return true;
 	}
 /*
     std::string str1 = "This is $name and that is also $name.";
@@ -389,24 +1271,101 @@ namespace str
 	bool res2 = cutil::str::replace_all(str1, "$name", "Jon Doe");
 	EXPECT_EQ(true, res2);
 	EXPECT_EQ("This is Jon Doe and that is also Jon Doe.", str2);
+	
+	std::string str3 = "<a href=\"x\">&</a>";
+	cutil::str::replace_all_multi(str3, {{"&", "&amp;"}, {"<", "&lt;"}, {">", "&gt;"}, {"\"", "&quot;"}});
+	EXPECT_EQ("&lt;a href=&quot;x&quot;&gt;&amp;&lt;/a&gt;", str3);
 */
 
-
-
-
-
 	/**
-	 * @brief Checks if std::string str ends with specified suffix.
-	 * @param str - input std::string that will be checked.
-	 * @param suffix - searched suffix in str.
-	 * @return True if suffix was found, false otherwise.
+	 * @brief Compiled multi-pattern matcher, checks a text against many keywords in one pass.
+	 *        Built once as an Aho-Corasick DFA with packed transitions over byte classes,
+	 *        then the text is scanned in O(length) no matter how many patterns there are.
+	 *        All query functions are const, so one matcher can be shared by many threads.
+	 * @note  `find_all()` and `count()` report leftmost-longest, non-overlapping matches, like `replace_all_multi()`,
+	 *        still in O(length) when one pattern is a prefix of a much longer one.
 	 */
-	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
-	bool ends_with(const std::string & str, const std::string & suffix)
-	{
-		const auto suffix_start = str.size() - suffix.size();
-		const auto result = str.find(suffix, suffix_start);
-		return (result == suffix_start) && (result != std::string::npos);
+	class multi_matcher {
+	public:
+		struct match {
+			size_t pos;		// start offset in the text
+			size_t len;		// length of the matched text
+			size_t pattern;	// index of the pattern in the list passed to the constructor
+		};
+		
+		multi_matcher() = default;
+		
+		/**
+		 * @param patterns - keywords to search for, empty ones are ignored.
+		 * @param ignore_case - compare like `compare_ignore_case()` does.
+		 */
+		explicit multi_matcher(const std::vector<std::string> & patterns, bool ignore_case = false)
+		{
+			ac_.build(patterns.begin(), patterns.end(), ignore_case);
+		}
+		
+		_CUTIL_NODISCARD size_t pattern_count() const { return ac_.pattern_count(); }
+		
+		_CUTIL_NODISCARD bool contains_any(const char* data, size_t size) const
+		{
+			return ac_.contains(data, size);
+		}
+		_CUTIL_NODISCARD bool contains_any(const std::string & str) const
+		{
+			return ac_.contains(str.data(), str.size());
+		}
+		
+		_CUTIL_NODISCARD std::vector<match> find_all(const char* data, size_t size) const
+		{
+			std::vector<match> result;
+			ac_.scan(data, size, [&](size_t start, uint32_t id){
+				result.push_back({start, ac_.pattern_size(id), id});
+			});
+			return result;
+		}
+		_CUTIL_NODISCARD std::vector<match> find_all(const std::string & str) const
+		{
+			return find_all(str.data(), str.size());
+		}
+		
+		_CUTIL_NODISCARD size_t count(const char* data, size_t size) const
+		{
+			size_t result = 0;
+			ac_.scan(data, size, [&result](size_t, uint32_t){ ++result; });
+			return result;
+		}
+		_CUTIL_NODISCARD size_t count(const std::string & str) const
+		{
+			return count(str.data(), str.size());
+		}
+	
+	private:
+		internal::aho_corasick ac_;
+	};
+	
+/*
+	const cutil::str::multi_matcher keywords({"error", "fatal", "timeout"}, true); // ignore case
+	keywords.contains_any("[WARN] connection TIMEOUT");	// -> true
+	keywords.count("Fatal error: timeout"); 			// -> 3
+	auto found = keywords.find_all("fatal error");		// -> { {0, 5, 1}, {6, 5, 0} }
+*/
+
+
+
+
+
+	/**
+	 * @brief Checks if std::string str ends with specified suffix.
+	 * @param str - input std::string that will be checked.
+	 * @param suffix - searched suffix in str.
+	 * @return True if suffix was found, false otherwise.
+	 */
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	bool ends_with(const std::string & str, const std::string & suffix)
+	{
+		const auto suffix_start = str.size() - suffix.size();
+		const auto result = str.find(suffix, suffix_start);
+		return (result == suffix_start) && (result != std::string::npos);
 	}
 
 	/**
@@ -585,6 +1544,8 @@ namespace str
 	 * @param rgx_str - the set of delimiter characters.
 	 * @return True if the parsing is successfully done.
 	 * @note space around the delimiter will be trimmed.
+	 * @note for `[section] key = value;` configs, `cutil::str::ini_config` in <ConsoleUtil/CppIniParser.hpp>
+	 *       parses them in one pass into views (>= C++17).
 	 */
 	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
 	std::map<std::string, std::string> regex_split_map(const std::string& src, const std::string& rgx_str)
@@ -644,36 +1605,361 @@ namespace str
 
 
 
-    /**
-     * @brief Joins all elements of a container of arbitrary datatypes
-     *        into one std::string with delimiter delim.
-     * @tparam Container - container type. (std::vector, std::set, std::list, ...)
-     * @param tokens - container of tokens.
-     * @param delim - the delimiter.
-     * @return std::string with joined elements of container tokens with delimiter delim.
-     */
-    template<typename Container> _CUTIL_FUNC_STATIC
-    inline std::string join(const Container & tokens, const std::string & delim)
-    {
-        std::ostringstream result;
-        for(auto it = tokens.begin(); it != tokens.end(); ++it)
-        {
-            if(it != tokens.begin())
-            {
-                result << delim;
-            }
-
-            result << *it;
-        }
-
-        return result.str();
-    }
+	namespace internal{
+		struct identity_projection {
+			template<typename T>
+			const T& operator()(const T& value) const { return value; }
+		};
+		
+		//* size of one joined element, and appending it. numbers are formatted with `to_chars()`
+		template<typename T, typename std::enable_if<is_string_like<T>::value, bool>::type = false>
+		inline size_t joined_size(const T& value) { return make_str_ref(value).size; }
+		template<typename T, typename std::enable_if<is_string_like<T>::value, bool>::type = false>
+		inline void append_joined(std::string& dest, const T& value)
+		{
+			const str_ref ref = make_str_ref(value);
+			dest.append(ref.data, ref.size);
+		}
+		
+		inline size_t joined_size(char) { return 1; }
+		inline void append_joined(std::string& dest, char value) { dest.push_back(value); }
+		
+		template<typename T, typename std::enable_if<is_arithmetic<T>::value && !std::is_same<T, char>::value, bool>::type = false>
+		inline size_t joined_size(T value)
+		{
+			char buf[number_buffer_size];
+			return static_cast<size_t>(number_to_chars(buf, buf + sizeof(buf), value) - buf);
+		}
+		template<typename T, typename std::enable_if<is_arithmetic<T>::value && !std::is_same<T, char>::value, bool>::type = false>
+		inline void append_joined(std::string& dest, T value)
+		{
+			char buf[number_buffer_size];
+			dest.append(buf, number_to_chars(buf, buf + sizeof(buf), value));
+		}
+		
+		//* measures the exact output first, so `dest` grows at most once
+		template<typename Container, typename Projection>
+		inline void join_append(std::string& dest, const Container& tokens, const std::string& delim, Projection&& proj)
+		{
+			size_t total = 0;
+			size_t count = 0;
+			for (const auto& each : tokens)
+			{
+				total += joined_size(proj(each));
+				++count;
+			}
+			if (count == 0)
+			{
+				return;
+			}
+			dest.reserve(dest.size() + total + (count - 1) * delim.size());
+			bool first = true;
+			for (const auto& each : tokens)
+			{
+				if (!first)
+				{
+					dest.append(delim);
+				}
+				first = false;
+				append_joined(dest, proj(each));
+			}
+		}
+		
+		template<typename Container>
+		inline std::string join(const Container& tokens, const std::string& delim, std::true_type /* string-like */)
+		{
+			std::string result;
+			internal::join_append(result, tokens, delim, identity_projection());
+			return result;
+		}
+		template<typename Container>
+		inline std::string join(const Container& tokens, const std::string& delim, std::false_type /* operator<< */)
+		{
+			std::ostringstream result;
+			for(auto it = tokens.begin(); it != tokens.end(); ++it)
+			{
+				if(it != tokens.begin())
+				{
+					result << delim;
+				}
+				result << *it;
+			}
+			return result.str();
+		}
+	}
+	
+	/**
+	 * @brief Joins all elements of a container of arbitrary datatypes
+	 *        into one std::string with delimiter delim.
+	 *        String-like elements (std::string, std::string_view, const char*) are measured first
+	 *        and copied into a single allocation; other datatypes are written with operator<<.
+	 * @tparam Container - container type. (std::vector, std::set, std::list, ...)
+	 * @param tokens - container of tokens.
+	 * @param delim - the delimiter.
+	 * @return std::string with joined elements of container tokens with delimiter delim.
+	 */
+	template<typename Container> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
+	inline std::string join(const Container & tokens, const std::string & delim)
+	{
+		using value_type = typename std::decay<decltype(*tokens.begin())>::type;
+		return internal::join(tokens, delim, internal::is_string_like<value_type>());
+	}
+	
+	/**
+	 * @brief Joins all elements of a container through a projection, with a single allocation.
+	 * @param tokens - container of tokens.
+	 * @param delim - the delimiter.
+	 * @param proj - maps each element to a string-like value, a char, or a number (formatted with `to_chars()`).
+	 *               it is called twice per element (measure, then write), so it should be cheap and pure.
+	 * @return std::string with joined projected elements of container tokens with delimiter delim.
+	 */
+	template<typename Container, typename Projection> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
+	inline std::string join(const Container & tokens, const std::string & delim, Projection && proj)
+	{
+		std::string result;
+		internal::join_append(result, tokens, delim, std::forward<Projection>(proj));
+		return result;
+	}
+	
+	/**
+	 * @brief Appends all string-like elements of a container to an existing buffer, with delimiter delim.
+	 *        The buffer grows at most once, and is reusable across calls.
+	 * @param dest - the buffer to append to.
+	 * @param tokens - container of string-like tokens (std::string, std::string_view, const char*).
+	 * @param delim - the delimiter.
+	 */
+	template<typename Container> _CUTIL_FUNC_STATIC
+	inline void join_append(std::string & dest, const Container & tokens, const std::string & delim)
+	{
+		internal::join_append(dest, tokens, delim, internal::identity_projection());
+	}
+	
+	/**
+	 * @brief Appends all elements of a container through a projection to an existing buffer, see `join()`.
+	 */
+	template<typename Container, typename Projection> _CUTIL_FUNC_STATIC
+	inline void join_append(std::string & dest, const Container & tokens, const std::string & delim, Projection && proj)
+	{
+		internal::join_append(dest, tokens, delim, std::forward<Projection>(proj));
+	}
 /*
 	std::vector<std::string> tokens = { "abc", "def", "ghi" };
 	EXPECT_EQ("abc,def,ghi", cutil::str::join(tokens, ","));
 	
 	std::set<std::string> tokens_set = { "abc", "def", "ghi" };
 	EXPECT_EQ("abc,def,ghi", cutil::str::join(tokens_set, ","));
+	
+	std::vector<std::pair<std::string, int>> items = { {"a", 1}, {"b", 2} };
+	EXPECT_EQ("1,2", cutil::str::join(items, ",", [](const auto& p){ return p.second; }));
+	
+	std::string line = "keys: ";
+	cutil::str::join_append(line, tokens, ", "); // -> "keys: abc, def, ghi"
+*/
+	
+	
+	/**
+	 * @brief Builds a string from chained appends in one reusable buffer, instead of `a + b + to_string(c)` temporaries.
+	 *        Strings, chars and numbers are appended with the same text as `to_string()` (numbers through `to_chars()`, no locale),
+	 *        other datatypes through operator<<. Console style macros are string literals, so `<< FRed << "error" << CRst` works.
+	 *        The buffer grows geometrically, `release()` moves it out as a `std::string` without copying.
+	 * @note  To size the buffer up front: pass a size hint, use `append_all()` to measure a chain before writing it,
+	 *        or `build_exact()` to run a whole writer twice, once counting and once into an exact allocation.
+	 */
+	class string_builder {
+	public:
+		string_builder() = default;
+		//* reserves `size_hint` characters
+		explicit string_builder(size_t size_hint)
+		{
+			buffer_.reserve(size_hint);
+		}
+		//* reuses the capacity of a string, e.g. one returned by `release()`; its contents are dropped
+		explicit string_builder(std::string&& buffer) noexcept : buffer_(std::move(buffer))
+		{
+			buffer_.clear();
+		}
+		
+		template<typename T>
+		string_builder& append(const T& value)
+		{
+			append_one(value, internal::is_string_like<T>());
+			return *this;
+		}
+		string_builder& append(const char* data, size_t size)
+		{
+			write(data, size);
+			return *this;
+		}
+		string_builder& append(size_t count, char c)
+		{
+			if (counting_) {
+				counted_ += count;
+			} else {
+				grow(count);
+				buffer_.append(count, c);
+			}
+			return *this;
+		}
+		template<typename T>
+		string_builder& operator<<(const T& value) { return append(value); }
+		
+		//* appends every argument, after bounding their length without formatting, so the buffer grows at most once for the chain
+		template<typename... Args>
+		string_builder& append_all(const Args&... args)
+		{
+			if (!counting_) {
+				grow(size_bound(args...));
+			}
+			append_each(args...);
+			return *this;
+		}
+		
+		//* exact length `append_all(args...)` would add
+		template<typename... Args> _CUTIL_NODISCARD
+		static size_t measure(const Args&... args)
+		{
+			string_builder counter;
+			counter.counting_ = true;
+			counter.append_each(args...);
+			return counter.counted_;
+		}
+		
+		/**
+		 * @brief Two passes of `write(string_builder&)`: the first only counts characters, the second writes them
+		 *        into a buffer allocated once with the exact size. `write` has to append the same text both times.
+		 */
+		template<typename Func> _CUTIL_NODISCARD
+		static std::string build_exact(Func&& write)
+		{
+			string_builder counter;
+			counter.counting_ = true;
+			write(counter);
+			string_builder builder(counter.counted_);
+			write(builder);
+			return builder.release();
+		}
+		
+		//* moves the text out, the builder is empty afterwards
+		_CUTIL_NODISCARD std::string release() noexcept
+		{
+			std::string result = std::move(buffer_);
+			buffer_.clear();
+			return result;
+		}
+		
+		//* drops the text, keeps the capacity
+		void clear() noexcept { buffer_.clear(); }
+		void reserve(size_t capacity) { buffer_.reserve(capacity); }
+		
+		_CUTIL_NODISCARD size_t size() const noexcept { return buffer_.size(); }
+		_CUTIL_NODISCARD size_t capacity() const noexcept { return buffer_.capacity(); }
+		_CUTIL_NODISCARD bool empty() const noexcept { return buffer_.empty(); }
+		_CUTIL_NODISCARD const char* c_str() const noexcept { return buffer_.c_str(); }
+		_CUTIL_NODISCARD const std::string& str() const noexcept { return buffer_; }
+	#ifdef CUTIL_CPP17_SUPPORTED
+		_CUTIL_NODISCARD std::string_view view() const noexcept { return buffer_; }
+	#endif
+		
+	private:
+		void append_each() {}
+		template<typename T, typename... Rest>
+		void append_each(const T& value, const Rest&... rest)
+		{
+			append_one(value, internal::is_string_like<T>());
+			append_each(rest...);
+		}
+		
+		//* upper bound of the appended length: exact for strings, the widest text for numbers, 0 for operator<< types
+		static size_t size_bound() { return 0; }
+		template<typename T, typename... Rest>
+		static size_t size_bound(const T& value, const Rest&... rest)
+		{
+			return size_bound_one(value, internal::is_string_like<T>()) + size_bound(rest...);
+		}
+		template<typename T>
+		static size_t size_bound_one(const T& value, std::true_type /* string-like */) { return internal::make_str_ref(value).size; }
+		template<typename T>
+		static size_t size_bound_one(const T&, std::false_type) { return size_bound_value<T>(internal::conv_tag<T>()); }
+		template<typename T> static size_t size_bound_value(internal::conv_bool_tag) { return 1; }
+		template<typename T> static size_t size_bound_value(internal::conv_char_tag) { return 1; }
+		template<typename T> static size_t size_bound_value(internal::conv_int_tag) { return std::numeric_limits<T>::digits10 + 2; }
+		template<typename T> static size_t size_bound_value(internal::conv_float_tag)
+		{
+			return std::is_same<T, long double>::value ? internal::number_buffer_size : float_chars_max;
+		}
+		template<typename T> static size_t size_bound_value(internal::conv_stream_tag) { return 0; }
+		
+		template<typename T>
+		void append_one(const T& value, std::true_type /* string-like */)
+		{
+			const internal::str_ref ref = internal::make_str_ref(value);
+			write(ref.data, ref.size);
+		}
+		template<typename T>
+		void append_one(const T& value, std::false_type)
+		{
+			append_value(value, internal::conv_tag<T>());
+		}
+		
+		template<typename T, typename Tag>
+		void append_value(const T& value, Tag tag)
+		{
+			char buf[internal::number_buffer_size];
+			write(buf, static_cast<size_t>(internal::to_chars(buf, buf + sizeof(buf), value, tag) - buf));
+		}
+		template<typename T>
+		void append_value(const T& value, internal::conv_stream_tag tag)
+		{
+			const std::string text = internal::to_string(value, tag);
+			write(text.data(), text.size());
+		}
+		
+		void write(const char* data, size_t size)
+		{
+			if (counting_) {
+				counted_ += size;
+				return;
+			}
+			grow(size);
+			buffer_.append(data, size);
+		}
+		
+		//* at least doubles, whatever `std::string::reserve()` of the standard library does with exact requests
+		void grow(size_t extra)
+		{
+			const size_t needed = buffer_.size() + extra;
+			if (needed > buffer_.capacity()) {
+				buffer_.reserve(std::max(needed, buffer_.capacity() * 2));
+			}
+		}
+		
+		std::string buffer_;
+		size_t counted_ = 0;	// characters seen while counting
+		bool counting_ = false;
+	};
+	
+	/**
+	 * @brief Concatenates strings, chars and numbers into one exactly sized allocation, see `string_builder`.
+	 */
+	template<typename... Args> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
+	inline std::string concat(const Args&... args)
+	{
+		string_builder builder(string_builder::measure(args...));
+		const int expand[] = {0, (builder.append(args), 0)...};
+		(void)expand;
+		return builder.release();
+	}
+/*
+	cutil::str::string_builder sb(256);									// optional size hint
+	sb << FRed << "error " << CRst << 404 << ": " << 0.5 << '\n';		// "\033[31merror \033[0m404: 0.5\n"
+	sb.append_all("line ", 12, ", column ", 7);							// measured first, grows once
+	std::string text = sb.release();									// moved out, no copy
+	
+	std::string path = cutil::str::concat(dir, '/', name, '.', index);	// one exact allocation
+	
+	std::string csv = cutil::str::string_builder::build_exact([&](cutil::str::string_builder& out) {
+		for (const auto& row : rows) { out << row.id << ',' << row.name << '\n'; }	// runs twice: count, then write
+	});
 */
 
 
@@ -781,47 +2067,902 @@ namespace str
 		// -> { "", "t1", "t2", "t4" }
 */
 
-
-
+	
+	namespace internal{
+		//* Fibonacci hashing, spreads weak hashes such as the identity `std::hash<int>`
+		inline uint64_t mix_hash(size_t hash)
+		{
+			return static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+		}
+		
+		//* open-addressing set of element indices with linear probing, the elements stay in the caller's vector.
+		//  a slot holds index + 1 (0 is empty) and 32 bits of the hash, so most mismatches never touch an element.
+		template<typename Index>
+		class index_set {
+		public:
+			explicit index_set(size_t expected = 0)
+			{
+				reset(expected);
+			}
+			
+			index_set(const index_set&) = default;
+			index_set& operator=(const index_set&) = default;
+			//* the source is left empty with fresh slots, so it can be reused
+			index_set(index_set&& other)
+				: slots_(std::move(other.slots_)), mask_(other.mask_), shift_(other.shift_)
+			{
+				other.reset(0);
+			}
+			index_set& operator=(index_set&& other)
+			{
+				if (this != &other)
+				{
+					slots_ = std::move(other.slots_);
+					mask_ = other.mask_;
+					shift_ = other.shift_;
+					other.reset(0);
+				}
+				return *this;
+			}
+			
+			//* number of slots, keep the element count at most half of it
+			_CUTIL_NODISCARD size_t capacity() const { return slots_.size(); }
+			
+			//* returns the index of an equal element already in the set, or inserts `index` and returns it
+			template<typename EqualTo>
+			Index insert(uint64_t mixed, Index index, EqualTo&& equal_to)
+			{
+				const uint32_t tag = static_cast<uint32_t>(mixed);
+				for (size_t i = static_cast<size_t>(mixed >> shift_);; i = (i + 1) & mask_)
+				{
+					slot& s = slots_[i];
+					if (s.index == 0)
+					{
+						s.index = static_cast<Index>(index + 1);
+						s.tag = tag;
+						return index;
+					}
+					if (s.tag == tag && equal_to(static_cast<Index>(s.index - 1)))
+					{
+						return static_cast<Index>(s.index - 1);
+					}
+				}
+			}
+			
+			//* lookup without inserting, `index` is only written when an equal element is found
+			template<typename EqualTo>
+			bool find(uint64_t mixed, EqualTo&& equal_to, Index& index) const
+			{
+				const uint32_t tag = static_cast<uint32_t>(mixed);
+				for (size_t i = static_cast<size_t>(mixed >> shift_);; i = (i + 1) & mask_)
+				{
+					const slot& s = slots_[i];
+					if (s.index == 0)
+					{
+						return false;
+					}
+					if (s.tag == tag && equal_to(static_cast<Index>(s.index - 1)))
+					{
+						index = static_cast<Index>(s.index - 1);
+						return true;
+					}
+				}
+			}
+			
+			//* resizes for `expected` elements, `mixed_of(index)` has to give back the hash each index was inserted with
+			template<typename MixedOf>
+			void rehash(size_t expected, MixedOf&& mixed_of)
+			{
+				std::vector<slot> old;
+				old.swap(slots_);
+				reset(expected);
+				for (const slot& entry : old)
+				{
+					if (entry.index == 0)
+					{
+						continue;
+					}
+					size_t i = static_cast<size_t>(mixed_of(static_cast<Index>(entry.index - 1)) >> shift_);
+					while (slots_[i].index != 0)
+					{
+						i = (i + 1) & mask_;
+					}
+					slots_[i] = entry;
+				}
+			}
+			
+			void clear()
+			{
+				std::fill(slots_.begin(), slots_.end(), slot{0, 0});
+			}
+			
+		private:
+			struct slot {
+				Index index;
+				uint32_t tag;
+			};
+			std::vector<slot> slots_;
+			size_t mask_;
+			int shift_;
+			
+			void reset(size_t expected)
+			{
+				size_t capacity = 16;
+				int bits = 4;
+				while (capacity < expected * 2)
+				{
+					capacity <<= 1;
+					++bits;
+				}
+				slots_.assign(capacity, slot{0, 0});
+				mask_ = capacity - 1;
+				shift_ = 64 - bits;
+			}
+		};
+		
+		template<typename Index, typename T, typename Hash, typename Equal>
+		inline void drop_duplicate_stable(std::vector<T>& tokens, Hash& hash, Equal& equal)
+		{
+			index_set<Index> seen(tokens.size());
+			size_t kept = 0;
+			for (size_t i = 0; i < tokens.size(); ++i)
+			{
+				const Index found = seen.insert(mix_hash(hash(tokens[i])), static_cast<Index>(kept)
+												, [&](Index j){ return equal(tokens[j], tokens[i]); });
+				if (found == kept)
+				{
+					if (kept != i)
+					{
+						tokens[kept] = std::move(tokens[i]);
+					}
+					++kept;
+				}
+			}
+			tokens.erase(tokens.begin() + static_cast<std::ptrdiff_t>(kept), tokens.end());
+		}
+		
+		template<typename Index, typename T, typename Hash, typename Equal>
+		inline std::vector<size_t> unique_indices(const std::vector<T>& tokens, Hash& hash, Equal& equal)
+		{
+			index_set<Index> seen(tokens.size());
+			std::vector<size_t> result;
+			for (size_t i = 0; i < tokens.size(); ++i)
+			{
+				if (seen.insert(mix_hash(hash(tokens[i])), static_cast<Index>(i)
+								, [&](Index j){ return equal(tokens[j], tokens[i]); }) == i)
+				{
+					result.push_back(i);
+				}
+			}
+			return result;
+		}
+		
+		//* hashes in parallel, then buckets the indices into shards by hash, in index order,
+		//  so each shard can keep its first occurrences independently; the survivors are compacted in order.
+		template<typename Index, typename T, typename Hash, typename Equal>
+		inline void drop_duplicate_stable_par(std::vector<T>& tokens, Hash& hash, Equal& equal)
+		{
+			const size_t shard_count = 64;
+			const auto shard_of = [](uint64_t mixed){ return static_cast<size_t>(mixed >> 24) & 63; };
+			const size_t n = tokens.size();
+			
+			std::vector<uint64_t> mixed(n);
+		#ifdef _CUTIL_STRINGUTIL_USE_PARALLEL
+			std::transform(std::execution::par, tokens.begin(), tokens.end(), mixed.begin()
+						 , [&](const T& value){ return mix_hash(hash(value)); });
+		#else
+			std::transform(tokens.begin(), tokens.end(), mixed.begin(), [&](const T& value){ return mix_hash(hash(value)); });
+		#endif
+			
+			std::vector<size_t> offsets(shard_count + 1, 0);
+			for (uint64_t m : mixed)
+			{
+				++offsets[shard_of(m) + 1];
+			}
+			for (size_t s = 0; s < shard_count; ++s)
+			{
+				offsets[s + 1] += offsets[s];
+			}
+			std::vector<Index> order(n);
+			{
+				std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+				for (size_t i = 0; i < n; ++i)
+				{
+					order[fill[shard_of(mixed[i])]++] = static_cast<Index>(i);
+				}
+			}
+			
+			std::vector<uint8_t> keep(n, 0);
+			const auto dedup_shard = [&](size_t s) {
+				index_set<Index> seen(offsets[s + 1] - offsets[s]);
+				for (size_t k = offsets[s]; k < offsets[s + 1]; ++k)
+				{
+					const Index i = order[k];
+					if (seen.insert(mixed[i], i, [&](Index j){ return equal(tokens[j], tokens[i]); }) == i)
+					{
+						keep[i] = 1;
+					}
+				}
+			};
+			std::vector<size_t> shards(shard_count);
+			for (size_t s = 0; s < shard_count; ++s)
+			{
+				shards[s] = s;
+			}
+		#ifdef _CUTIL_STRINGUTIL_USE_PARALLEL
+			std::for_each(std::execution::par, shards.begin(), shards.end(), dedup_shard);
+		#else
+			std::for_each(shards.begin(), shards.end(), dedup_shard);
+		#endif
+			
+			size_t kept = 0;
+			for (size_t i = 0; i < n; ++i)
+			{
+				if (keep[i])
+				{
+					if (kept != i)
+					{
+						tokens[kept] = std::move(tokens[i]);
+					}
+					++kept;
+				}
+			}
+			tokens.erase(tokens.begin() + static_cast<std::ptrdiff_t>(kept), tokens.end());
+		}
+		
+		//* 32-bit indices halve the table unless the vector is really that big
+		template<typename T>
+		inline bool fits_uint32_index(const std::vector<T>& tokens)
+		{
+			return tokens.size() < static_cast<size_t>(std::numeric_limits<uint32_t>::max());
+		}
+	}
+	
 	/**
-	 * @brief Creates new std::string with repeated n times substring str.
-	 * @param str - substring that needs to be repeated.
-	 * @param n - number of iterations.
-	 * @return std::string with repeated substring str.
+	 * @brief Inplace removal of all duplicates in a vector, keeping the first occurrence of each value in the original order.
+	 *        O(n) expected time: a hash set stores indices into `tokens`, so no element is copied.
+	 * @tparam T - hashable datatype.
+	 * @param tokens - vector of values.
+	 * @param hash - hash function of T, `std::hash<T>` by default.
+	 * @param equal - equality of T, `std::equal_to<T>` by default.
 	 */
-	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
-	std::string repeat(const std::string & str, size_t n)
+	template<typename T, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>> _CUTIL_FUNC_STATIC
+	inline void drop_duplicate_stable(std::vector<T>& tokens, Hash hash = Hash(), Equal equal = Equal())
 	{
-		std::string result;
-		result.reserve(str.size() * n);
-		for(size_t i = 0; i < n; ++i)
+		if (internal::fits_uint32_index(tokens))
 		{
-			result += str;
+			internal::drop_duplicate_stable<uint32_t>(tokens, hash, equal);
+		}
+		else
+		{
+			internal::drop_duplicate_stable<uint64_t>(tokens, hash, equal);
 		}
-		return result;
 	}
-
+	
 	/**
-	 * @brief Creates new std::string with repeated n times char c.
-	 * @param c - char that needs to be repeated.
-	 * @param n - number of iterations.
-	 * @return std::string with repeated char c.
+	 * @brief Indices of the first occurrence of each distinct value, in ascending order; nothing is copied.
+	 * @tparam T - hashable datatype.
+	 * @param tokens - vector of values.
+	 * @return ascending indices into `tokens`.
 	 */
-	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
-	std::string repeat(char c, size_t n)
+	template<typename T, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
+	inline std::vector<size_t> unique_indices(const std::vector<T>& tokens, Hash hash = Hash(), Equal equal = Equal())
 	{
-		return std::string(n, c);
+		return internal::fits_uint32_index(tokens) ? internal::unique_indices<uint32_t>(tokens, hash, equal)
+												   : internal::unique_indices<uint64_t>(tokens, hash, equal);
 	}
-/*
-	EXPECT_EQ("GoGoGoGo",   cutil::str::repeat("Go", 4));
-	EXPECT_EQ("ZZZZZZZZZZ", cutil::str::repeat('Z', 10));
-*/
-
-
-
+	
 	/**
-	 * @brief Checks if input std::string str matches specified reular expression regex.
-	 * @param str - std::string to be checked.
+	 * @brief Removal of all duplicates in a vector, keeping the first occurrence of each value in the original order.
+	 *        Only the distinct values are copied, once.
+	 * @tparam T - hashable datatype.
+	 * @param tokens - vector of values.
+	 * @return vector of the distinct values.
+	 */
+	template<typename T, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
+	inline std::vector<T> drop_duplicate_stable_copy(const std::vector<T>& tokens, Hash hash = Hash(), Equal equal = Equal())
+	{
+		const std::vector<size_t> indices = unique_indices(tokens, hash, equal);
+		std::vector<T> result;
+		result.reserve(indices.size());
+		for (size_t i : indices)
+		{
+			result.push_back(tokens[i]);
+		}
+		return result;
+	}
+	
+	/**
+	 * @brief Same result as `drop_duplicate_stable()`, for vectors of millions of elements:
+	 *        hashing and 64 hash shards run with `std::execution::par` (>= C++17, sequential otherwise).
+	 *        `hash` and `equal` are called concurrently.
+	 * @tparam T - hashable datatype.
+	 * @param tokens - vector of values.
+	 */
+	template<typename T, typename Hash = std::hash<T>, typename Equal = std::equal_to<T>> _CUTIL_FUNC_STATIC
+	inline void drop_duplicate_stable_par(std::vector<T>& tokens, Hash hash = Hash(), Equal equal = Equal())
+	{
+		if (tokens.size() < (size_t(1) << 15)) // not worth the threads
+		{
+			drop_duplicate_stable(tokens, hash, equal);
+		}
+		else if (internal::fits_uint32_index(tokens))
+		{
+			internal::drop_duplicate_stable_par<uint32_t>(tokens, hash, equal);
+		}
+		else
+		{
+			internal::drop_duplicate_stable_par<uint64_t>(tokens, hash, equal);
+		}
+	}
+/*
+	std::vector<std::string> str1 = { "t1", "t2", "", "t4", "", "t1"};
+	cutil::str::drop_duplicate_stable(str1);
+		// -> { "t1", "t2", "", "t4" }
+	
+	auto first = cutil::str::unique_indices(str1); // -> { 0, 1, 2, 3 }
+*/
+	
+	
+#ifdef CUTIL_CPP17_SUPPORTED
+	namespace internal{
+		//* Myers / Hyyrö bit-vector Levenshtein distance for a pattern of at most 64 chars, one text char per step.
+		//  bit i of `peq[c]` is set if pattern[i] == c. Stops early once the distance is known to exceed `max_distance`,
+		//  and then returns `max_distance + 1`.
+		inline size_t myers_distance_64(const uint64_t* peq, size_t m, std::string_view text, size_t max_distance)
+		{
+			if (m == 0) {
+				return std::min(text.size(), max_distance + 1);
+			}
+			const uint64_t last = uint64_t(1) << (m - 1);
+			uint64_t pv = ~uint64_t(0);
+			uint64_t mv = 0;
+			size_t score = m;
+			for (size_t j = 0; j < text.size(); ++j) {
+				const uint64_t eq = peq[static_cast<uint8_t>(text[j])];
+				const uint64_t xv = eq | mv;
+				const uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+				uint64_t ph = mv | ~(xh | pv);
+				uint64_t mh = pv & xh;
+				score += (ph & last) ? 1 : 0;
+				score -= (mh & last) ? 1 : 0;
+				// the last row drops by at most one per remaining text char
+				if (score > max_distance + (text.size() - j - 1)) {
+					return max_distance + 1;
+				}
+				ph = (ph << 1) | 1; // row 0 grows by one per column
+				mh <<= 1;
+				pv = mh | ~(xv | ph);
+				mv = ph & xv;
+			}
+			return std::min(score, max_distance + 1);
+		}
+		
+		//* masks of `pattern` for a single `text`: only the entries that are going to be read are written,
+		//  cheaper than clearing all 256 for short strings
+		inline void fill_peq_64(uint64_t* peq, std::string_view pattern, std::string_view text)
+		{
+			for (char c : text) {
+				peq[static_cast<uint8_t>(c)] = 0;
+			}
+			for (char c : pattern) {
+				peq[static_cast<uint8_t>(c)] = 0;
+			}
+			for (size_t i = 0; i < pattern.size(); ++i) {
+				peq[static_cast<uint8_t>(pattern[i])] |= uint64_t(1) << i;
+			}
+		}
+		
+		//* a pattern compiled once for many distance queries, in blocks of 64 chars for long patterns
+		class myers_pattern {
+		public:
+			explicit myers_pattern(std::string_view pattern)
+				: size_(pattern.size()), blocks_((pattern.size() + 63) / 64), peq_(std::max<size_t>(blocks_, 1) * 256, 0)
+			{
+				for (size_t i = 0; i < pattern.size(); ++i) {
+					peq_[(i / 64) * 256 + static_cast<uint8_t>(pattern[i])] |= uint64_t(1) << (i % 64);
+				}
+			}
+			
+			_CUTIL_NODISCARD size_t size() const noexcept { return size_; }
+			
+			//* distance to `text`, or `max_distance + 1` if it is greater
+			_CUTIL_NODISCARD size_t distance(std::string_view text, size_t max_distance) const
+			{
+				const size_t diff = size_ > text.size() ? size_ - text.size() : text.size() - size_;
+				max_distance = std::min(max_distance, std::max(size_, text.size())); // never more than that, and no overflow
+				if (diff > max_distance) {
+					return max_distance + 1;
+				}
+				if (blocks_ <= 1) {
+					return myers_distance_64(peq_.data(), size_, text, max_distance);
+				}
+				return distance_blocks(text, max_distance);
+			}
+			
+		private:
+			//* Myers' block-based variant: the horizontal delta at the bottom of a block carries into the next one
+			size_t distance_blocks(std::string_view text, size_t max_distance) const
+			{
+				std::vector<uint64_t> pv(blocks_, ~uint64_t(0));
+				std::vector<uint64_t> mv(blocks_, 0);
+				const uint64_t last = uint64_t(1) << ((size_ - 1) % 64);
+				size_t score = size_;
+				for (size_t j = 0; j < text.size(); ++j) {
+					const uint8_t c = static_cast<uint8_t>(text[j]);
+					int carry = 1; // horizontal delta entering block 0 from row 0
+					for (size_t b = 0; b < blocks_; ++b) {
+						uint64_t eq = peq_[b * 256 + c];
+						const uint64_t xv = eq | mv[b];
+						if (carry < 0) {
+							eq |= 1;
+						}
+						const uint64_t xh = (((eq & pv[b]) + pv[b]) ^ pv[b]) | eq;
+						uint64_t ph = mv[b] | ~(xh | pv[b]);
+						uint64_t mh = pv[b] & xh;
+						const uint64_t high = b + 1 == blocks_ ? last : uint64_t(1) << 63;
+						const int carry_out = (ph & high) ? 1 : (mh & high) ? -1 : 0;
+						ph <<= 1;
+						mh <<= 1;
+						if (carry < 0) {
+							mh |= 1;
+						} else if (carry > 0) {
+							ph |= 1;
+						}
+						pv[b] = mh | ~(xv | ph);
+						mv[b] = ph & xv;
+						carry = carry_out;
+					}
+					score = static_cast<size_t>(static_cast<ptrdiff_t>(score) + carry);
+					if (score > max_distance + (text.size() - j - 1)) {
+						return max_distance + 1;
+					}
+				}
+				return std::min(score, max_distance + 1);
+			}
+			
+			size_t size_;
+			size_t blocks_;
+			std::vector<uint64_t> peq_;	// 256 masks per block
+		};
+		
+		inline bool fuzzy_match_less(size_t d1, size_t i1, size_t d2, size_t i2)
+		{
+			return d1 != d2 ? d1 < d2 : i1 < i2;
+		}
+		
+		//* keeps the `k` smallest (distance, index) pairs out of `distances`
+		template<typename Match>
+		inline std::vector<Match> smallest_matches(const std::vector<size_t>& distances, size_t k, size_t max_distance)
+		{
+			std::vector<Match> result;
+			for (size_t i = 0; i < distances.size(); ++i) {
+				if (distances[i] <= max_distance) {
+					result.push_back({i, distances[i]});
+				}
+			}
+			const auto less = [](const Match& a, const Match& b) { return fuzzy_match_less(a.distance, a.index, b.distance, b.index); };
+			if (result.size() > k) {
+				std::nth_element(result.begin(), result.begin() + static_cast<ptrdiff_t>(k), result.end(), less);
+				result.resize(k);
+			}
+			std::sort(result.begin(), result.end(), less);
+			return result;
+		}
+	}
+	
+	/**
+	 * @brief Levenshtein distance (insertions, deletions and substitutions of bytes, each costing 1).
+	 *        Bit-parallel (Myers / Hyyrö): O(length of `b`) steps of a few word operations when the shorter string
+	 *        has at most 64 chars, and one such step per 64-char block of it otherwise, instead of a full O(n·m) table.
+	 */
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	size_t edit_distance(std::string_view a, std::string_view b)
+	{
+		if (a.size() > b.size()) {
+			std::swap(a, b);
+		}
+		if (a.size() <= 64) {
+			uint64_t peq[256];
+			internal::fill_peq_64(peq, a, b);
+			return internal::myers_distance_64(peq, a.size(), b, b.size());
+		}
+		return internal::myers_pattern(a).distance(b, b.size());
+	}
+	
+	/**
+	 * @brief Levenshtein distance if it is at most `max_distance`, otherwise `max_distance + 1`.
+	 *        Gives up as soon as the bound cannot be met: at once when the lengths differ by more than it,
+	 *        and while scanning when the remaining chars cannot bring the distance back under it.
+	 */
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	size_t edit_distance(std::string_view a, std::string_view b, size_t max_distance)
+	{
+		if (a.size() > b.size()) {
+			std::swap(a, b);
+		}
+		max_distance = std::min(max_distance, b.size());
+		if (b.size() - a.size() > max_distance) {
+			return max_distance + 1;
+		}
+		if (a.size() <= 64) {
+			uint64_t peq[256];
+			internal::fill_peq_64(peq, a, b);
+			return internal::myers_distance_64(peq, a.size(), b, max_distance);
+		}
+		return internal::myers_pattern(a).distance(b, max_distance);
+	}
+	
+	struct fuzzy_match {
+		size_t index;		// position in the candidate list
+		size_t distance;	// `edit_distance()` to the query
+	};
+	
+	/**
+	 * @brief The `k` candidates closest to `query` by `edit_distance()`, nearest first (ties: lower index first),
+	 *        for "did you mean" suggestions. The query is compiled once, and the k-th best distance found so far
+	 *        bounds every further comparison, so far-off candidates are dropped after a few chars.
+	 * @param max_distance - candidates further away than this are never returned.
+	 */
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	std::vector<fuzzy_match> closest_matches(std::string_view query, cutil::span<const std::string_view> candidates, size_t k
+											, size_t max_distance = static_cast<size_t>(-1) / 2)
+	{
+		std::vector<fuzzy_match> best; // max-heap on (distance, index) while collecting
+		if (k == 0) {
+			return best;
+		}
+		const auto less = [](const fuzzy_match& a, const fuzzy_match& b) {
+			return internal::fuzzy_match_less(a.distance, a.index, b.distance, b.index);
+		};
+		const internal::myers_pattern pattern(query);
+		for (size_t i = 0; i < candidates.size(); ++i) {
+			const size_t bound = best.size() < k ? max_distance : best.front().distance;
+			const size_t distance = pattern.distance(candidates[i], bound);
+			if (distance > bound || (best.size() == k && distance == bound)) { // an equal one found earlier wins
+				continue;
+			}
+			if (best.size() == k) {
+				std::pop_heap(best.begin(), best.end(), less);
+				best.pop_back();
+			}
+			best.push_back({i, distance});
+			std::push_heap(best.begin(), best.end(), less);
+		}
+		std::sort_heap(best.begin(), best.end(), less);
+		return best;
+	}
+	
+	/**
+	 * @brief Same result as `closest_matches()`, for long candidate lists: the distances are computed
+	 *        with `std::execution::par` (sequential where it is not available), bounded by `max_distance` only.
+	 */
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	std::vector<fuzzy_match> closest_matches_par(std::string_view query, cutil::span<const std::string_view> candidates, size_t k
+												, size_t max_distance = static_cast<size_t>(-1) / 2)
+	{
+		if (candidates.size() < 4096) { // not worth the threads
+			return closest_matches(query, candidates, k, max_distance);
+		}
+		const internal::myers_pattern pattern(query);
+		std::vector<size_t> distances(candidates.size());
+		const auto distance_to = [&](std::string_view candidate) { return pattern.distance(candidate, max_distance); };
+	#ifdef _CUTIL_STRINGUTIL_USE_PARALLEL
+		std::transform(std::execution::par, candidates.begin(), candidates.end(), distances.begin(), distance_to);
+	#else
+		std::transform(candidates.begin(), candidates.end(), distances.begin(), distance_to);
+	#endif
+		return internal::smallest_matches<fuzzy_match>(distances, k, max_distance);
+	}
+/*
+	cutil::str::edit_distance("kitten", "sitting");			// -> 3
+	cutil::str::edit_distance("kitten", "sitting", 1);		// -> 2, "more than 1"
+	
+	std::vector<std::string_view> commands = {"commit", "checkout", "cherry-pick", "clone"};
+	auto suggestions = cutil::str::closest_matches("chekout", commands, 2, 3);	// -> { {1, 1} }, the others are 5 or more away
+	for (const auto& m : suggestions) { printf("did you mean %s?\n", commands[m.index].data()); }
+*/
+#endif // C++17
+
+
+
+	/**
+	 * @brief Creates new std::string with repeated n times substring str.
+	 * @param str - substring that needs to be repeated.
+	 * @param n - number of iterations.
+	 * @return std::string with repeated substring str.
+	 */
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	std::string repeat(const std::string & str, size_t n)
+	{
+		std::string result;
+		result.reserve(str.size() * n);
+		for(size_t i = 0; i < n; ++i)
+		{
+			result += str;
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Creates new std::string with repeated n times char c.
+	 * @param c - char that needs to be repeated.
+	 * @param n - number of iterations.
+	 * @return std::string with repeated char c.
+	 */
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	std::string repeat(char c, size_t n)
+	{
+		return std::string(n, c);
+	}
+/*
+	EXPECT_EQ("GoGoGoGo",   cutil::str::repeat("Go", 4));
+	EXPECT_EQ("ZZZZZZZZZZ", cutil::str::repeat('Z', 10));
+*/
+
+
+
+	namespace internal{
+		//* one position of a glob pattern: the set of bytes it accepts
+		struct glob_atom {
+			uint64_t bits[4];
+			
+			bool accepts(uint8_t c) const { return ((bits[c >> 6] >> (c & 63)) & 1) != 0; }
+			void add(uint8_t c) { bits[c >> 6] |= uint64_t(1) << (c & 63); }
+		};
+		
+		//* atoms between two '*'
+		struct glob_segment {
+			std::vector<glob_atom> atoms;
+			std::string literal;			// the bytes, if every atom is one case-sensitive char
+			std::vector<uint64_t> masks;	// shift-and masks by byte value, for segments searched inside the text
+			
+			bool is_literal() const { return literal.size() == atoms.size(); }
+			
+			//* does the segment match `text` at exactly this position
+			bool matches_at(const char* text) const
+			{
+				if (is_literal()) {
+					return std::memcmp(text, literal.data(), literal.size()) == 0;
+				}
+				for (size_t i = 0; i < atoms.size(); ++i) {
+					if (!atoms[i].accepts(static_cast<uint8_t>(text[i]))) {
+						return false;
+					}
+				}
+				return true;
+			}
+			
+			//* leftmost position in [first, last) where the segment matches, or nullptr
+			const char* find(const char* first, const char* last) const
+			{
+				const size_t m = atoms.size();
+				if (static_cast<size_t>(last - first) < m) {
+					return nullptr;
+				}
+				if (!masks.empty()) {
+					// shift-and: bit i of `state` is set while the last i + 1 bytes match the first i + 1 atoms
+					const uint64_t found = uint64_t(1) << (m - 1);
+					uint64_t state = 0;
+					for (const char* p = first; p != last; ++p) {
+						state = ((state << 1) | 1) & masks[static_cast<uint8_t>(*p)];
+						if (state & found) {
+							return p + 1 - m;
+						}
+					}
+					return nullptr;
+				}
+				for (const char* p = first; p + m <= last; ++p) { // longer than 64 atoms
+					if (matches_at(p)) {
+						return p;
+					}
+				}
+				return nullptr;
+			}
+		};
+	}
+	
+	/**
+	 * @brief Compiled glob (wildcard) pattern, for filters such as `*.log` or `user-??-*` without the cost of a `std::regex`.
+	 *        `*` matches any run of bytes ('/' included), `?` one byte, `[abc]`, `[a-z]` and `[!a-z]` (or `[^a-z]`) a class,
+	 *        `\` escapes the next character. The whole text has to match, like `matches()` with a regex.
+	 * @note  The pattern is split at the `*`s into segments of fixed length; the first and last ones are anchored,
+	 *        each one in between is searched once, leftmost, with a bit-parallel shift-and scan.
+	 *        So matching is linear in the text for segments up to 64 characters, with no backtracking.
+	 *        The length and the literal prefix / suffix reject most names before anything else is looked at.
+	 *        All query functions are const, so one matcher can be shared by many threads.
+	 */
+	class glob_matcher {
+	public:
+		glob_matcher() : glob_matcher(std::string()) {}
+		
+		/**
+		 * @param pattern - the glob, compiled once.
+		 * @param ignore_case - ASCII letters match in any case, like `compare_ignore_case()`.
+		 */
+		explicit glob_matcher(const std::string & pattern, bool ignore_case = false)
+			: pattern_(pattern)
+		{
+			segments_.emplace_back();
+			for (size_t i = 0; i < pattern.size(); ++i)
+			{
+				if (pattern[i] == '*')
+				{
+					if (!segments_.back().atoms.empty() || segments_.size() == 1)
+					{
+						segments_.emplace_back();
+					}
+					continue;
+				}
+				internal::glob_atom atom = {};
+				bool literal = false;
+				if (pattern[i] == '?')
+				{
+					std::fill(std::begin(atom.bits), std::end(atom.bits), ~uint64_t(0));
+				}
+				else if (pattern[i] != '[' || !parse_class(pattern, i, ignore_case, atom)) // a class leaves `i` on its ']'
+				{
+					if (pattern[i] == '\\' && i + 1 < pattern.size())
+					{
+						++i;
+					}
+					add_char(atom, pattern[i], ignore_case);
+					literal = !ignore_case || !std::isalpha(static_cast<uint8_t>(pattern[i]));
+				}
+				internal::glob_segment& segment = segments_.back();
+				if (literal && segment.is_literal())
+				{
+					segment.literal.push_back(pattern[i]);
+				}
+				segment.atoms.push_back(atom);
+			}
+			
+			for (const auto& segment : segments_)
+			{
+				min_size_ += segment.atoms.size();
+			}
+			for (size_t k = 1; k + 1 < segments_.size(); ++k)
+			{
+				internal::glob_segment& segment = segments_[k];
+				if (segment.atoms.size() > 64)
+				{
+					continue;
+				}
+				segment.masks.assign(256, 0);
+				for (size_t c = 0; c < 256; ++c)
+				{
+					for (size_t a = 0; a < segment.atoms.size(); ++a)
+					{
+						if (segment.atoms[a].accepts(static_cast<uint8_t>(c)))
+						{
+							segment.masks[c] |= uint64_t(1) << a;
+						}
+					}
+				}
+			}
+		}
+		
+		_CUTIL_NODISCARD const std::string& pattern() const { return pattern_; }
+		
+		_CUTIL_NODISCARD bool matches(const char* data, size_t size) const
+		{
+			if (size < min_size_)
+			{
+				return false;
+			}
+			const internal::glob_segment& head = segments_.front();
+			if (segments_.size() == 1) // no '*'
+			{
+				return size == min_size_ && head.matches_at(data);
+			}
+			const internal::glob_segment& tail = segments_.back();
+			const char* first = data + head.atoms.size();
+			const char* last = data + size - tail.atoms.size();
+			if (!head.matches_at(data) || !tail.matches_at(last))
+			{
+				return false;
+			}
+			for (size_t k = 1; k + 1 < segments_.size(); ++k)
+			{
+				const char* found = segments_[k].find(first, last);
+				if (found == nullptr)
+				{
+					return false;
+				}
+				first = found + segments_[k].atoms.size();
+			}
+			return true;
+		}
+	#ifdef CUTIL_CPP17_SUPPORTED
+		_CUTIL_NODISCARD bool matches(std::string_view str) const
+		{
+			return matches(str.data(), str.size());
+		}
+		
+		/**
+		 * @brief Keeps the names that match, in their order.
+		 * @param out - cleared, then receives the matching names; reuse it across calls to keep its capacity.
+		 */
+		void filter(cutil::span<const std::string_view> names, std::vector<std::string_view>& out) const
+		{
+			out.clear();
+			for (std::string_view name : names)
+			{
+				if (matches(name.data(), name.size()))
+				{
+					out.push_back(name);
+				}
+			}
+		}
+		_CUTIL_NODISCARD std::vector<std::string_view> filter(cutil::span<const std::string_view> names) const
+		{
+			std::vector<std::string_view> out;
+			filter(names, out);
+			return out;
+		}
+	#else
+		_CUTIL_NODISCARD bool matches(const std::string & str) const
+		{
+			return matches(str.data(), str.size());
+		}
+	#endif
+		
+	private:
+		static void add_char(internal::glob_atom& atom, char c, bool ignore_case)
+		{
+			atom.add(static_cast<uint8_t>(c));
+			if (ignore_case)
+			{
+				atom.add(static_cast<uint8_t>(std::tolower(static_cast<uint8_t>(c))));
+				atom.add(static_cast<uint8_t>(std::toupper(static_cast<uint8_t>(c))));
+			}
+		}
+		
+		//* `[...]` starting at `pattern[i]`, false if it is not closed (the '[' is then a plain char)
+		static bool parse_class(const std::string & pattern, size_t& i, bool ignore_case, internal::glob_atom& atom)
+		{
+			size_t k = i + 1;
+			const bool negate = k < pattern.size() && (pattern[k] == '!' || pattern[k] == '^');
+			k += negate ? 1 : 0;
+			internal::glob_atom set = {};
+			for (bool first = true; k < pattern.size() && (first || pattern[k] != ']'); first = false)
+			{
+				if (pattern[k] == '\\' && k + 1 < pattern.size())
+				{
+					++k;
+				}
+				uint8_t low = static_cast<uint8_t>(pattern[k++]);
+				uint8_t high = low;
+				if (k + 1 < pattern.size() && pattern[k] == '-' && pattern[k + 1] != ']')
+				{
+					k += pattern[k + 1] == '\\' && k + 2 < pattern.size() ? 2 : 1;
+					high = static_cast<uint8_t>(pattern[k++]);
+				}
+				for (unsigned c = low; c <= high; ++c)
+				{
+					add_char(set, static_cast<char>(c), ignore_case);
+				}
+			}
+			if (k >= pattern.size())
+			{
+				return false;
+			}
+			for (size_t w = 0; w < 4; ++w)
+			{
+				atom.bits[w] = negate ? ~set.bits[w] : set.bits[w];
+			}
+			i = k;
+			return true;
+		}
+		
+		std::string pattern_;
+		std::vector<internal::glob_segment> segments_;	// split at '*', so there are at least 2 when the pattern has one
+		size_t min_size_ = 0;
+	};
+	
+	/**
+	 * @brief Checks if input std::string str matches specified reular expression regex.
+	 * @param str - std::string to be checked.
 	 * @param regex - the std::regex regular expression.
 	 * @return True if regex matches str, false otherwise.
 	 */
@@ -830,28 +2971,48 @@ namespace str
 	{
 		return std::regex_match(str, regex);
 	}
+	
+	/**
+	 * @brief Checks if the whole of `str` matches a compiled glob pattern, see `glob_matcher`.
+	 */
+	_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	bool matches(const std::string & str, const glob_matcher & glob)
+	{
+		return glob.matches(str.data(), str.size());
+	}
+/*
+	cutil::str::matches("app.log", std::regex(".*\\.log"));				// regex, backtracking engine
+	const cutil::str::glob_matcher logs("*.log");
+	cutil::str::matches("app.log", logs);								// -> true
+	
+	const cutil::str::glob_matcher users("user-??-[a-z]*", true);		// ignore case
+	users.matches("USER-01-Bob");										// -> true
+	auto kept = users.filter(names);									// names: span of std::string_view (>= C++17)
+*/
 
 
 
 	/**
 	 * @brief Sort input std::vector<std::string> strs in ascending order.
 	 * @param strs - std::vector<std::string> to be checked.
+	 * @note  Vectors of std::string / std::string_view are sorted by a multikey quicksort on cached 8-byte keys,
+	 *        big ones split into radix buckets first and sorted in parallel (>= C++17); other types use `std::sort()`.
 	 */
 	template<typename T> _CUTIL_FUNC_STATIC
 	inline void sorting_ascending(std::vector<T> &strs)
 	{
-		// std::sort(std::execution::par_unseq, strs.begin(), strs.end());
 		internal::sort(strs, std::less<T>());
 	}
 
 	/**
 	 * @brief Sorted input std::vector<std::string> strs in descending order.
 	 * @param strs - std::vector<std::string> to be checked.
+	 * @note  Vectors of std::string / std::string_view are sorted by a multikey quicksort on cached 8-byte keys,
+	 *        big ones split into radix buckets first and sorted in parallel (>= C++17); other types use `std::sort()`.
 	 */
 	template<typename T> _CUTIL_FUNC_STATIC
 	inline void sorting_descending(std::vector<T> &strs)
 	{
-		// std::sort(std::execution::par_unseq, strs.begin(),strs.end(), std::greater<T>());
 		internal::sort(strs, std::greater<T>());
 	}
 
@@ -878,34 +3039,69 @@ namespace str
 	}
 
 	
+	namespace internal{
+		enum filename_char_class : uint8_t {
+			filename_char_invalid = 1,	// <>:"/\|?*
+			filename_char_space = 2,	// `std::isspace()` in the "C" locale, trimmed at both ends
+		};
+		struct filename_char_table {
+			uint8_t classes[256];
+		};
+		inline constexpr filename_char_table make_filename_char_table()
+		{
+			filename_char_table table{};
+			const char invalid[] = "<>:\"/\\|?*";
+			for (size_t i = 0; i + 1 < sizeof(invalid); ++i) {
+				table.classes[static_cast<uint8_t>(invalid[i])] = filename_char_invalid;
+			}
+			const char spaces[] = " \t\n\v\f\r";
+			for (size_t i = 0; i + 1 < sizeof(spaces); ++i) {
+				table.classes[static_cast<uint8_t>(spaces[i])] = filename_char_space;
+			}
+			return table;
+		}
+		inline const uint8_t* filename_char_classes()
+		{
+			static constexpr filename_char_table table = make_filename_char_table();
+			return table.classes;
+		}
+	}
+	
 	//* modify input string to valid filename by replace invalid characters
 	// if `(replace == '\0')`, invalid characters will be removed; otherwise there will be replaced by `replace`
+	// one pass over the string: a byte table classifies each character, removal, replacement and trimming happen together
 	_CUTIL_FUNC_STATIC inline
 	void sanitize_filename(std::string& str, char replace = '\0')
 	{
-		std::string invalid_chars = "<>:\"/\\|?*";
-	#ifdef _CUTIL_STRINGUTIL_USE_PARALLEL
-		if(replace == '\0'){
-			str.erase(std::remove_if(std::execution::par, str.begin(), str.end(), [&invalid_chars](char c){
-				return invalid_chars.find(c) != std::string::npos;
-			}), str.end());
-		}else{
-			std::replace_if(std::execution::par, str.begin(), str.end(), [&invalid_chars](char c){
-				return invalid_chars.find(c) != std::string::npos;
-			}, replace);
-		}
-	#else
-		if(replace == '\0'){
-			str.erase(std::remove_if(str.begin(), str.end(), [&invalid_chars](char c){
-				return invalid_chars.find(c) != std::string::npos;
-			}), str.end());
-		}else{
-			std::replace_if(str.begin(), str.end(), [&invalid_chars](char c){
-				return invalid_chars.find(c) != std::string::npos;
-			}, replace);
+		const uint8_t* classes = internal::filename_char_classes();
+		const bool replace_is_space = (classes[static_cast<uint8_t>(replace)] & internal::filename_char_space) != 0;
+		char* const data = &str[0];
+		size_t out = 0;
+		size_t kept = 0; // end of the output without trailing spaces
+		for (size_t i = 0; i < str.size(); ++i)
+		{
+			char c = data[i];
+			bool space = (classes[static_cast<uint8_t>(c)] & internal::filename_char_space) != 0;
+			if (classes[static_cast<uint8_t>(c)] & internal::filename_char_invalid)
+			{
+				if (replace == '\0')
+				{
+					continue;
+				}
+				c = replace;
+				space = replace_is_space;
+			}
+			if (space && out == 0) // leading
+			{
+				continue;
+			}
+			data[out++] = c;
+			if (!space)
+			{
+				kept = out;
+			}
 		}
-	#endif
-		cutil::str::trim(str);
+		str.resize(kept);
 	}
 	
 	//* get valid filename from the input string by replace invalid characters
@@ -917,59 +3113,124 @@ namespace str
 		cutil::str::sanitize_filename(result, replace);
 		return result;
 	}
+	
+	/**
+	 * @brief `sanitize_filename()` for many names at once. Big batches are split across names
+	 *        with `std::execution::par` (>= C++17), a single name is always handled by one thread.
+	 * @param names - file names, modified in place.
+	 * @param replace - like in `sanitize_filename()`.
+	 */
+	_CUTIL_FUNC_STATIC inline
+	void sanitize_filenames(cutil::span<std::string> names, char replace = '\0')
+	{
+		const auto sanitize = [replace](std::string& name){ sanitize_filename(name, replace); };
+	#ifdef _CUTIL_STRINGUTIL_USE_PARALLEL
+		if (names.size() >= 4096)
+		{
+			std::for_each(std::execution::par, names.begin(), names.end(), sanitize);
+			return;
+		}
+	#endif
+		std::for_each(names.begin(), names.end(), sanitize);
+	}
 /*
 	EXPECT_EQ("abcdefg", cutil::str::sanitize_filename_copy(" a<b>:c>\\d\"e/f|g:** ? "));
     EXPECT_EQ("a_b__c__d_e_f_g___ _", cutil::str::sanitize_filename_copy(" a<b>:c>\\d\"e/f|g:** ? ", '_'));
+	
+	std::vector<std::string> names = {" a:b ", "c?.txt"};
+	cutil::str::sanitize_filenames(names); // -> { "ab", "c.txt" }
 */
 	
 	
 	
-	//* convert string to the specified type, like int, float, double, etc.
-	//  if failed, it throws exception
-	//  these functions are only the wrappers of std::stoi, std::stol, std::stof, etc.
-	//  if you want to use std::stringstream, use `cutil::str::parse_string()`
-	//  do not support non-arithmetic types
-	//  2nd param `base` is not available for `float`, `double`, `long double`
-	template<typename Ret, typename std::enable_if<cutil::str::internal::is_arithmetic<Ret>::value, bool>::type = false>
-		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
-	Ret to_number(const std::string& str, int base = 10){ // for `uint8_t`, `int8_t`, `uint16_t`, `int16_t`, `unsigned int`
-		int64_t ret = std::stoll(str, nullptr, base);
-		if(ret < std::numeric_limits<Ret>::min() || ret > std::numeric_limits<Ret>::max()){
-			throw std::out_of_range("to_number: value out of range for type " + std::string(typeid(Ret).name()));
+	namespace internal{
+		//* `std::stoll()` compatible syntax without exceptions: leading spaces, an optional sign,
+		//  an optional "0x" prefix for base 16, base 0 detects hex/octal, trailing characters are ignored.
+		//  negative numbers are out of range for unsigned types.
+		template<typename T, typename std::enable_if<is_integral<T>::value, bool>::type = false>
+		inline std::errc to_number_lenient(const std::string& str, T& value, int base)
+		{
+			const char* last = str.data() + str.size();
+			const char* p = skip_spaces(str.data(), last);
+			const bool negative = (p != last && *p == '-');
+			if (p != last && (*p == '-' || *p == '+'))
+			{
+				++p;
+			}
+			const bool hex_prefix = (last - p > 2) && p[0] == '0' && (p[1] == 'x' || p[1] == 'X') && digit_value(p[2]) < 16;
+			if (base == 0)
+			{
+				base = hex_prefix ? 16 : ((p != last && *p == '0') ? 8 : 10);
+			}
+			if (base == 16 && hex_prefix)
+			{
+				p += 2;
+			}
+			if (base < 2 || base > 36)
+			{
+				return std::errc::invalid_argument;
+			}
+			return parse_integer_magnitude(p, last, negative, base, value).ec;
+		}
+		
+		//* same checks as `std::stof()` / `std::stod()` / `std::stold()`, without exceptions.
+		//  decimal input goes through `cutil::str::parse_float()`, hexadecimal floats are left to the C library
+		template<typename T, typename std::enable_if<is_floating_point<T>::value, bool>::type = false>
+		inline std::errc to_number_lenient(const std::string& str, T& value, int /*base*/)
+		{
+			const char* last = str.data() + str.size();
+			const char* p = skip_spaces(str.data(), last);
+			if (last - p > 1 && p[0] == '+' && p[1] != '-')
+			{
+				++p;
+			}
+			const char* digits = p + (p != last && *p == '-');
+			const bool hex = (last - digits > 1) && digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X');
+			if (!hex)
+			{
+				const parse_result res = cutil::str::parse_float(p, last, value);
+				if (res.ec != std::errc::invalid_argument)
+				{
+					return res.ec;
+				}
+			}
+			char* end = nullptr;
+			const int saved_errno = errno;
+			errno = 0;
+			const T result = strto_float(str.c_str(), &end, static_cast<T*>(nullptr));
+			const bool out_of_range = (errno == ERANGE);
+			errno = saved_errno;
+			if (end == str.c_str())
+			{
+				return std::errc::invalid_argument;
+			}
+			if (out_of_range)
+			{
+				return std::errc::result_out_of_range;
+			}
+			value = result;
+			return std::errc();
 		}
-		return static_cast<Ret>(ret);
-	}
-	template<> _CUTIL_NODISCARD
-	inline int to_number<int>(const std::string& str, int base){
-		return std::stoi(str, nullptr, base); // `int` is 16-bit in some 8bit or 16 bit embedded systems
-	}
-	template<> _CUTIL_NODISCARD
-	inline long to_number<long>(const std::string& str, int base){
-		return std::stol(str, nullptr, base); // `long` is 32-bit in Windows x64, but 64-bit in Linux x64
-	}
-	template<> _CUTIL_NODISCARD
-	inline unsigned long to_number<unsigned long>(const std::string& str, int base){
-		return std::stoul(str, nullptr, base);
-	}
-	template<> _CUTIL_NODISCARD
-	inline long long to_number<long long>(const std::string& str, int base){
-		return std::stoll(str, nullptr, base);
-	}
-	template<> _CUTIL_NODISCARD
-	inline unsigned long long to_number<unsigned long long>(const std::string& str, int base){
-		return std::stoull(str, nullptr, base);
-	}
-	template<> _CUTIL_NODISCARD
-	inline float to_number<float>(const std::string& str, int base){
-		return std::stof(str);
-	}
-	template<> _CUTIL_NODISCARD
-	inline double to_number<double>(const std::string& str, int base){
-		return std::stod(str);
 	}
-	template<> _CUTIL_NODISCARD
-	inline long double to_number<long double>(const std::string& str, int base){
-		return std::stold(str);
+	
+	//* convert string to the specified type, like int, float, double, etc.
+	//  if failed, it throws `std::invalid_argument` or `std::out_of_range`, like std::stoi, std::stol, std::stof, etc.
+	//  leading spaces and trailing characters are ignored, use `cutil::str::parse_integer_exact()` for strict parsing.
+	//  if you want to use std::stringstream, use `cutil::str::parse_string()`
+	//  do not support non-arithmetic types
+	//  2nd param `base` is not available for `float`, `double`, `long double`
+	template<typename Ret, typename std::enable_if<cutil::str::internal::is_arithmetic<Ret>::value, bool>::type = false>
+		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	Ret to_number(const std::string& str, int base = 10){
+		Ret ret = Ret();
+		const std::errc ec = internal::to_number_lenient(str, ret, base);
+		if(ec == std::errc::result_out_of_range){
+			throw std::out_of_range("to_number: value out of range for type " + std::string(typeid(Ret).name()));
+		}
+		if(ec != std::errc()){
+			throw std::invalid_argument("to_number: no conversion for \"" + str + "\"");
+		}
+		return ret;
 	}
 	
 	
@@ -978,47 +3239,47 @@ namespace str
 	template<typename Ret, typename std::enable_if<cutil::str::internal::is_arithmetic<Ret>::value, bool>::type = false>
 		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
 	Ret to_number(const std::string& str, Ret default_value, int base = 10){
-		try {
-			return to_number<Ret>(str, base);
-		} catch (...) {
-			return default_value;
-		}
+		Ret ret = Ret();
+		return internal::to_number_lenient(str, ret, base) == std::errc() ? ret : default_value;
 	}
 	template<typename Ret, typename std::enable_if<cutil::str::internal::is_arithmetic<Ret>::value, bool>::type = false>
 		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
 	auto to_number_pair(const std::string& str, int base = 10) -> std::pair<bool, Ret>
 	{
-		try {
-			return {true, to_number<Ret>(str, base)};
-		} catch (...) {
-			return {false, Ret()};
+		Ret ret = Ret();
+		if(internal::to_number_lenient(str, ret, base) == std::errc()){
+			return {true, ret};
 		}
+		return {false, Ret()};
 	}
 #ifdef CUTIL_CPP17_SUPPORTED
 	//* convert string to the specified type, like int, float, double, etc.
 	//  if failed, it returns std::nullopt
-	//  `std::from_chars()` is more recommended for C++17 and later
+	//  same syntax as `to_number()`, leading spaces and trailing characters are ignored
 	template<typename Ret, typename std::enable_if<cutil::str::internal::is_arithmetic<Ret>::value, bool>::type = false>
 		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
 	auto to_number_opt_legacy(const std::string& str, int base = 10) -> std::optional<Ret>
 	{
-		try {
-			return to_number<Ret>(str, base);
-		} catch (...) {
-			return std::nullopt;
+		Ret ret = Ret();
+		if(internal::to_number_lenient(str, ret, base) == std::errc()){
+			return ret;
 		}
+		return std::nullopt;
 	}
 	
 	//* convert string to the specified type, like int, float, double, etc.
 	//  if failed, it returns std::nullopt
-	//  this function uses `std::from_chars()` for C++17 and later
+	//  integers use `cutil::str::parse_integer()`, and the whole string must be a number.
+	//  floating-point types use `cutil::str::parse_float()`, trailing characters are ignored ("5.245f" -> 5.245f),
+	//  use `cutil::str::parse_float_exact()` for strict parsing.
 	template<typename Ret, typename std::enable_if<cutil::str::internal::is_integral<Ret>::value, bool>::type = false>
 		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
 	auto to_number_opt(std::string_view str, int base = 10) -> std::optional<Ret>
 	{
-		Ret ret;
-		const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), ret, base);
-		if(ec == std::errc() /*&& ptr == str.data() + str.size()*/){
+		Ret ret = Ret();
+		const char* last = str.data() + str.size();
+		const auto [ptr, ec] = cutil::str::parse_integer(str.data(), last, ret, base);
+		if(ec == std::errc() && ptr == last){
 			return ret;
 		}
 		return std::nullopt;
@@ -1027,14 +3288,1085 @@ namespace str
 		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
 	auto to_number_opt(std::string_view str) -> std::optional<Ret>
 	{
-		Ret ret;
-		const auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), ret);
-		if(ec == std::errc() /*&& ptr == str.data() + str.size()*/){
+		Ret ret = Ret();
+		if(cutil::str::parse_float(str.data(), str.data() + str.size(), ret).ec == std::errc()){
 			return ret;
 		}
 		return std::nullopt;
 	}
 	
+	
+	namespace internal{
+		//* walks the fields of a delimited line without copying, ' ', '\t', '\r' and '\n' around a field are trimmed
+		class field_cursor {
+		public:
+			field_cursor(std::string_view line, char delim) noexcept
+				: p_(line.data()), last_(line.data() + line.size()), delim_(delim), done_(line.empty()) {}
+			
+			bool next(std::string_view& field) noexcept
+			{
+				if (done_) {
+					return false;
+				}
+				const void* hit = std::memchr(p_, delim_, static_cast<size_t>(last_ - p_));
+				const char* end = hit ? static_cast<const char*>(hit) : last_;
+				const char* first = p_;
+				while (first != end && is_blank(*first)) {
+					++first;
+				}
+				const char* field_last = end;
+				while (field_last != first && is_blank(field_last[-1])) {
+					--field_last;
+				}
+				field = std::string_view(first, static_cast<size_t>(field_last - first));
+				done_ = (hit == nullptr);
+				p_ = end + !done_;
+				return true;
+			}
+			
+		private:
+			static bool is_blank(char c) noexcept { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+			
+			const char* p_;
+			const char* last_;
+			char delim_;
+			bool done_;
+		};
+		
+		//* a whole field must be the value, `value` is untouched on failure
+		template<typename T, typename std::enable_if<is_integral<T>::value, bool>::type = false>
+		inline std::errc parse_field(std::string_view field, T& value) noexcept
+		{
+			T result = T();
+			const char* last = field.data() + field.size();
+			const parse_result res = cutil::str::parse_integer(field.data(), last, result);
+			if (res.ec != std::errc() || res.ptr != last) {
+				return (res.ec != std::errc()) ? res.ec : std::errc::invalid_argument;
+			}
+			value = result;
+			return std::errc();
+		}
+		template<typename T, typename std::enable_if<is_floating_point<T>::value, bool>::type = false>
+		inline std::errc parse_field(std::string_view field, T& value) noexcept
+		{
+			T result = T();
+			const char* last = field.data() + field.size();
+			const parse_result res = cutil::str::parse_float(field.data(), last, result);
+			if (res.ec != std::errc() || res.ptr != last) {
+				return (res.ec != std::errc()) ? res.ec : std::errc::invalid_argument;
+			}
+			value = result;
+			return std::errc();
+		}
+		inline std::errc parse_field(std::string_view field, std::string_view& value) noexcept
+		{
+			value = field;
+			return std::errc();
+		}
+		inline std::errc parse_field(std::string_view field, std::string& value)
+		{
+			value.assign(field.data(), field.size());
+			return std::errc();
+		}
+	}
+	
+	/**
+	 * @brief Outcome of `parse_numbers()`.
+	 */
+	struct fields_result {
+		size_t fields;		// number of fields in the line
+		size_t parsed;		// fields converted successfully
+		size_t error_index;	// index of the first failed field, only meaningful if `!ok()`
+		std::errc ec;		// error of the first failed field, `std::errc()` if every field was converted
+		
+		_CUTIL_NODISCARD bool ok() const noexcept { return ec == std::errc(); }
+	};
+	
+	/**
+	 * @brief Converts every field of a delimited line into `out`, in one pass and without intermediate strings.
+	 *        Each field is parsed by `parse_integer()` / `parse_float()` and must be entirely a number,
+	 *        ' ', '\t', '\r' and '\n' around it are ignored. An empty line has no fields.
+	 * @tparam T - arithmetic datatype, e.g. `parse_numbers<double>(line, ',', values)`.
+	 * @param line - the input line.
+	 * @param delim - the delimiter.
+	 * @param out - receives the values; a failed field leaves its element untouched.
+	 * @param errors - optional, receives the result of each field: `std::errc::invalid_argument`,
+	 *        `std::errc::result_out_of_range`, or `std::errc::value_too_large` for fields beyond the size of `out`.
+	 * @return counts and the first error, nothing is thrown.
+	 */
+	template<typename T, typename std::enable_if<cutil::str::internal::is_arithmetic<T>::value, bool>::type = false>
+		_CUTIL_FUNC_STATIC inline
+	fields_result parse_numbers(std::string_view line, char delim, cutil::span<T> out, cutil::span<std::errc> errors = {}) noexcept
+	{
+		fields_result res{0, 0, 0, std::errc()};
+		internal::field_cursor cursor(line, delim);
+		std::string_view field;
+		while (cursor.next(field))
+		{
+			const size_t i = res.fields++;
+			const std::errc ec = (i < out.size()) ? internal::parse_field(field, out[i]) : std::errc::value_too_large;
+			if (i < errors.size())
+			{
+				errors[i] = ec;
+			}
+			if (ec == std::errc())
+			{
+				++res.parsed;
+			}
+			else if (res.ec == std::errc())
+			{
+				res.ec = ec;
+				res.error_index = i;
+			}
+		}
+		return res;
+	}
+	
+	/**
+	 * @brief Typed fields of one record, returned by `parse_fields()`.
+	 */
+	template<typename... T>
+	struct parsed_fields {
+		std::tuple<T...> values;						// a failed field keeps T()
+		std::array<std::errc, sizeof...(T)> errors;		// per field, `std::errc::invalid_argument` for a missing one
+		size_t fields;									// number of fields in the line, may differ from sizeof...(T)
+		
+		//* every field was converted, and there are no extra ones
+		_CUTIL_NODISCARD bool ok() const noexcept
+		{
+			return fields == sizeof...(T)
+				&& std::all_of(errors.begin(), errors.end(), [](std::errc ec){ return ec == std::errc(); });
+		}
+	};
+	
+	namespace internal{
+		template<typename... T, size_t... I>
+		inline void parse_fields(field_cursor& cursor, parsed_fields<T...>& res, std::index_sequence<I...>)
+		{
+			std::string_view field;
+			((cursor.next(field) ? (++res.fields, res.errors[I] = parse_field(field, std::get<I>(res.values))) : std::errc()), ...);
+		}
+	}
+	
+	/**
+	 * @brief Converts the fields of a delimited line into a tuple of types, in one pass and without intermediate strings.
+	 *        Arithmetic fields follow `parse_numbers()`; `std::string_view` fields refer into `line`, `std::string` ones copy.
+	 * @tparam T - one datatype per field.
+	 * @param line - the input line.
+	 * @param delim - the delimiter.
+	 * @return the values with an error code for each field, nothing is thrown for bad input.
+	 */
+	template<typename... T>
+		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+	parsed_fields<T...> parse_fields(std::string_view line, char delim)
+	{
+		parsed_fields<T...> res{};
+		res.errors.fill(std::errc::invalid_argument);
+		internal::field_cursor cursor(line, delim);
+		internal::parse_fields(cursor, res, std::index_sequence_for<T...>());
+		std::string_view extra;
+		while (cursor.next(extra))
+		{
+			++res.fields;
+		}
+		return res;
+	}
+/*
+	double values[8];
+	auto res = cutil::str::parse_numbers<double>("1.5, 2, -3e4", ',', values); // res.fields = 3, values = {1.5, 2, -30000}
+	if (!res.ok()) { ... } // res.error_index, res.ec
+	
+	auto rec = cutil::str::parse_fields<std::string_view, int64_t, double>("cpu.load,1718000000,0.75", ',');
+	if (rec.ok()) {
+		auto [name, timestamp, value] = rec.values;
+	}
+*/
+	
+	
+	namespace internal{
+		//* append-only byte storage in fixed-size chunks, stored strings never move.
+		//  strings bigger than a quarter chunk get a chunk of their own, so the open chunk is not wasted.
+		class string_arena {
+		public:
+			explicit string_arena(size_t chunk_size = 64 * 1024) : chunk_size_(chunk_size < 64 ? 64 : chunk_size) {}
+			
+			//* the chunks move, and the source forgets its cursor into them, so it can be reused
+			string_arena(string_arena&& other) noexcept
+				: chunks_(std::move(other.chunks_)), cursor_(other.cursor_), remaining_(other.remaining_),
+				  bytes_(other.bytes_), chunk_size_(other.chunk_size_)
+			{
+				other.clear();
+			}
+			string_arena& operator=(string_arena&& other) noexcept
+			{
+				if (this != &other)
+				{
+					chunks_ = std::move(other.chunks_);
+					cursor_ = other.cursor_;
+					remaining_ = other.remaining_;
+					bytes_ = other.bytes_;
+					chunk_size_ = other.chunk_size_;
+					other.clear();
+				}
+				return *this;
+			}
+			
+			//* copies `str` and a terminating '\0' into the arena
+			std::string_view store(std::string_view str)
+			{
+				const size_t need = str.size() + 1;
+				char* dest;
+				if (need <= remaining_)
+				{
+					dest = cursor_;
+					cursor_ += need;
+					remaining_ -= need;
+				}
+				else if (need > chunk_size_ / 4)
+				{
+					chunks_.emplace_back(new char[need]);
+					dest = chunks_.back().get();
+				}
+				else
+				{
+					chunks_.emplace_back(new char[chunk_size_]);
+					dest = chunks_.back().get();
+					cursor_ = dest + need;
+					remaining_ = chunk_size_ - need;
+				}
+				std::copy(str.begin(), str.end(), dest);
+				dest[str.size()] = '\0';
+				bytes_ += need;
+				return std::string_view(dest, str.size());
+			}
+			
+			//* bytes handed out, including the terminators
+			_CUTIL_NODISCARD size_t bytes() const { return bytes_; }
+			
+			void clear()
+			{
+				chunks_.clear();
+				cursor_ = nullptr;
+				remaining_ = 0;
+				bytes_ = 0;
+			}
+			
+		private:
+			std::vector<std::unique_ptr<char[]>> chunks_;
+			char* cursor_ = nullptr;
+			size_t remaining_ = 0;
+			size_t bytes_ = 0;
+			size_t chunk_size_;
+		};
+		
+		inline uint64_t intern_hash(std::string_view str)
+		{
+			return mix_hash(std::hash<std::string_view>()(str));
+		}
+	}
+	
+	/**
+	 * @brief String interning table: every distinct string is stored once and gets a dense id (0, 1, 2, ...).
+	 *        Bytes live in a chunked arena and the index is a flat open-addressing table of ids,
+	 *        so interning a string seen before costs one hash and one compare, no allocation.
+	 *        Views returned by `view()` stay valid until `clear()` or destruction, also across moves,
+	 *        and are '\0'-terminated.
+	 * @note  Not thread-safe, see `concurrent_intern_pool`.
+	 */
+	class intern_pool {
+	public:
+		using id_type = uint32_t;
+		
+		/**
+		 * @param chunk_size - arena chunk size in bytes.
+		 */
+		explicit intern_pool(size_t chunk_size = 64 * 1024) : arena_(chunk_size) {}
+		
+		intern_pool(const intern_pool&) = delete;
+		intern_pool& operator=(const intern_pool&) = delete;
+		intern_pool(intern_pool&&) = default;
+		intern_pool& operator=(intern_pool&&) = default;
+		
+		//* id of `str`, stores a copy the first time it is seen
+		id_type intern(std::string_view str)
+		{
+			return intern_hashed(str, internal::intern_hash(str));
+		}
+		
+		//* pooled copy of `str`, equal strings give the same pointer
+		std::string_view intern_view(std::string_view str)
+		{
+			return strings_[intern(str)];
+		}
+		
+		//* id of `str` if it was interned before, never inserts
+		_CUTIL_NODISCARD std::optional<id_type> find(std::string_view str) const
+		{
+			id_type id;
+			if (find_hashed(str, internal::intern_hash(str), id))
+			{
+				return id;
+			}
+			return std::nullopt;
+		}
+		
+		_CUTIL_NODISCARD std::string_view view(id_type id) const { return strings_[id]; }
+		_CUTIL_NODISCARD const char* c_str(id_type id) const { return strings_[id].data(); }
+		
+		//* number of distinct strings
+		_CUTIL_NODISCARD size_t size() const { return strings_.size(); }
+		_CUTIL_NODISCARD bool empty() const { return strings_.empty(); }
+		//* arena bytes used by the strings
+		_CUTIL_NODISCARD size_t arena_bytes() const { return arena_.bytes(); }
+		
+		void reserve(size_t count)
+		{
+			strings_.reserve(count);
+			if (count * 2 > index_.capacity())
+			{
+				index_.rehash(count, [this](id_type id){ return internal::intern_hash(strings_[id]); });
+			}
+		}
+		
+		//* drops all strings, invalidates every view and id
+		void clear()
+		{
+			strings_.clear();
+			index_.clear();
+			arena_.clear();
+		}
+		
+	private:
+		friend class concurrent_intern_pool;
+		
+		internal::string_arena arena_;
+		std::vector<std::string_view> strings_;
+		internal::index_set<id_type> index_;
+		
+		id_type intern_hashed(std::string_view str, uint64_t mixed)
+		{
+			if ((strings_.size() + 1) * 2 > index_.capacity())
+			{
+				index_.rehash(strings_.size() * 2, [this](id_type id){ return internal::intern_hash(strings_[id]); });
+			}
+			const id_type next = static_cast<id_type>(strings_.size());
+			const id_type id = index_.insert(mixed, next, [&](id_type other){ return strings_[other] == str; });
+			if (id == next)
+			{
+				strings_.push_back(arena_.store(str));
+			}
+			return id;
+		}
+		
+		bool find_hashed(std::string_view str, uint64_t mixed, id_type& id) const
+		{
+			return index_.find(mixed, [&](id_type other){ return strings_[other] == str; }, id);
+		}
+	};
+	
+	/**
+	 * @brief Thread-safe `intern_pool`, split into 16 shards by hash, each behind its own `std::shared_mutex`.
+	 *        Strings already interned only take a shared lock, so concurrent parsers rarely wait on each other.
+	 *        Ids are stable but not dense: the low 4 bits hold the shard.
+	 */
+	class concurrent_intern_pool {
+	public:
+		using id_type = intern_pool::id_type;
+		static constexpr size_t shard_bits = 4;
+		static constexpr size_t shard_count = size_t(1) << shard_bits;
+		
+		/**
+		 * @param chunk_size - arena chunk size in bytes, per shard.
+		 */
+		explicit concurrent_intern_pool(size_t chunk_size = 64 * 1024)
+		{
+			for (shard& s : shards_)
+			{
+				s.pool = intern_pool(chunk_size);
+			}
+		}
+		
+		id_type intern(std::string_view str)
+		{
+			const uint64_t mixed = internal::intern_hash(str);
+			const size_t index = shard_of(mixed);
+			shard& s = shards_[index];
+			id_type local;
+			{
+				std::shared_lock<std::shared_mutex> lock(s.mutex);
+				if (s.pool.find_hashed(str, mixed, local))
+				{
+					return make_id(local, index);
+				}
+			}
+			std::unique_lock<std::shared_mutex> lock(s.mutex);
+			return make_id(s.pool.intern_hashed(str, mixed), index);
+		}
+		
+		std::string_view intern_view(std::string_view str)
+		{
+			return view(intern(str));
+		}
+		
+		_CUTIL_NODISCARD std::optional<id_type> find(std::string_view str) const
+		{
+			const uint64_t mixed = internal::intern_hash(str);
+			const size_t index = shard_of(mixed);
+			const shard& s = shards_[index];
+			std::shared_lock<std::shared_mutex> lock(s.mutex);
+			id_type local;
+			if (s.pool.find_hashed(str, mixed, local))
+			{
+				return make_id(local, index);
+			}
+			return std::nullopt;
+		}
+		
+		_CUTIL_NODISCARD std::string_view view(id_type id) const
+		{
+			const shard& s = shards_[id & (shard_count - 1)];
+			std::shared_lock<std::shared_mutex> lock(s.mutex);
+			return s.pool.view(id >> shard_bits);
+		}
+		
+		_CUTIL_NODISCARD size_t size() const
+		{
+			size_t result = 0;
+			for (const shard& s : shards_)
+			{
+				std::shared_lock<std::shared_mutex> lock(s.mutex);
+				result += s.pool.size();
+			}
+			return result;
+		}
+		
+	private:
+		struct alignas(64) shard {
+			mutable std::shared_mutex mutex;
+			intern_pool pool;
+		};
+		std::array<shard, shard_count> shards_;
+		
+		static size_t shard_of(uint64_t mixed) { return static_cast<size_t>(mixed >> 24) & (shard_count - 1); }
+		static id_type make_id(id_type local, size_t index) { return static_cast<id_type>((local << shard_bits) | index); }
+	};
+	
+	/**
+	 * @brief Splits `str` by `delim` like `split(str, char)`, into views of `str` instead of new strings.
+	 * @param tokens - cleared, then receives the tokens; reuse it across calls to keep its capacity.
+	 */
+	_CUTIL_FUNC_STATIC inline
+	void split_view(std::string_view str, const char delim, std::vector<std::string_view>& tokens)
+	{
+		tokens.clear();
+		const char* first = str.data();
+		const char* const last = first + str.size();
+		for (;;)
+		{
+			const void* found = first == last ? nullptr : std::memchr(first, delim, static_cast<size_t>(last - first));
+			const char* token_last = found ? static_cast<const char*>(found) : last;
+			tokens.emplace_back(first, static_cast<size_t>(token_last - first));
+			if (!found)
+			{
+				break;
+			}
+			first = token_last + 1;
+		}
+	}
+
+	/**
+	 * @brief Splits `str` by any of the characters in `delims` like `split_any()`, into views of `str`.
+	 * @param tokens - cleared, then receives the tokens.
+	 */
+	_CUTIL_FUNC_STATIC inline
+	void split_any_view(std::string_view str, std::string_view delims, std::vector<std::string_view>& tokens)
+	{
+		bool is_delim[256] = {};
+		for (char c : delims) {
+			is_delim[static_cast<uint8_t>(c)] = true;
+		}
+		tokens.clear();
+		size_t pos_start = 0;
+		for (size_t pos_end = 0; pos_end < str.size(); ++pos_end)
+		{
+			if (is_delim[static_cast<uint8_t>(str[pos_end])])
+			{
+				tokens.push_back(str.substr(pos_start, pos_end - pos_start));
+				pos_start = pos_end + 1;
+			}
+		}
+		tokens.push_back(str.substr(pos_start));
+	}
+
+	/**
+	 * @brief Splits `str` by `delim` like `split(str, char)`, into `inline_string<N>`s: the tokens are copied
+	 *        into one contiguous array, without a heap allocation per token and without referring back to `str`.
+	 * @param tokens - cleared, then receives the tokens.
+	 * @return false if a token is longer than `N`; `tokens` then holds the tokens before it.
+	 */
+	template<size_t N> _CUTIL_FUNC_STATIC
+	inline bool split_inline(std::string_view str, const char delim, std::vector<inline_string<N>>& tokens)
+	{
+		tokens.clear();
+		const char* first = str.data();
+		const char* const last = first + str.size();
+		for (;;)
+		{
+			const void* found = first == last ? nullptr : std::memchr(first, delim, static_cast<size_t>(last - first));
+			const char* token_last = found ? static_cast<const char*>(found) : last;
+			const std::string_view token(first, static_cast<size_t>(token_last - first));
+			if (!inline_string<N>::fits(token))
+			{
+				return false;
+			}
+			tokens.emplace_back(token);
+			if (!found)
+			{
+				return true;
+			}
+			first = token_last + 1;
+		}
+	}
+	
+	/**
+	 * @brief Trims white spaces from both sides of an `inline_string`, like `trim_copy()` does for std::string.
+	 */
+	template<size_t N> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
+	inline inline_string<N> trim_copy(const inline_string<N>& str)
+	{
+		const char* first = str.begin();
+		const char* last = str.end();
+		while (first != last && std::isspace(static_cast<uint8_t>(*first))) {
+			++first;
+		}
+		while (last != first && std::isspace(static_cast<uint8_t>(last[-1]))) {
+			--last;
+		}
+		return inline_string<N>(std::string_view(first, static_cast<size_t>(last - first)));
+	}
+/*
+	std::vector<std::string_view> fields;
+	cutil::str::split_view("a,b,,c", ',', fields);			// -> { "a", "b", "", "c" }, views into the line
+	cutil::str::split_any_view("k=v;x y", "=; ", fields);	// -> { "k", "v", "x", "y" }
+	
+	std::vector<cutil::str::inline_string<31>> tokens;		// 32 bytes per token, no heap pointers
+	if (cutil::str::split_inline("GET /index.html HTTP/1.1", ' ', tokens)) { ... }
+	cutil::str::join(tokens, "|");							// -> "GET|/index.html|HTTP/1.1", tokens are string-like
+	cutil::str::to_number_opt<int>(cutil::str::trim_copy(tokens[0]));	// string_view parameters take them as they are
+*/
+
+	/**
+	 * @brief Splits `str` by `delim` like `split(str, char)`, but appends interned ids instead of allocating strings.
+	 * @param str - text to split.
+	 * @param delim - the delimiter.
+	 * @param pool - `intern_pool` or `concurrent_intern_pool` the tokens are interned into.
+	 * @param ids - receives one id per token, not cleared first.
+	 */
+	template<typename Pool> _CUTIL_FUNC_STATIC
+	inline void split_interned(std::string_view str, const char delim, Pool& pool, std::vector<typename Pool::id_type>& ids)
+	{
+		const char* first = str.data();
+		const char* const last = first + str.size();
+		for (;;)
+		{
+			const void* found = first == last ? nullptr : std::memchr(first, delim, static_cast<size_t>(last - first));
+			const char* token_last = found ? static_cast<const char*>(found) : last;
+			ids.push_back(pool.intern(std::string_view(first, static_cast<size_t>(token_last - first))));
+			if (!found)
+			{
+				break;
+			}
+			first = token_last + 1;
+		}
+	}
+	
+	/**
+	 * @brief Splits `str` by `delim` like `split(str, char)` and returns the interned id of each token.
+	 * @return ids in `pool`, one per token; `pool.view(id)` gives the text.
+	 */
+	template<typename Pool> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
+	inline std::vector<typename Pool::id_type> split_interned(std::string_view str, const char delim, Pool& pool)
+	{
+		std::vector<typename Pool::id_type> ids;
+		split_interned(str, delim, pool, ids);
+		return ids;
+	}
+/*
+	cutil::str::intern_pool pool;
+	auto a = pool.intern("GET");				// -> 0
+	auto b = pool.intern(std::string("GET"));	// -> 0, no allocation
+	pool.view(a);								// -> "GET"
+	
+	std::vector<cutil::str::intern_pool::id_type> ids;
+	for (const auto& line : lines) {
+		ids.clear();
+		cutil::str::split_interned(line, ',', pool, ids); // repeated tokens cost a lookup, not a malloc
+	}
+	
+	cutil::str::concurrent_intern_pool shared; // same interface, safe to call from many threads
+*/
+	
+	
+	namespace internal{
+		//* ASCII 'A'-'Z' -> 'a'-'z' in each byte of `x`, other bytes (also >= 0x80) unchanged
+		inline uint64_t ascii_fold_8(uint64_t x) noexcept
+		{
+			const uint64_t low7 = x & 0x7F7F7F7F7F7F7F7Full;
+			const uint64_t above_z = low7 + 0x2525252525252525ull;	// high bit set if > 'Z'
+			const uint64_t from_a = low7 + 0x3F3F3F3F3F3F3F3Full;	// high bit set if >= 'A'
+			const uint64_t upper = (from_a ^ above_z) & ~x & 0x8080808080808080ull;
+			return x | (upper >> 2);
+		}
+		
+		//* up to 8 bytes of `p`, zero padded
+		inline uint64_t load_word(const char* p, size_t size) noexcept
+		{
+			uint64_t word = 0;
+			std::memcpy(&word, p, size < 8 ? size : 8);
+			return word;
+		}
+	}
+	
+	/**
+	 * @brief Case-insensitive hash, equality and ordering of ASCII strings, 8 bytes at a time.
+	 *        They agree with `compare_ignore_case()` in the "C" locale; bytes >= 0x80 compare as they are.
+	 *        All three are transparent: `std::string`, `std::string_view` and `const char*` keys mix without conversions,
+	 *        e.g. `std::map<std::string, T, ci_less>::find("Content-Type")` does not build a `std::string`.
+	 */
+	struct ci_hash {
+		using is_transparent = void;
+		
+		_CUTIL_NODISCARD size_t operator()(std::string_view str) const noexcept
+		{
+			const char* p = str.data();
+			size_t left = str.size();
+			uint64_t hash = 0x243F6A8885A308D3ull ^ str.size();
+			for (; left >= 8; p += 8, left -= 8) {
+				hash = (cutil::rotl(hash, 23) ^ internal::ascii_fold_8(internal::load_word(p, 8))) * 0x9E3779B97F4A7C15ull;
+			}
+			if (left != 0) {
+				hash = (cutil::rotl(hash, 23) ^ internal::ascii_fold_8(internal::load_word(p, left))) * 0x9E3779B97F4A7C15ull;
+			}
+			return static_cast<size_t>(hash ^ (hash >> 29));
+		}
+	};
+	
+	struct ci_equal {
+		using is_transparent = void;
+		
+		_CUTIL_NODISCARD bool operator()(std::string_view a, std::string_view b) const noexcept
+		{
+			if (a.size() != b.size()) {
+				return false;
+			}
+			for (size_t i = 0; i < a.size(); i += 8) {
+				const size_t n = a.size() - i;
+				if (internal::ascii_fold_8(internal::load_word(a.data() + i, n)) != internal::ascii_fold_8(internal::load_word(b.data() + i, n))) {
+					return false;
+				}
+			}
+			return true;
+		}
+	};
+	
+	struct ci_less {
+		using is_transparent = void;
+		
+		_CUTIL_NODISCARD bool operator()(std::string_view a, std::string_view b) const noexcept
+		{
+			const size_t common = std::min(a.size(), b.size());
+			for (size_t i = 0; i < common; i += 8) {
+				// big-endian keys, so the first differing byte decides
+				const uint64_t ka = internal::ascii_fold_8(internal::load_sort_key(a.data(), common, i));
+				const uint64_t kb = internal::ascii_fold_8(internal::load_sort_key(b.data(), common, i));
+				if (ka != kb) {
+					return ka < kb;
+				}
+			}
+			return a.size() < b.size();
+		}
+	};
+	
+	/**
+	 * @brief Map with case-insensitive `std::string` keys for small, hot tables such as protocol headers.
+	 *        Entries live in one vector in insertion order, indexed by an open-addressing hash table of `ci_hash`,
+	 *        so a lookup by any string type neither folds a copy of the key nor allocates.
+	 *        A key keeps the spelling it was first inserted with, and is const like in `std::map`.
+	 * @note  `erase()` keeps the insertion order and rebuilds the index, it is O(size()).
+	 */
+	template<typename T>
+	class ci_flat_map {
+	public:
+		using key_type = std::string;
+		using mapped_type = T;
+		using value_type = std::pair<const std::string, T>;
+		using iterator = typename std::vector<value_type>::iterator;
+		using const_iterator = typename std::vector<value_type>::const_iterator;
+		
+		ci_flat_map() : index_(0) {}
+		explicit ci_flat_map(size_t expected) : index_(expected)
+		{
+			reserve(expected);
+		}
+		ci_flat_map(std::initializer_list<value_type> init) : ci_flat_map(init.size())
+		{
+			for (const auto& entry : init) {
+				insert_or_assign(entry.first, entry.second);
+			}
+		}
+		
+		ci_flat_map(const ci_flat_map&) = default;
+		ci_flat_map(ci_flat_map&&) = default;
+		ci_flat_map& operator=(ci_flat_map&&) = default;
+		//* const keys cannot be copy-assigned in place, so the entries are copied into a new map and moved in
+		ci_flat_map& operator=(const ci_flat_map& other)
+		{
+			if (this != &other) {
+				*this = ci_flat_map(other);
+			}
+			return *this;
+		}
+		
+		_CUTIL_NODISCARD iterator find(std::string_view key)
+		{
+			uint32_t i;
+			return lookup(key, i) ? entries_.begin() + i : entries_.end();
+		}
+		_CUTIL_NODISCARD const_iterator find(std::string_view key) const
+		{
+			uint32_t i;
+			return lookup(key, i) ? entries_.begin() + i : entries_.end();
+		}
+		_CUTIL_NODISCARD bool contains(std::string_view key) const
+		{
+			uint32_t i;
+			return lookup(key, i);
+		}
+		
+		//* inserts `T(args...)` unless the key is there, returns the entry and whether it was inserted
+		template<typename... Args>
+		std::pair<iterator, bool> try_emplace(std::string_view key, Args&&... args)
+		{
+			const uint64_t mixed = internal::mix_hash(ci_hash()(key));
+			uint32_t i;
+			if (index_.find(mixed, equal_to(key), i)) {
+				return {entries_.begin() + i, false};
+			}
+			grow_for(entries_.size() + 1);
+			i = static_cast<uint32_t>(entries_.size());
+			entries_.emplace_back(std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+			mixed_.push_back(mixed);
+			index_.insert(mixed, i, [](uint32_t) { return false; });
+			return {entries_.begin() + i, true};
+		}
+		
+		template<typename V>
+		std::pair<iterator, bool> insert_or_assign(std::string_view key, V&& value)
+		{
+			auto result = try_emplace(key, std::forward<V>(value));
+			if (!result.second) {
+				result.first->second = std::forward<V>(value);
+			}
+			return result;
+		}
+		
+		T& operator[](std::string_view key) { return try_emplace(key).first->second; }
+		
+		//* value of `key`, throws `std::out_of_range` if missing
+		T& at(std::string_view key)
+		{
+			const auto it = find(key);
+			if (it == end()) {
+				throw std::out_of_range("ci_flat_map::at");
+			}
+			return it->second;
+		}
+		const T& at(std::string_view key) const
+		{
+			const auto it = find(key);
+			if (it == end()) {
+				throw std::out_of_range("ci_flat_map::at");
+			}
+			return it->second;
+		}
+		
+		//* returns the number of entries removed, 0 or 1
+		size_t erase(std::string_view key)
+		{
+			uint32_t i;
+			if (!lookup(key, i)) {
+				return 0;
+			}
+			// const keys cannot be move-assigned, so the other entries are moved into a new vector
+			std::vector<value_type> kept;
+			kept.reserve(entries_.capacity());
+			for (uint32_t k = 0; k < entries_.size(); ++k) {
+				if (k != i) {
+					kept.emplace_back(std::move(entries_[k]));
+				}
+			}
+			entries_.swap(kept);
+			mixed_.erase(mixed_.begin() + i);
+			index_.clear();
+			for (uint32_t k = 0; k < entries_.size(); ++k) {
+				index_.insert(mixed_[k], k, [](uint32_t) { return false; });
+			}
+			return 1;
+		}
+		
+		void reserve(size_t expected)
+		{
+			entries_.reserve(expected);
+			mixed_.reserve(expected);
+			grow_for(expected);
+		}
+		void clear()
+		{
+			entries_.clear();
+			mixed_.clear();
+			index_.clear();
+		}
+		
+		_CUTIL_NODISCARD size_t size() const noexcept { return entries_.size(); }
+		_CUTIL_NODISCARD bool empty() const noexcept { return entries_.empty(); }
+		iterator begin() noexcept { return entries_.begin(); }
+		iterator end() noexcept { return entries_.end(); }
+		const_iterator begin() const noexcept { return entries_.begin(); }
+		const_iterator end() const noexcept { return entries_.end(); }
+		
+	private:
+		auto equal_to(std::string_view key) const
+		{
+			return [this, key](uint32_t i) { return ci_equal()(entries_[i].first, key); };
+		}
+		
+		bool lookup(std::string_view key, uint32_t& i) const
+		{
+			return index_.find(internal::mix_hash(ci_hash()(key)), equal_to(key), i);
+		}
+		
+		void grow_for(size_t count)
+		{
+			if (count * 2 > index_.capacity()) {
+				index_.rehash(std::max(count, index_.capacity()), [this](uint32_t i) { return mixed_[i]; });
+			}
+		}
+		
+		std::vector<value_type> entries_;
+		std::vector<uint64_t> mixed_;		// hash of each entry, for rehashing
+		internal::index_set<uint32_t> index_;
+	};
+/*
+	std::unordered_map<std::string, int, cutil::str::ci_hash, cutil::str::ci_equal> m; // or std::map<std::string, int, cutil::str::ci_less>
+	cutil::str::ci_equal()("Content-Length", "content-length"); // -> true
+	
+	cutil::str::ci_flat_map<std::string> headers;
+	headers["Content-Type"] = "text/plain";
+	headers.find("content-type")->second;				// -> "text/plain", no lowercase copy
+	headers.try_emplace("HOST", "example.com");
+	for (const auto& [name, value] : headers) { ... }	// insertion order, original spelling
+*/
+	
+	
+#ifdef _CUTIL_STRINGUTIL_USE_PMR
+	/**
+	 * Overloads returning `std::pmr::string` / `std::pmr::vector`, every allocation of the result comes from `resource`.
+	 * They mirror the `std::string` functions of the same name (same splitting and trimming rules),
+	 * take any string as `std::string_view` and live in their own namespace, like `std::pmr`, to keep overload resolution unchanged.
+	 */
+	namespace pmr
+	{
+		using string = std::pmr::string;
+		using string_list = std::pmr::vector<std::pmr::string>;
+		
+		/**
+		 * @brief Splits `str` by `delim`, see `cutil::str::split(const std::string&, char, size_t)`.
+		 * @param resource - memory resource for the vector and the tokens.
+		 */
+		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+		string_list split(std::string_view str, const char delim, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+		{
+			string_list tokens(resource);
+			const char* first = str.data();
+			const char* const last = first + str.size();
+			for (;;)
+			{
+				const void* found = first == last ? nullptr : std::memchr(first, delim, static_cast<size_t>(last - first));
+				const char* token_last = found ? static_cast<const char*>(found) : last;
+				tokens.emplace_back(first, static_cast<size_t>(token_last - first));
+				if (!found)
+				{
+					break;
+				}
+				first = token_last + 1;
+			}
+			return tokens;
+		}
+		
+		/**
+		 * @brief Splits `str` by the string `delim`, see `cutil::str::split(const std::string&, const std::string&, size_t)`.
+		 */
+		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+		string_list split(std::string_view str, std::string_view delim, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+		{
+			string_list tokens(resource);
+			size_t pos_start = 0, pos_end;
+			while ((pos_end = str.find(delim, pos_start)) != std::string_view::npos)
+			{
+				tokens.emplace_back(str.substr(pos_start, pos_end - pos_start));
+				pos_start = pos_end + delim.size();
+			}
+			tokens.emplace_back(str.substr(pos_start));
+			return tokens;
+		}
+		
+		/**
+		 * @brief Splits `str` by any of the characters in `delims`, see `cutil::str::split_any()`.
+		 */
+		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+		string_list split_any(std::string_view str, std::string_view delims, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+		{
+			string_list tokens(resource);
+			size_t pos_start = 0;
+			for (size_t pos_end = 0; pos_end < str.size(); ++pos_end)
+			{
+				if (delims.find(str[pos_end]) != std::string_view::npos)
+				{
+					tokens.emplace_back(str.substr(pos_start, pos_end - pos_start));
+					pos_start = pos_end + 1;
+				}
+			}
+			tokens.emplace_back(str.substr(pos_start));
+			return tokens;
+		}
+		
+		/**
+		 * @brief Splits `src` using a regex as the delimiter, see `cutil::str::regex_split()`.
+		 * @note  Only the result uses `resource`, `std::regex` itself allocates from the global heap.
+		 */
+		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+		string_list regex_split(std::string_view src, const std::regex& rgx, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+		{
+			string_list tokens(resource);
+			std::cregex_token_iterator iter(src.data(), src.data() + src.size(), rgx, -1);
+			std::cregex_token_iterator end;
+			for (; iter != end; ++iter)
+			{
+				tokens.emplace_back(iter->first, iter->second);
+			}
+			return tokens;
+		}
+		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+		string_list regex_split(std::string_view src, const std::string& rgx_str, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+		{
+			return regex_split(src, std::regex(rgx_str), resource);
+		}
+		
+		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+		string to_lower(std::string_view str, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+		{
+			string result(str, resource);
+			std::transform(result.begin(), result.end(), result.begin(), [](uint8_t c) -> uint8_t
+			{
+				return static_cast<uint8_t>(std::tolower(c));
+			});
+			return result;
+		}
+		
+		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+		string to_upper(std::string_view str, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+		{
+			string result(str, resource);
+			std::transform(result.begin(), result.end(), result.begin(), [](uint8_t c) -> uint8_t
+			{
+				return static_cast<uint8_t>(std::toupper(c));
+			});
+			return result;
+		}
+		
+		//* only the trimmed part is copied
+		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+		string trim_left_copy(std::string_view str, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+		{
+			const auto first = std::find_if(str.begin(), str.end(), [](int ch) { return !std::isspace(ch); });
+			return string(first, str.end(), resource);
+		}
+		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+		string trim_right_copy(std::string_view str, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+		{
+			const auto last = std::find_if(str.rbegin(), str.rend(), [](int ch) { return !std::isspace(ch); }).base();
+			return string(str.begin(), last, resource);
+		}
+		_CUTIL_NODISCARD _CUTIL_FUNC_STATIC inline
+		string trim_copy(std::string_view str, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+		{
+			const auto first = std::find_if(str.begin(), str.end(), [](int ch) { return !std::isspace(ch); });
+			const auto last = std::find_if(str.rbegin(), std::make_reverse_iterator(first), [](int ch) { return !std::isspace(ch); }).base();
+			return string(first, last, resource);
+		}
+		
+		/**
+		 * @brief Copies the non-empty strings of `tokens`, see `cutil::str::drop_empty_copy()`.
+		 * @param tokens - container of string-like tokens (std::string, std::pmr::string, std::string_view, const char*).
+		 */
+		template<typename Container> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
+		inline string_list drop_empty_copy(const Container& tokens, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+		{
+			string_list result(resource);
+			for (const auto& each : tokens)
+			{
+				const std::string_view token(each);
+				if (!token.empty())
+				{
+					result.emplace_back(token);
+				}
+			}
+			return result;
+		}
+		
+		/**
+		 * @brief Joins string-like tokens with `delim` into one exactly sized allocation from `resource`.
+		 */
+		template<typename Container> _CUTIL_NODISCARD _CUTIL_FUNC_STATIC
+		inline string join(const Container& tokens, std::string_view delim, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+		{
+			size_t total = 0;
+			size_t count = 0;
+			for (const auto& each : tokens)
+			{
+				total += std::string_view(each).size();
+				++count;
+			}
+			string result(resource);
+			if (count == 0)
+			{
+				return result;
+			}
+			result.reserve(total + delim.size() * (count - 1));
+			bool first = true;
+			for (const auto& each : tokens)
+			{
+				if (!first)
+				{
+					result.append(delim);
+				}
+				result.append(std::string_view(each));
+				first = false;
+			}
+			return result;
+		}
+	} // namespace pmr
+/*
+	char buffer[16 * 1024];
+	for (const auto& line : lines) {
+		std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer)); // falls back to the heap when full
+		auto fields = cutil::str::pmr::split(line, ',', &arena);
+		auto key = cutil::str::pmr::to_lower(cutil::str::pmr::trim_copy(fields[0], &arena), &arena);
+		...
+	} // everything released at once, nothing freed one by one
+*/
+#endif
+	
 #endif
 
 
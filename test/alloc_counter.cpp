@@ -0,0 +1,50 @@
+#include "alloc_counter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+//* the global `operator new` / `operator delete` of the test binary, replaced to count allocations.
+//  kept in a translation unit of their own, so callers see plain calls instead of an inlined `malloc()` / `free()`.
+namespace {
+    std::atomic<bool> counted{false};
+    std::atomic<size_t> allocations{0};
+
+    void* allocate(size_t size) noexcept
+    {
+        if (counted.load(std::memory_order_relaxed)) {
+            allocations.fetch_add(1, std::memory_order_relaxed);
+        }
+        return std::malloc(size != 0 ? size : 1);
+    }
+
+    void* allocate_or_throw(size_t size)
+    {
+        void* ptr = allocate(size);
+        if (ptr == nullptr) {
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+}
+
+size_t count_allocations(const std::function<void()>& func)
+{
+    allocations = 0;
+    counted = true;
+    func();
+    counted = false;
+    return allocations;
+}
+
+void* operator new(size_t size) { return allocate_or_throw(size); }
+void* operator new[](size_t size) { return allocate_or_throw(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return allocate(size); }
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { std::free(ptr); }
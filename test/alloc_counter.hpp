@@ -0,0 +1,10 @@
+#ifndef CONSOLEUTIL_TEST_ALLOC_COUNTER_HPP__
+#define CONSOLEUTIL_TEST_ALLOC_COUNTER_HPP__
+
+#include <cstddef>
+#include <functional>
+
+//* number of `operator new` calls made by `func()`, counted by the operators replaced in alloc_counter.cpp
+size_t count_allocations(const std::function<void()>& func);
+
+#endif // CONSOLEUTIL_TEST_ALLOC_COUNTER_HPP__
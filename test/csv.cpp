@@ -0,0 +1,131 @@
+
+#include <gtest/gtest.h>
+
+#include <ConsoleUtil/Base.h>
+
+#ifdef CUTIL_CPP17_SUPPORTED // C++17 required
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+
+#include "ConsoleUtil/CppCsvReader.hpp"
+
+namespace {
+	using table = std::vector<std::vector<std::string>>;
+
+	std::string to_csv(const table& rows, bool crlf = false)
+	{
+		std::string text;
+		for (const auto& row : rows) {
+			for (size_t i = 0; i < row.size(); ++i) {
+				const std::string& field = row[i];
+				if (field.find_first_of(",\"\r\n") != std::string::npos) {
+					text += '"';
+					for (char c : field) {
+						text += c;
+						if (c == '"') {
+							text += '"';
+						}
+					}
+					text += '"';
+				} else {
+					text += field;
+				}
+				text += i + 1 < row.size() ? "," : "";
+			}
+			text += crlf ? "\r\n" : "\n";
+		}
+		return text;
+	}
+
+	table read_file(const std::string& path, size_t chunk_size)
+	{
+		cutil::str::file_splitter file;
+		EXPECT_FALSE(file.open(path));
+		cutil::str::csv_reader reader(file, ',', '"', chunk_size);
+		table rows;
+		std::vector<std::string_view> fields;
+		while (reader.next_row(fields)) {
+			rows.emplace_back(fields.begin(), fields.end());
+		}
+		EXPECT_EQ(std::errc(), reader.error());
+		return rows;
+	}
+}
+
+TEST(Csv, rfc4180)
+{
+	EXPECT_EQ((table{{"a", "b", "c"}, {"1", "2", "3"}}), cutil::str::parse_csv("a,b,c\n1,2,3\n"));
+	EXPECT_EQ((table{{"a", "b"}, {"1", "2"}}), cutil::str::parse_csv("a,b\r\n1,2"));	// CRLF, no line break at the end
+	EXPECT_EQ((table{{"x", "", ""}, {""}, {"y"}}), cutil::str::parse_csv("x,,\n\ny\n"));	// empty fields, empty line
+	EXPECT_EQ(table{}, cutil::str::parse_csv(""));
+	EXPECT_EQ((table{{"Smith, J.", "say \"hi\"", "two\nlines", ""}}),
+			  cutil::str::parse_csv("\"Smith, J.\",\"say \"\"hi\"\"\",\"two\nlines\",\"\"\n"));
+	EXPECT_EQ((table{{"\"", "a\r\nb"}}), cutil::str::parse_csv("\"\"\"\",\"a\r\nb\"\r\n"));
+	EXPECT_EQ((table{{"a,b", "c"}}), cutil::str::parse_csv("a,b\tc", '\t', '\0'));	// TSV without quoting
+	EXPECT_EQ((table{{"\"x\"", "y"}}), cutil::str::parse_csv("\"x\"\ty", '\t', '\0'));
+
+	// fields are views into the input, unless they had doubled quotes
+	const std::string text = "plain,\"quoted\",\"dou\"\"bled\"\n";
+	cutil::str::csv_reader reader(text);
+	std::vector<std::string_view> fields;
+	ASSERT_TRUE(reader.next_row(fields));
+	ASSERT_EQ(3u, fields.size());
+	EXPECT_EQ(text.data(), fields[0].data());
+	EXPECT_EQ(text.data() + 7, fields[1].data());
+	EXPECT_EQ("dou\"bled", fields[2]);
+	EXPECT_FALSE(reader.next_row(fields));
+	EXPECT_EQ(1u, reader.rows());
+
+	cutil::str::csv_reader open_quote("a,\"never closed\nb");
+	ASSERT_TRUE(open_quote.next_row(fields));
+	EXPECT_EQ((std::vector<std::string_view>{"a", "never closed\nb"}), fields);
+	EXPECT_EQ(std::errc::illegal_byte_sequence, open_quote.error());
+}
+
+TEST(Csv, random_tables)
+{
+	std::mt19937 gen(7);
+	const char alphabet[] = "ab,\"\r\n x";
+	for (int round = 0; round < 300; ++round) {
+		table rows(gen() % 40);
+		for (auto& row : rows) {
+			row.resize(1 + gen() % 6);
+			for (auto& field : row) {
+				const size_t size = gen() % 4 == 0 ? gen() % 200 : gen() % 8; // some fields across 64-byte blocks
+				for (size_t i = 0; i < size; ++i) {
+					field += alphabet[gen() % (sizeof(alphabet) - 1)];
+				}
+			}
+			if (row.size() == 1 && row[0].empty()) {
+				row[0] = "e"; // an empty line would do, but keep it unambiguous
+			}
+		}
+		const bool crlf = gen() % 2 != 0;
+		const std::string text = to_csv(rows, crlf);
+		ASSERT_EQ(rows, cutil::str::parse_csv(text)) << text;
+	}
+}
+
+TEST(Csv, streamed_from_file)
+{
+	std::mt19937 gen(3);
+	table rows;
+	for (int i = 0; i < 3000; ++i) {
+		rows.push_back({std::to_string(i), "line one\nline two, with \"quotes\"", std::string(gen() % 300, 'q'), ""});
+	}
+	rows.push_back({std::string(100000, '\n')}); // one quoted field over many chunks
+	rows.push_back({"last"});
+	const std::string text = to_csv(rows);
+	const std::string path = (std::filesystem::temp_directory_path() / "cutil_csv_test.csv").string();
+	std::ofstream(path, std::ios::binary) << text;
+
+	for (size_t chunk_size : {size_t(1), size_t(64), size_t(1000), size_t(1) << 20}) {
+		EXPECT_EQ(rows, read_file(path, chunk_size)) << chunk_size;
+	}
+	std::remove(path.c_str());
+}
+
+#endif // C++17
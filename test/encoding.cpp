@@ -0,0 +1,188 @@
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "ConsoleUtil/CppEncoding.hpp"
+
+namespace {
+	// every validator the machine can run, they have to agree
+	std::vector<const char*> validate_all(const std::string& str)
+	{
+		const char* first = str.data();
+		const char* last = first + str.size();
+		std::vector<const char*> result;
+		result.push_back(cutil::str::validate_utf8(first, last).ptr);
+		result.push_back(cutil::str::internal::validate_utf8_scalar(first, last));
+	#ifdef _CUTIL_ENCODING_USE_SSSE3
+		if (cutil::str::internal::cpu_has_ssse3()) {
+			result.push_back(cutil::str::internal::validate_utf8_ssse3(first, last));
+		}
+	#endif
+		return result;
+	}
+	size_t invalid_at(const std::string& str)
+	{
+		const auto results = validate_all(str);
+		for (const char* p : results) {
+			EXPECT_EQ(results.front(), p) << "validators disagree";
+		}
+		return static_cast<size_t>(results.front() - str.data());
+	}
+
+	std::string encode_utf8(uint32_t cp)
+	{
+		std::string result;
+		if (cp < 0x80) {
+			result += static_cast<char>(cp);
+		} else if (cp < 0x800) {
+			result += static_cast<char>(0xC0 | (cp >> 6));
+			result += static_cast<char>(0x80 | (cp & 0x3F));
+		} else if (cp < 0x10000) {
+			result += static_cast<char>(0xE0 | (cp >> 12));
+			result += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+			result += static_cast<char>(0x80 | (cp & 0x3F));
+		} else {
+			result += static_cast<char>(0xF0 | (cp >> 18));
+			result += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+			result += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+			result += static_cast<char>(0x80 | (cp & 0x3F));
+		}
+		return result;
+	}
+}
+
+TEST(Encoding, validate_utf8)
+{
+	const std::string padding(40, 'a'); // puts the sequences into the SIMD blocks too
+	const std::vector<std::string> valid = {
+		"", "plain ascii", "\xC2\x80", "\xDF\xBF", "\xE0\xA0\x80", "\xED\x9F\xBF", "\xEE\x80\x80", "\xEF\xBF\xBF",
+		"\xF0\x90\x80\x80", "\xF4\x8F\xBF\xBF", "\xE4\xB8\xAD\xE6\x96\x87 \xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E",
+	};
+	const std::vector<std::string> invalid = {
+		"\x80", "\xBF", "\xC0\x80", "\xC1\xBF", "\xC2", "\xC2\x41", "\xE0\x9F\xBF", "\xED\xA0\x80", "\xED\xBF\xBF",
+		"\xE4\xB8", "\xE4\xB8\x41", "\xF0\x8F\xBF\xBF", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xFF",
+		"\xF0\x90\x80", "\xC2\x80\x80", "\xE4\xB8\xAD\xAD",
+	};
+	for (const auto& seq : valid) {
+		for (size_t offset : {size_t(0), size_t(13), size_t(14), size_t(15), size_t(16), size_t(40)}) {
+			const std::string str = padding.substr(0, offset) + seq + padding;
+			EXPECT_EQ(str.size(), invalid_at(str)) << offset;
+			EXPECT_TRUE(cutil::str::is_valid_utf8(padding.substr(0, offset) + seq)) << offset; // ends with the sequence
+		}
+	}
+	for (const auto& seq : invalid) {
+		for (size_t offset : {size_t(0), size_t(13), size_t(14), size_t(15), size_t(16), size_t(40), size_t(70)}) {
+			const std::string prefix = std::string(offset, 'a');
+			EXPECT_GE(invalid_at(prefix + seq + padding), offset) << offset;
+			EXPECT_LE(invalid_at(prefix + seq + padding), offset + seq.size()) << offset;
+			EXPECT_FALSE(cutil::str::is_valid_utf8(prefix + seq)) << offset; // also when the input ends there
+		}
+	}
+
+	const std::string text = "x\xE4\xB8\xAD\x80y";
+	const auto res = cutil::str::validate_utf8(text.data(), text.data() + text.size());
+	EXPECT_EQ(std::errc::illegal_byte_sequence, res.ec);
+	EXPECT_EQ(text.data() + 4, res.ptr);
+}
+
+TEST(Encoding, validate_utf8_random)
+{
+	std::mt19937 gen(11);
+	for (int round = 0; round < 20000; ++round) {
+		// valid text of mixed lengths, then a few random byte flips
+		std::string str;
+		const size_t chars = gen() % 60;
+		for (size_t i = 0; i < chars; ++i) {
+			uint32_t cp;
+			switch (gen() % 4) {
+				case 0: cp = gen() % 0x80; break;
+				case 1: cp = 0x80 + gen() % (0x800 - 0x80); break;
+				case 2: do { cp = 0x800 + gen() % (0x10000 - 0x800); } while (cp >= 0xD800 && cp < 0xE000); break;
+				default: cp = 0x10000 + gen() % (0x110000 - 0x10000); break;
+			}
+			str += encode_utf8(cp);
+		}
+		ASSERT_EQ(str.size(), invalid_at(str));
+		const size_t flips = gen() % 3;
+		for (size_t k = 0; k < flips && !str.empty(); ++k) {
+			str[gen() % str.size()] = static_cast<char>(gen() % 256);
+		}
+		invalid_at(str); // compares the validators
+	}
+}
+
+TEST(Encoding, to_utf8)
+{
+	using cutil::str::codepage;
+	EXPECT_EQ("\xE4\xB8\xAD\xE6\x96\x87 abc", cutil::str::to_utf8(codepage::gbk, "\xD6\xD0\xCE\xC4 abc"));	// "中文"
+	EXPECT_EQ("\xE2\x82\xAC", cutil::str::to_utf8(codepage::gbk, "\x80"));								// CP936 euro sign
+	EXPECT_EQ("\xE4\xB8\xAD\xE6\x96\x87", cutil::str::to_utf8(codepage::big5, "\xA4\xA4\xA4\xE5"));			// "中文"
+	EXPECT_EQ("\xE6\x97\xA5\xE6\x9C\xAC", cutil::str::to_utf8(codepage::shift_jis, "\x93\xFA\x96\x7B"));		// "日本"
+	EXPECT_EQ("\xEF\xBD\xB1", cutil::str::to_utf8(codepage::shift_jis, "\xB1"));							// half-width katakana
+
+	char buf[16];
+	auto res = cutil::str::to_utf8(codepage::gbk, "ab\xD6", 3, buf, sizeof(buf)); // lead byte without trail
+	EXPECT_EQ(std::errc::illegal_byte_sequence, res.ec);
+	EXPECT_EQ(2u, res.read);
+	EXPECT_EQ(2u, res.written);
+	res = cutil::str::to_utf8(codepage::gbk, "\xD6\x30", 2, buf, sizeof(buf), true); // bad trail, which is kept as ASCII
+	EXPECT_TRUE(res.ok());
+	EXPECT_EQ("\xEF\xBF\xBD" "0", std::string(buf, res.written));
+
+	res = cutil::str::to_utf8(codepage::gbk, "abc\xD6\xD0", 5, buf, 4); // room for "abc" only
+	EXPECT_EQ(std::errc::value_too_large, res.ec);
+	EXPECT_EQ(3u, res.read);
+	EXPECT_EQ(3u, res.written);
+}
+
+TEST(Encoding, from_utf8)
+{
+	using cutil::str::codepage;
+	EXPECT_EQ("\xD6\xD0\xCE\xC4 abc", cutil::str::from_utf8(codepage::gbk, "\xE4\xB8\xAD\xE6\x96\x87 abc"));
+	EXPECT_EQ("\x80", cutil::str::from_utf8(codepage::gbk, "\xE2\x82\xAC"));
+	EXPECT_EQ("\xA4\xA4\xA4\xE5", cutil::str::from_utf8(codepage::big5, "\xE4\xB8\xAD\xE6\x96\x87"));
+	EXPECT_EQ("\x93\xFA\x96\x7B\xB1", cutil::str::from_utf8(codepage::shift_jis, "\xE6\x97\xA5\xE6\x9C\xAC\xEF\xBD\xB1"));
+	EXPECT_EQ("a?b??", cutil::str::from_utf8(codepage::gbk, "a\xF0\x9F\x98\x80" "b\xC0\x80")); // emoji, malformed bytes
+
+	char buf[16];
+	auto res = cutil::str::from_utf8(codepage::shift_jis, "ok\xF0\x9F\x98\x80", 6, buf, sizeof(buf));
+	EXPECT_EQ(std::errc::illegal_byte_sequence, res.ec);
+	EXPECT_EQ(2u, res.read);
+	res = cutil::str::from_utf8(codepage::gbk, "\xE4\xB8\xAD\xE6\x96\x87", 6, buf, 3);
+	EXPECT_EQ(std::errc::value_too_large, res.ec);
+	EXPECT_EQ(3u, res.read);
+	EXPECT_EQ(2u, res.written);
+}
+
+TEST(Encoding, round_trip_all_codes)
+{
+	using cutil::str::codepage;
+	for (codepage cp : {codepage::gbk, codepage::big5, codepage::shift_jis}) {
+		size_t mapped = 0;
+		for (int lead = 0x81; lead <= 0xFE; ++lead) {
+			const char single = static_cast<char>(lead);
+			char u8[8];
+			if (cutil::str::to_utf8(cp, &single, 1, u8, sizeof(u8)).ok()) {
+				continue; // single-byte character, e.g. CP932 half-width katakana
+			}
+			for (int trail = 0x40; trail <= 0xFE; ++trail) {
+				const char code[2] = {static_cast<char>(lead), static_cast<char>(trail)};
+				const auto res = cutil::str::to_utf8(cp, code, 2, u8, sizeof(u8));
+				if (!res.ok()) {
+					continue; // not a double-byte character
+				}
+				++mapped;
+				ASSERT_TRUE(cutil::str::is_valid_utf8(u8, res.written));
+				char back[4];
+				const auto back_res = cutil::str::from_utf8(cp, u8, res.written, back, sizeof(back));
+				ASSERT_TRUE(back_res.ok());
+				// a few characters have two codes, the code page encodes them with the other one
+				const auto again = cutil::str::to_utf8(cp, back, back_res.written, u8 + 4, 4);
+				ASSERT_TRUE(again.ok());
+				ASSERT_EQ(std::string(u8, res.written), std::string(u8 + 4, again.written)) << lead << " " << trail;
+			}
+		}
+		EXPECT_GT(mapped, 7000u);
+	}
+}
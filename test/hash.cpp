@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "ConsoleUtil/CppHash.hpp"
+
+namespace {
+	std::vector<uint8_t> random_bytes(size_t size, std::mt19937_64& rng)
+	{
+		std::vector<uint8_t> bytes(size);
+		for (uint8_t& b : bytes) {
+			b = static_cast<uint8_t>(rng());
+		}
+		return bytes;
+	}
+
+	int popcount(uint64_t v)
+	{
+		int n = 0;
+		for (; v != 0; v &= v - 1) {
+			++n;
+		}
+		return n;
+	}
+}
+
+TEST(Hash, fnv1a)
+{
+	static_assert(cutil::fnv1a_32("") == 0x811C9DC5u, "");
+	static_assert(cutil::fnv1a_64("") == 0xCBF29CE484222325u, "");
+	// the reference test vectors
+	EXPECT_EQ(cutil::fnv1a_32("a"), 0xE40C292Cu);
+	EXPECT_EQ(cutil::fnv1a_32("foobar"), 0xBF9CF968u);
+	EXPECT_EQ(cutil::fnv1a_64("a"), 0xAF63DC4C8601EC8Cu);
+	EXPECT_EQ(cutil::fnv1a_64("foobar"), 0x85944171F73967E8u);
+	// continuing from an earlier result is hashing the joined input
+	EXPECT_EQ(cutil::fnv1a_64("bar", 3, cutil::fnv1a_64("foo")), cutil::fnv1a_64("foobar"));
+	EXPECT_EQ(cutil::fnv1a_64(std::string("foobar").c_str(), 6), cutil::fnv1a_64("foobar"));
+}
+
+TEST(Hash, hash_bytes)
+{
+	std::mt19937_64 rng(1);
+	const auto bytes = random_bytes(300, rng);
+	std::unordered_set<uint64_t> seen;
+	for (size_t size = 0; size <= bytes.size(); ++size) {
+		const uint64_t h = cutil::hash_bytes(bytes.data(), size);
+		EXPECT_TRUE(seen.insert(h).second) << size; // every prefix differs
+		EXPECT_NE(h, cutil::hash_bytes(bytes.data(), size, 1));
+		EXPECT_EQ(h, cutil::hash_bytes(bytes.data(), size)); // deterministic
+	}
+	// only the bytes matter, not where they are
+	std::vector<uint8_t> moved(bytes.size() + 7);
+	std::copy(bytes.begin(), bytes.end(), moved.begin() + 7);
+	EXPECT_EQ(cutil::hash_bytes(bytes.data(), 100), cutil::hash_bytes(moved.data() + 7, 100));
+
+	const std::string str = "hello world";
+	EXPECT_EQ(cutil::hash_string(str), cutil::hash_bytes(str.data(), str.size()));
+	EXPECT_EQ(cutil::hash_string("hello world"), cutil::hash_string(str));
+	const uint32_t words[] = {1, 2, 3};
+	EXPECT_EQ(cutil::hash_bytes(cutil::span<const uint32_t>(words)), cutil::hash_bytes(words, sizeof(words)));
+	EXPECT_EQ(cutil::string_hash()(str), static_cast<size_t>(cutil::hash_string(str)));
+	EXPECT_NE(cutil::hash_combine(1, 2), cutil::hash_combine(2, 1));
+}
+
+TEST(Hash, known_answers)
+{
+	// fixed results, the same on every standard library, CPU and compiler; a change here breaks stored hashes
+	EXPECT_EQ(cutil::hash_bytes("", 0), 0x93228A4DE0EEC5A2u);
+	EXPECT_EQ(cutil::hash_bytes("", 0, 1), 0xDDAC86087A217154u);
+	EXPECT_EQ(cutil::hash_string("a"), 0xACED12527FE5BFF8u);
+	EXPECT_EQ(cutil::hash_string("abc"), 0x989B4A209C1011C9u);
+	EXPECT_EQ(cutil::hash_string("The quick brown fox jumps over the lazy dog"), 0x08E445DF107BB587u);
+	EXPECT_EQ(cutil::hash_bytes("The quick brown fox jumps over the lazy dog", 43, 42), 0x4DE361BB10D3D7FCu);
+
+	std::vector<uint8_t> bytes(1500);
+	for (size_t i = 0; i < bytes.size(); ++i) {
+		bytes[i] = static_cast<uint8_t>(i * 131 + 7);
+	}
+	// every length of 1 - 64 bytes: each tail and block path
+	static const uint64_t prefixes[64] = {
+		0x9676022BFD177D90u, 0x1E3010AA3060F518u, 0x2CB96FB680F039D3u, 0x00608F468834D3B2u,
+		0x993AB60716B626F1u, 0x388CD7C7E5D9FD31u, 0x12078037F8E4E75Eu, 0xA50955DCEC919A0Du,
+		0xA508C21031BC87F3u, 0x4183BE85913D5232u, 0xA0947E65EA2C0746u, 0x5433AD10F564560Fu,
+		0x022CDB328402D616u, 0x992158719734DCA8u, 0x81A835D48A01BF6Eu, 0x8B286F37C7E28104u,
+		0x352601C4B5EB6031u, 0x7BE5F21BFCE5B783u, 0x1371AE6D12919CDFu, 0x8BC70F87BA4540BEu,
+		0x5C8C6B3DC6E9C94Eu, 0x6BCE5DEB356DF9A3u, 0xB06CBD41541DB9C9u, 0x9994ED34DB6EEB68u,
+		0xE3B509CF42C3EC43u, 0x2F3394CC69BDE93Au, 0x2B260196BEC1DC27u, 0xD09127C93BA75B43u,
+		0xB22A4E864D1FA7D3u, 0xD297263B91ADDD42u, 0xEC10901EEAD37B64u, 0x4A799D4A3E942FD9u,
+		0xE8403E2B42D5D6ACu, 0xEB9FC535F5952B5Eu, 0x620C696F1B60792Bu, 0x33FC7E3841BD22DDu,
+		0xF1EC9FF3E6B037C6u, 0xEAAEA49ECD26E955u, 0xBD4D43B0B87D989Fu, 0xE0D3D0495CA69B23u,
+		0xD6F421A76FCFD5E4u, 0x87D499EE2E06AFF2u, 0xB9D6EC2667F458C9u, 0x2F84C4B8C02E875Eu,
+		0xAAF1B93DD57ABC5Fu, 0x3399DE9DCB750C5Du, 0xD980D1A18846C03Bu, 0xEB3441195CF44EA6u,
+		0xF4E347C5BD40EB16u, 0x11505767C55A12D5u, 0x66F97F4756A0863Eu, 0xC243016491940871u,
+		0x62717262902FB749u, 0x02464247E831180Cu, 0x47090D8E681F173Du, 0x72A5FD6BA741AEBCu,
+		0x303CBCEBAE90901Eu, 0x93B5167C2C0DE039u, 0xFC5B55A1D1F5A0FCu, 0xEDE340C85D8A4CDAu,
+		0xA2079B3ED94152D3u, 0x04299661EF437FD8u, 0xB9B8C695E151F4A5u, 0x2812D8B7E7124BFEu
+	};
+	for (size_t size = 1; size <= 64; ++size) {
+		EXPECT_EQ(cutil::hash_bytes(bytes.data(), size), prefixes[size - 1]) << size;
+	}
+	EXPECT_EQ(cutil::hash_bytes(bytes.data(), bytes.size()), 0x657BA42708107A53u);
+	EXPECT_EQ(cutil::hash_bytes(bytes.data(), bytes.size(), 7), 0xA87EB333384B444Fu);
+
+	cutil::hash_stream stream(7);
+	for (size_t i = 0; i < bytes.size(); i += 100) {
+		stream.update(bytes.data() + i, 100);
+	}
+	EXPECT_EQ(stream.digest(), 0xA87EB333384B444Fu);
+}
+
+TEST(Hash, hash_stream)
+{
+	std::mt19937_64 rng(2);
+	const auto bytes = random_bytes(1000, rng);
+	for (size_t size = 0; size <= bytes.size(); size += (size < 200 ? 1 : 53)) {
+		for (size_t max_chunk : {1, 7, 16, 47, 48, 49, 100, 1000}) {
+			cutil::hash_stream stream(5);
+			for (size_t i = 0; i < size;) {
+				const size_t chunk = std::min<size_t>(size - i, 1 + rng() % max_chunk);
+				stream.update(bytes.data() + i, chunk);
+				i += chunk;
+			}
+			ASSERT_EQ(stream.digest(), cutil::hash_bytes(bytes.data(), size, 5)) << size << ' ' << max_chunk;
+			ASSERT_EQ(stream.size(), size);
+		}
+	}
+	cutil::hash_stream stream;
+	stream.update(std::string("foo")).update(std::string("bar"));
+	EXPECT_EQ(stream.digest(), cutil::hash_string("foobar"));
+	stream.reset();
+	EXPECT_EQ(stream.digest(), cutil::hash_string(""));
+}
+
+//* SMHasher's avalanche test: flipping any input bit flips every output bit with probability 1/2
+TEST(HashQuality, avalanche)
+{
+	std::mt19937_64 rng(3);
+	for (size_t size : {1, 2, 3, 4, 8, 12, 16, 17, 32, 48, 49, 64, 100}) {
+		const size_t keys = size <= 2 ? size_t(1) << (8 * size) : 1000; // short keys: all of them
+		std::vector<int> flips(size * 8 * 64, 0);
+		for (size_t k = 0; k < keys; ++k) {
+			auto key = random_bytes(size, rng);
+			if (size <= 2) {
+				std::memcpy(key.data(), &k, size);
+			}
+			const uint64_t h = cutil::hash_bytes(key.data(), size);
+			for (size_t bit = 0; bit < size * 8; ++bit) {
+				key[bit / 8] ^= static_cast<uint8_t>(1u << (bit % 8));
+				const uint64_t diff = h ^ cutil::hash_bytes(key.data(), size);
+				key[bit / 8] ^= static_cast<uint8_t>(1u << (bit % 8));
+				for (int out = 0; out < 64; ++out) {
+					flips[bit * 64 + out] += static_cast<int>((diff >> out) & 1);
+				}
+			}
+		}
+		// the worst of up to 51200 (input bit, output bit) cells, each a fair coin thrown `keys` times: within 6 sigma
+		double worst = 0;
+		for (int n : flips) {
+			worst = std::max(worst, std::abs(n / double(keys) - 0.5));
+		}
+		EXPECT_LT(worst, 6 * 0.5 / std::sqrt(double(keys))) << "input size " << size;
+	}
+}
+
+//* keys that differ little: counters, sparse bit patterns, shared prefixes; no 64-bit collisions,
+//  and about as many collisions in the low 32 bits as random values would have
+TEST(HashQuality, collisions)
+{
+	std::vector<std::string> keys;
+	for (int i = 0; i < 100000; ++i) {
+		keys.push_back(std::to_string(i));
+		keys.push_back("key_" + std::to_string(i) + "_value");
+	}
+	for (size_t size : {8, 16, 32, 64}) { // one or two bits set in zeros
+		for (size_t a = 0; a < size * 8; ++a) {
+			std::string key(size, '\0');
+			key[a / 8] = static_cast<char>(1 << (a % 8));
+			keys.push_back(key);
+			for (size_t b = a + 1; b < size * 8; ++b) {
+				std::string two = key;
+				two[b / 8] = static_cast<char>(two[b / 8] | (1 << (b % 8)));
+				keys.push_back(two);
+			}
+		}
+	}
+	for (size_t n = 0; n < 1000; ++n) {
+		keys.push_back(std::string(n, 'a'));
+	}
+
+	std::vector<uint64_t> full, low;
+	for (const auto& key : keys) {
+		full.push_back(cutil::hash_string(key));
+		low.push_back(full.back() & 0xFFFFFFFFu);
+	}
+	const auto collisions = [](std::vector<uint64_t>& values) {
+		std::sort(values.begin(), values.end());
+		return values.size() - static_cast<size_t>(std::unique(values.begin(), values.end()) - values.begin());
+	};
+	EXPECT_EQ(collisions(full), 0u);
+	const double n = static_cast<double>(keys.size());
+	const double expected = n * (n - 1) / 2 / 4294967296.0; // about 9 for these keys
+	EXPECT_LT(static_cast<double>(collisions(low)), 3 * expected + 10);
+}
+
+//* SMHasher's bucket test: the low bits, as a hash table uses them, are evenly filled by sequential keys
+TEST(HashQuality, distribution)
+{
+	const size_t buckets = 1 << 12;
+	const size_t per_bucket = 64;
+	std::vector<size_t> count(buckets, 0);
+	for (uint32_t i = 0; i < buckets * per_bucket; ++i) {
+		++count[cutil::hash_bytes(&i, sizeof(i)) & (buckets - 1)];
+	}
+	double chi2 = 0;
+	for (size_t c : count) {
+		chi2 += (c - double(per_bucket)) * (c - double(per_bucket)) / per_bucket;
+	}
+	// 4095 degrees of freedom: mean 4095, standard deviation about 90
+	EXPECT_LT(chi2, 4095 + 6 * 90);
+	EXPECT_GT(chi2, 4095 - 6 * 90);
+
+	// and every seed is a different function: outputs of two seeds are uncorrelated
+	std::mt19937_64 rng(4);
+	int same_bits = 0;
+	for (int i = 0; i < 1000; ++i) {
+		const auto key = random_bytes(24, rng);
+		same_bits += 64 - popcount(cutil::hash_bytes(key.data(), key.size(), 1) ^ cutil::hash_bytes(key.data(), key.size(), 2));
+	}
+	EXPECT_NEAR(same_bits / 64000.0, 0.5, 0.01);
+}
@@ -0,0 +1,263 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "ConsoleUtil/CppHexBase64.hpp"
+
+namespace {
+	using cutil::str::base64_alphabet;
+
+	std::string random_bytes(size_t size, std::mt19937& rng)
+	{
+		std::string bytes(size, '\0');
+		for (char& c : bytes) {
+			c = static_cast<char>(rng() & 0xFF);
+		}
+		return bytes;
+	}
+
+	//* bit by bit, as RFC 4648 describes it
+	std::string reference_base64(const std::string& bytes, base64_alphabet alphabet, bool pad)
+	{
+		const char* chars = alphabet == base64_alphabet::standard
+			? "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+			: "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+		std::string text;
+		uint32_t bits = 0;
+		int count = 0;
+		for (char c : bytes) {
+			bits = (bits << 8) | static_cast<uint8_t>(c);
+			count += 8;
+			while (count >= 6) {
+				count -= 6;
+				text += chars[(bits >> count) & 0x3F];
+			}
+		}
+		if (count != 0) {
+			text += chars[(bits << (6 - count)) & 0x3F];
+		}
+		while (pad && text.size() % 4 != 0) {
+			text += '=';
+		}
+		return text;
+	}
+
+	bool decodes(const std::string& text, base64_alphabet alphabet = base64_alphabet::standard)
+	{
+		std::string bytes;
+		return cutil::str::from_base64(text, bytes, alphabet);
+	}
+}
+
+TEST(Hex, round_trip)
+{
+	std::mt19937 rng(1);
+	EXPECT_EQ(cutil::str::to_hex(std::string("\x01\xAB\xff", 3)), "01abff");
+	EXPECT_EQ(cutil::str::to_hex(std::string("\x01\xAB\xff", 3), true), "01ABFF");
+
+	for (size_t size = 0; size < 300; size += (size < 80 ? 1 : 37)) {
+		const std::string bytes = random_bytes(size, rng);
+		std::string hex = cutil::str::to_hex(bytes);
+		ASSERT_EQ(hex.size(), size * 2);
+		for (size_t i = 0; i < size; ++i) {
+			ASSERT_EQ(hex.substr(2 * i, 2), std::string(1, "0123456789abcdef"[static_cast<uint8_t>(bytes[i]) >> 4]) + "0123456789abcdef"[bytes[i] & 0x0F]);
+		}
+		std::string back;
+		ASSERT_TRUE(cutil::str::from_hex(hex, back));
+		EXPECT_EQ(back, bytes);
+		for (char& c : hex) {
+			c = static_cast<char>(std::toupper(static_cast<uint8_t>(c)));
+		}
+		ASSERT_TRUE(cutil::str::from_hex(hex, back));
+		EXPECT_EQ(back, bytes);
+	}
+}
+
+TEST(Hex, invalid_input)
+{
+	std::mt19937 rng(2);
+	const std::string hex = cutil::str::to_hex(random_bytes(100, rng));
+	std::vector<uint8_t> buf(100);
+	for (size_t pos = 0; pos < hex.size(); pos += 3) {
+		for (char bad : {'g', 'G', ' ', '/', ':', '@', '`', '\0', '\xFF'}) {
+			std::string text = hex;
+			text[pos] = bad;
+			const auto res = cutil::str::hex_decode(text.data(), text.size(), buf.data(), buf.size());
+			ASSERT_EQ(res.ec, std::errc::illegal_byte_sequence) << pos;
+			EXPECT_EQ(res.read, pos / 2 * 2);
+			EXPECT_EQ(res.written, pos / 2);
+		}
+	}
+	// a single digit at the end is kept for the next chunk, a full buffer stops at a pair boundary
+	auto res = cutil::str::hex_decode("abc", 3, buf.data(), buf.size());
+	EXPECT_EQ(res.ec, std::errc::illegal_byte_sequence);
+	EXPECT_EQ(res.read, 2u);
+	res = cutil::str::hex_decode(hex.data(), hex.size(), buf.data(), 33);
+	EXPECT_EQ(res.ec, std::errc::value_too_large);
+	EXPECT_EQ(res.read, 66u);
+	EXPECT_EQ(res.written, 33u);
+}
+
+TEST(Base64, round_trip)
+{
+	std::mt19937 rng(3);
+	EXPECT_EQ(cutil::str::to_base64(std::string("")), "");
+	EXPECT_EQ(cutil::str::to_base64(std::string("f")), "Zg==");
+	EXPECT_EQ(cutil::str::to_base64(std::string("fo")), "Zm8=");
+	EXPECT_EQ(cutil::str::to_base64(std::string("foo")), "Zm9v");
+	EXPECT_EQ(cutil::str::to_base64(std::string("foobar")), "Zm9vYmFy");
+	EXPECT_EQ(cutil::str::to_base64(std::string("\xFB\xFF", 2), base64_alphabet::url_safe, false), "-_8");
+
+	for (auto alphabet : {base64_alphabet::standard, base64_alphabet::url_safe}) {
+		for (bool pad : {true, false}) {
+			for (size_t size = 0; size < 400; size += (size < 100 ? 1 : 41)) {
+				const std::string bytes = random_bytes(size, rng);
+				const std::string text = cutil::str::to_base64(bytes, alphabet, pad);
+				ASSERT_EQ(text, reference_base64(bytes, alphabet, pad)) << size;
+				ASSERT_EQ(text.size(), cutil::str::base64_encoded_size(size, pad));
+				std::string back;
+				ASSERT_TRUE(cutil::str::from_base64(text, back, alphabet)) << size;
+				ASSERT_EQ(back, bytes);
+			}
+		}
+	}
+}
+
+TEST(Base64, invalid_input)
+{
+	std::mt19937 rng(4);
+	EXPECT_TRUE(decodes("Zg=="));
+	EXPECT_TRUE(decodes("Zg"));
+	EXPECT_FALSE(decodes("Zg="));		// incomplete padding
+	EXPECT_FALSE(decodes("Z"));			// 6 bits are no byte
+	EXPECT_FALSE(decodes("Zh=="));		// bits past the last byte
+	EXPECT_FALSE(decodes("Zm9=v"));
+	EXPECT_FALSE(decodes("Zg==Zg=="));	// padding in the middle
+	EXPECT_FALSE(decodes("Zm9v\n"));
+	EXPECT_FALSE(decodes("-_8", base64_alphabet::standard));
+	EXPECT_TRUE(decodes("-_8", base64_alphabet::url_safe));
+	EXPECT_FALSE(decodes("+/8=", base64_alphabet::url_safe));
+
+	// a bad char anywhere, also inside the SIMD blocks: stops at the start of its group
+	const std::string text = cutil::str::to_base64(random_bytes(150, rng));
+	std::vector<uint8_t> buf(cutil::str::base64_decoded_max_size(text.size()));
+	for (size_t pos = 0; pos < text.size(); ++pos) {
+		for (char bad : {'=', '-', '_', ' ', '.', '\0', '\x80', '\xFF'}) {
+			std::string broken = text;
+			broken[pos] = bad;
+			const auto res = cutil::str::base64_decode(broken.data(), broken.size(), buf.data(), buf.size());
+			if (bad == '=' && pos >= text.size() - 2) {
+				continue; // may still be valid padding
+			}
+			ASSERT_EQ(res.ec, std::errc::illegal_byte_sequence) << pos << ' ' << int(bad);
+			EXPECT_EQ(res.read, pos / 4 * 4);
+			EXPECT_EQ(res.written, pos / 4 * 3);
+		}
+	}
+	// output too small: only whole groups that fit
+	for (size_t dst_size = 0; dst_size < 150; dst_size += 7) {
+		const auto res = cutil::str::base64_decode(text.data(), text.size(), buf.data(), dst_size);
+		EXPECT_EQ(res.ec, std::errc::value_too_large);
+		EXPECT_EQ(res.written, dst_size / 3 * 3);
+		EXPECT_EQ(res.read, dst_size / 3 * 4);
+	}
+}
+
+TEST(Base64, streaming)
+{
+	std::mt19937 rng(5);
+	for (size_t size : {0, 1, 2, 3, 47, 48, 49, 1000}) {
+		const std::string bytes = random_bytes(size, rng);
+		for (size_t chunk : {1, 2, 5, 16, 33, 4096}) {
+			cutil::str::base64_encoder encoder(base64_alphabet::url_safe, false);
+			std::string text;
+			std::vector<char> out(cutil::str::base64_encoder::max_output_size(chunk) + 4);
+			for (size_t i = 0; i < size; i += chunk) {
+				const size_t n = std::min(chunk, size - i);
+				text.append(out.data(), encoder.update(bytes.data() + i, n, out.data()));
+			}
+			text.append(out.data(), encoder.finish(out.data()));
+			ASSERT_EQ(text, reference_base64(bytes, base64_alphabet::url_safe, false));
+
+			cutil::str::base64_decoder decoder(base64_alphabet::url_safe);
+			std::string back;
+			std::vector<uint8_t> buf(cutil::str::base64_decoder::max_output_size(chunk) + 3);
+			for (size_t i = 0; i < text.size(); i += chunk) {
+				const size_t n = std::min(chunk, text.size() - i);
+				const auto res = decoder.update(text.data() + i, n, buf.data(), buf.size());
+				ASSERT_TRUE(res.ok());
+				ASSERT_EQ(res.read, n);
+				back.append(reinterpret_cast<const char*>(buf.data()), res.written);
+			}
+			const auto res = decoder.finish(buf.data(), buf.size());
+			ASSERT_TRUE(res.ok());
+			back.append(reinterpret_cast<const char*>(buf.data()), res.written);
+			ASSERT_EQ(back, bytes) << size << ' ' << chunk;
+		}
+	}
+
+	// a padded group ends the stream
+	cutil::str::base64_decoder decoder;
+	uint8_t buf[16];
+	auto res = decoder.update("Zg==Zm9v", 8, buf, sizeof(buf));
+	EXPECT_EQ(res.ec, std::errc::illegal_byte_sequence);
+	EXPECT_EQ(res.read, 4u);
+	EXPECT_EQ(res.written, 1u);
+	EXPECT_TRUE(decoder.finish(buf, sizeof(buf)).ok());
+
+	// a full output is resumed with the rest
+	res = decoder.update("Zm9vYmFy", 8, buf, 4);
+	EXPECT_EQ(res.ec, std::errc::value_too_large);
+	EXPECT_EQ(res.read, 4u);
+	res = decoder.update("YmFy", 4, buf + 3, sizeof(buf) - 3);
+	EXPECT_TRUE(res.ok());
+	EXPECT_EQ(std::string(reinterpret_cast<const char*>(buf), 6), "foobar");
+}
+
+#ifdef _CUTIL_ENCODING_USE_SSSE3
+//* the dispatch picks one kernel, the others have to agree with it
+TEST(HexBase64, x86_kernels)
+{
+	namespace in = cutil::str::internal;
+	std::mt19937 rng(6);
+	for (size_t size : {0, 15, 16, 31, 64, 100, 257}) {
+		const std::string bytes = random_bytes(size, rng);
+		const uint8_t* src = reinterpret_cast<const uint8_t*>(bytes.data());
+		const std::string hex = cutil::str::to_hex(bytes);
+		const std::string text = cutil::str::to_base64(bytes);
+		std::string out(2 * size + 64, '\0');
+		std::vector<uint8_t> buf(size + 64);
+
+		std::vector<size_t (*)(const uint8_t*, size_t, char*, bool)> hex_encoders{in::hex_encode_ssse3};
+		std::vector<size_t (*)(const char*, size_t, uint8_t*)> hex_decoders{in::hex_decode_ssse3};
+		std::vector<size_t (*)(const uint8_t*, size_t, char*, base64_alphabet)> base64_encoders{in::base64_encode_ssse3};
+		std::vector<size_t (*)(const char*, size_t, uint8_t*, size_t, base64_alphabet)> base64_decoders{in::base64_decode_ssse3};
+		if (in::cpu_has_avx2()) {
+			hex_encoders.push_back(in::hex_encode_avx2);
+			hex_decoders.push_back(in::hex_decode_avx2);
+			base64_encoders.push_back(in::base64_encode_avx2);
+			base64_decoders.push_back(in::base64_decode_avx2);
+		}
+		if (!in::cpu_has_ssse3()) {
+			return;
+		}
+		for (auto kernel : hex_encoders) {
+			const size_t done = kernel(src, size, &out[0], false);
+			EXPECT_EQ(out.substr(0, 2 * done), hex.substr(0, 2 * done));
+		}
+		for (auto kernel : hex_decoders) {
+			const size_t done = kernel(hex.data(), hex.size(), buf.data());
+			EXPECT_EQ(std::string(buf.begin(), buf.begin() + done / 2), bytes.substr(0, done / 2));
+		}
+		for (auto kernel : base64_encoders) {
+			const size_t done = kernel(src, size, &out[0], base64_alphabet::standard);
+			EXPECT_EQ(out.substr(0, done / 3 * 4), text.substr(0, done / 3 * 4));
+		}
+		for (auto kernel : base64_decoders) {
+			const size_t done = kernel(text.data(), text.size() / 4 * 4 - 4 * (size % 3 != 0), buf.data(), buf.size(), base64_alphabet::standard);
+			EXPECT_EQ(std::string(buf.begin(), buf.begin() + done / 4 * 3), bytes.substr(0, done / 4 * 3));
+			EXPECT_GE(done + 64, text.size() / 4 * 4 - 4 * (size % 3 != 0));
+		}
+	}
+}
+#endif
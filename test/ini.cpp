@@ -0,0 +1,87 @@
+
+#include <gtest/gtest.h>
+
+#include <ConsoleUtil/Base.h>
+
+#ifdef CUTIL_CPP17_SUPPORTED // C++17 required
+
+#include "ConsoleUtil/CppIniParser.hpp"
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+TEST(IniParser, tokenizer)
+{
+	// the input of `regex_split_map()`
+	cutil::str::ini_tokenizer tok("[abc] name = 123; [abd] name = 123;[abe] name = 123;  ");
+	std::vector<std::tuple<std::string_view, std::string_view, std::string_view>> entries;
+	cutil::str::ini_entry entry;
+	while (tok.next(entry)) {
+		entries.emplace_back(entry.section, entry.key, entry.value);
+	}
+	EXPECT_EQ((decltype(entries){{"abc", "name", "123"}, {"abd", "name", "123"}, {"abe", "name", "123"}}), entries);
+	EXPECT_EQ(0u, tok.errors());
+
+	const std::string text =
+		"top = level\r\n"
+		"# comment = ignored\n"
+		"[ server ]\n"
+		"  host =  example.com  \n"
+		"path = \"C:\\a b; c\" trailing; port=8080\n"
+		"flag\n"
+		"= no key\n"
+		"[broken\n"
+		"empty =\n";
+	cutil::str::ini_tokenizer lines(text);
+	entries.clear();
+	while (lines.next(entry)) {
+		entries.emplace_back(entry.section, entry.key, entry.value);
+	}
+	EXPECT_EQ((decltype(entries){{"", "top", "level"}, {"server", "host", "example.com"}, {"server", "path", "C:\\a b; c"},
+		{"server", "port", "8080"}, {"server", "flag", ""}, {"server", "empty", ""}}), entries);
+	EXPECT_EQ(2u, lines.errors());
+
+	cutil::str::ini_tokenizer classic("[s]\nk = v ; not a separator here\n; a comment\n", '\n', ';');
+	ASSERT_TRUE(classic.next(entry));
+	EXPECT_EQ("v ; not a separator here", entry.value);
+	EXPECT_FALSE(classic.next(entry));
+}
+
+TEST(IniParser, config)
+{
+	std::string text = "[b] x = 1; y = 2; x = 3; [a] z = \"q\"; [b] w = 4;";
+	const cutil::str::ini_config cfg(std::move(text));
+	EXPECT_EQ(4u, cfg.size());
+	EXPECT_EQ("3", cfg.get("b", "x"));	// the last one wins
+	EXPECT_EQ("q", cfg.find("a", "z").value());
+	EXPECT_FALSE(cfg.find("a", "x").has_value());
+	EXPECT_FALSE(cfg.contains("c", "x"));
+	EXPECT_EQ("none", cfg.get("c", "x", "none"));
+	EXPECT_EQ(4, cutil::str::to_number_opt<int>(cfg.get("b", "w")).value_or(0));
+
+	std::vector<std::string_view> keys;
+	for (const auto& entry : cfg.section("b")) {
+		keys.push_back(entry.key);
+	}
+	EXPECT_EQ((std::vector<std::string_view>{"w", "x", "y"}), keys);
+	EXPECT_TRUE(cfg.section("none").empty());
+
+	const cutil::str::ini_config copy = cfg; // shares the text
+	EXPECT_EQ("2", copy.get("b", "y"));
+	EXPECT_TRUE(cutil::str::ini_config().empty());
+
+	// the same as `regex_split_map()` would give, section by section
+	const std::string big = [] {
+		std::string str;
+		for (int i = 0; i < 1000; ++i) {
+			str += "[s" + std::to_string(i) + "] key = " + std::to_string(i * 7) + ";";
+		}
+		return str;
+	}();
+	const cutil::str::ini_config many(big);
+	const auto expected = cutil::str::regex_split_map(big, "\\[[^\\]]+\\]");
+	ASSERT_EQ(expected.size(), many.size());
+	for (const auto& [section, body] : expected) {
+		EXPECT_EQ(cutil::str::trim_copy(body), "key = " + std::string(many.get(section.substr(1, section.size() - 2), "key")) + ";");
+	}
+}
+
+#endif // C++17
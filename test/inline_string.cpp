@@ -0,0 +1,115 @@
+
+#include <gtest/gtest.h>
+
+#include <ConsoleUtil/Base.h>
+
+#ifdef CUTIL_CPP17_SUPPORTED // C++17 required
+
+#include <random>
+#include <sstream>
+#include <unordered_set>
+
+#include "ConsoleUtil/CppStringUtil.hpp"
+
+using cutil::str::inline_string;
+
+static_assert(std::is_trivially_copyable<inline_string<31>>::value, "");
+static_assert(sizeof(inline_string<31>) == 32, "");
+static_assert(sizeof(inline_string<15>) == 16, "");
+
+namespace {
+	constexpr inline_string<7> make_tag()
+	{
+		inline_string<7> tag = "GE";
+		tag.push_back('T');
+		tag += "/1";
+		return tag;
+	}
+}
+
+TEST(InlineString, basics)
+{
+	constexpr inline_string<7> tag = make_tag();
+	static_assert(tag.size() == 5 && tag == "GET/1", "built at compile time");
+	static_assert(inline_string<3>().empty(), "");
+
+	inline_string<5> full = "abcde";
+	EXPECT_EQ(5u, full.size());
+	EXPECT_STREQ("abcde", full.c_str()); // the length byte is the terminator when full
+	full.pop_back();
+	EXPECT_STREQ("abcd", full.c_str());
+	full.resize(5, '!');
+	EXPECT_EQ("abcd!", full.view());
+	EXPECT_THROW(full.push_back('x'), std::length_error);
+	EXPECT_EQ("abcd!", full.view()); // unchanged after the throw
+
+	EXPECT_THROW(inline_string<3>(std::string_view("toolong")), std::length_error);
+	EXPECT_FALSE(inline_string<3>::fits("toolong"));
+	EXPECT_TRUE(inline_string<3>::fits("too"));
+	full.clear();
+	EXPECT_TRUE(full.empty());
+	EXPECT_STREQ("", full.c_str());
+
+	// comparisons with every string type, and with other capacities
+	const inline_string<15> a = "Content-Type";
+	const inline_string<31> b = "Content-Type";
+	const std::string_view view = a;
+	EXPECT_EQ(view.data(), a.data());
+	EXPECT_TRUE(a == b);
+	EXPECT_TRUE(a == "Content-Type");
+	EXPECT_TRUE("Content-Type" == a);
+	EXPECT_TRUE(std::string("Content-Type") == a);
+	EXPECT_TRUE(a != std::string_view("content-type"));
+	EXPECT_TRUE(a < "Content-Typf");
+	EXPECT_TRUE("A" < a);
+	EXPECT_TRUE(inline_string<4>("ab") <= inline_string<9>("ab"));
+	EXPECT_EQ(std::hash<std::string>()("Content-Type"), std::hash<inline_string<15>>()(a));
+	std::unordered_set<inline_string<15>> set{a, "Host"};
+	EXPECT_EQ(1u, set.count(inline_string<15>("Host")));
+
+	std::ostringstream os;
+	os << a;
+	EXPECT_EQ("Content-Type", os.str());
+}
+
+TEST(InlineString, string_util_apis)
+{
+	std::vector<inline_string<15>> tokens;
+	EXPECT_TRUE(cutil::str::split_inline(" 42 ,b,,Host", ',', tokens));
+	EXPECT_EQ((std::vector<inline_string<15>>{" 42 ", "b", "", "Host"}), tokens);
+	EXPECT_EQ(" 42 |b||Host", cutil::str::join(tokens, "|"));
+	EXPECT_EQ("42", cutil::str::trim_copy(tokens[0]));
+	EXPECT_EQ(42, cutil::str::to_number_opt<int>(cutil::str::trim_copy(tokens[0])));
+	EXPECT_EQ("b=Host", cutil::str::concat(tokens[1], '=', tokens[3]));
+	EXPECT_TRUE(cutil::str::ci_equal()(tokens[3], "HOST"));
+
+	EXPECT_FALSE(cutil::str::split_inline("short,this one is far too long,x", ',', tokens));
+	EXPECT_EQ((std::vector<inline_string<15>>{"short"}), tokens);
+	EXPECT_TRUE(cutil::str::split_inline("", ',', tokens));
+	EXPECT_EQ(1u, tokens.size());
+
+	// same tokens as split_view(), on random input
+	std::mt19937 gen(11);
+	std::vector<std::string_view> views;
+	std::vector<inline_string<31>> inlined;
+	for (int round = 0; round < 2000; ++round) {
+		std::string line;
+		for (size_t i = 0, n = gen() % 100; i < n; ++i) {
+			line += "ab,c"[gen() % 4];
+		}
+		cutil::str::split_view(line, ',', views);
+		bool fits = true;
+		for (auto view : views) {
+			fits = fits && view.size() <= 31;
+		}
+		ASSERT_EQ(fits, cutil::str::split_inline(line, ',', inlined)) << line;
+		if (fits) {
+			ASSERT_EQ(views.size(), inlined.size());
+			for (size_t i = 0; i < views.size(); ++i) {
+				ASSERT_EQ(views[i], inlined[i]);
+			}
+		}
+	}
+}
+
+#endif // C++17
@@ -0,0 +1,161 @@
+
+#include <gtest/gtest.h>
+
+#include <ConsoleUtil/Base.h>
+
+#ifdef CUTIL_CPP17_SUPPORTED // C++17 required
+
+#include <atomic>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include "ConsoleUtil/CppMappedFile.hpp"
+
+namespace {
+	// a file in the temp directory, removed again at the end of the test
+	struct temp_file {
+		std::string path;
+		explicit temp_file(const std::string& content, const char* name = "cutil_mapped_file_test.txt")
+			: path((std::filesystem::temp_directory_path() / name).string())
+		{
+			std::ofstream(path, std::ios::binary) << content;
+		}
+		~temp_file() { std::remove(path.c_str()); }
+	};
+
+	std::vector<std::string> read_records(const std::string& path, bool allow_mmap, char delim = '\n')
+	{
+		cutil::str::file_splitter file;
+		EXPECT_FALSE(file.open(path, delim, allow_mmap));
+		EXPECT_EQ(delim, file.record_delim());
+		std::vector<std::string> records;
+		std::string_view record;
+		while (file.next_record(record)) {
+			records.emplace_back(record);
+		}
+		EXPECT_FALSE(file.error());
+		return records;
+	}
+}
+
+TEST(MappedFile, record_cursor)
+{
+	std::vector<std::string> records;
+	auto collect = [&records](std::string_view rec) { records.emplace_back(rec); };
+
+	EXPECT_EQ(0u, cutil::str::for_each_record("", '\n', collect));
+	EXPECT_EQ(3u, cutil::str::for_each_record("a\r\n\nb", '\n', collect));
+	EXPECT_EQ((std::vector<std::string>{"a", "", "b"}), records);
+	records.clear();
+	EXPECT_EQ(2u, cutil::str::for_each_record("x;y\r;", ';', collect)); // '\r' is only dropped before '\n'
+	EXPECT_EQ((std::vector<std::string>{"x", "y\r"}), records);
+
+	std::vector<std::string_view> fields;
+	cutil::str::split_view("a,b,,c,", ',', fields);
+	EXPECT_EQ((std::vector<std::string_view>{"a", "b", "", "c", ""}), fields);
+	cutil::str::split_view("", ',', fields);
+	EXPECT_EQ(std::vector<std::string_view>{""}, fields);
+	cutil::str::split_any_view("k=v;x y", "=; ", fields);
+	EXPECT_EQ((std::vector<std::string_view>{"k", "v", "x", "y"}), fields);
+}
+
+TEST(MappedFile, next_record)
+{
+	for (bool allow_mmap : {true, false}) {
+		{
+			temp_file file("first\nsecond\r\n\nlast without newline");
+			EXPECT_EQ((std::vector<std::string>{"first", "second", "", "last without newline"}), read_records(file.path, allow_mmap));
+		}
+		{
+			temp_file file("");
+			EXPECT_TRUE(read_records(file.path, allow_mmap).empty());
+		}
+		{
+			// longer than a read block, so the block reader has to grow and stitch
+			const std::string big((3 << 20) + 17, 'x');
+			temp_file file("a\n" + big + "\nb\n");
+			EXPECT_EQ((std::vector<std::string>{"a", big, "b"}), read_records(file.path, allow_mmap));
+		}
+	}
+
+	cutil::str::file_splitter file;
+	EXPECT_TRUE(file.open("/this/file/does/not/exist.txt"));
+	EXPECT_FALSE(file.is_open());
+	std::string_view record;
+	EXPECT_FALSE(file.next_record(record));
+}
+
+TEST(MappedFile, next_chunk)
+{
+	std::string content;
+	std::vector<std::string> expected;
+	for (int i = 0; i < 20000; ++i) {
+		expected.push_back("record " + std::to_string(i) + ",field," + std::string(static_cast<size_t>(i % 37), 'z'));
+		content += expected.back() + '\n';
+	}
+	temp_file file(content);
+
+	for (bool allow_mmap : {true, false}) {
+		for (size_t chunk_size : {size_t(1), size_t(100), size_t(4096), size_t(1) << 30}) {
+			cutil::str::file_splitter splitter;
+			ASSERT_FALSE(splitter.open(file.path, '\n', allow_mmap));
+			EXPECT_EQ(allow_mmap, splitter.is_mapped());
+
+			std::vector<cutil::str::file_chunk> chunks;
+			cutil::str::file_chunk chunk;
+			while (splitter.next_chunk(chunk, chunk_size)) {
+				EXPECT_EQ('\n', chunk.data.back()); // every chunk ends on a record boundary
+				chunks.push_back(chunk);
+			}
+			splitter.close(); // the chunks keep their memory
+
+			std::vector<std::string> records;
+			uint64_t offset = 0;
+			for (const auto& each : chunks) {
+				EXPECT_EQ(offset, each.offset);
+				offset += each.data.size();
+				cutil::str::for_each_record(each.data, '\n', [&records](std::string_view rec) { records.emplace_back(rec); });
+			}
+			EXPECT_EQ(content.size(), offset);
+			EXPECT_EQ(expected, records) << allow_mmap << " " << chunk_size;
+		}
+	}
+}
+
+TEST(MappedFile, chunks_in_threads)
+{
+	std::string content;
+	uint64_t expected = 0;
+	for (uint64_t i = 0; i < 100000; ++i) {
+		content += std::to_string(i) + "\t" + std::to_string(i * 3) + "\n";
+		expected += i * 3;
+	}
+	temp_file file(content);
+
+	for (bool allow_mmap : {true, false}) {
+		cutil::str::file_splitter splitter;
+		ASSERT_FALSE(splitter.open(file.path, '\n', allow_mmap));
+		std::atomic<uint64_t> sum{0};
+		std::vector<std::thread> workers;
+		cutil::str::file_chunk chunk;
+		while (splitter.next_chunk(chunk, 64 << 10)) {
+			workers.emplace_back([chunk, &sum] {
+				uint64_t local = 0;
+				std::vector<std::string_view> fields;
+				cutil::str::for_each_record(chunk.data, '\n', [&](std::string_view rec) {
+					cutil::str::split_view(rec, '\t', fields);
+					local += cutil::str::to_number_opt<uint64_t>(fields[1]).value_or(0);
+				});
+				sum += local;
+			});
+		}
+		for (auto& worker : workers) {
+			worker.join();
+		}
+		EXPECT_EQ(expected, sum.load());
+	}
+}
+
+#endif // C++17
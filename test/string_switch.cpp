@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "ConsoleUtil/CppStringSwitch.hpp"
+
+namespace {
+	int dispatch(std::string_view command)
+	{
+		static constexpr cutil::str::string_switch commands("open", "close", "list", "quit");
+		switch (commands(command)) {
+			case commands("open"):	return 10;
+			case commands("close"):	return 20;
+			case commands("list"):	return 30;
+			case commands("quit"):	return 40;
+			default:				return -1;
+		}
+	}
+}
+
+TEST(StringSwitch, constexpr_switch)
+{
+	static constexpr cutil::str::string_switch keys("alpha", "beta", "gamma", "", "delta");
+	static_assert(keys("alpha") == 0, "");
+	static_assert(keys("gamma") == 2, "");
+	static_assert(keys("") == 3, "");
+	static_assert(keys("Alpha") == keys.npos, "");
+	static_assert(keys.size() == 5, "");
+	static_assert(keys[4] == "delta", "");
+
+	EXPECT_EQ(dispatch("open"), 10);
+	EXPECT_EQ(dispatch("quit"), 40);
+	EXPECT_EQ(dispatch("quit "), -1);
+	EXPECT_EQ(dispatch("Open"), -1);
+	EXPECT_EQ(dispatch(""), -1);
+	EXPECT_EQ(dispatch(std::string("list")), 30);
+
+	static constexpr auto methods = cutil::str::make_string_switch_ignore_case("GET", "POST", "PUT", "DELETE");
+	static_assert(methods("post") == 1, "");
+	EXPECT_EQ(methods("DeLeTe"), 3u);
+	EXPECT_EQ(methods("delete"), 3u);
+	EXPECT_FALSE(methods.contains("PATCH"));
+	EXPECT_FALSE(methods.contains("POS"));
+
+	static constexpr auto one = cutil::str::make_string_switch("only");
+	static_assert(one("only") == 0 && one("other") == one.npos, "");
+}
+
+TEST(StringSwitch, many_keys)
+{
+	std::mt19937 rng(1);
+	std::set<std::string> unique;
+	while (unique.size() < 500) {
+		std::string key;
+		for (size_t n = 1 + rng() % 12; n > 0; --n) {
+			key += static_cast<char>('a' + rng() % 26);
+		}
+		unique.insert(key);
+	}
+	const std::vector<std::string> storage(unique.begin(), unique.end());
+	std::array<std::string_view, 500> keys;
+	std::copy(storage.begin(), storage.end(), keys.begin());
+
+	const auto position = [&](const std::string& key) {
+		const auto it = std::lower_bound(storage.begin(), storage.end(), key);
+		return it != storage.end() && *it == key ? static_cast<size_t>(it - storage.begin()) : cutil::str::string_switch<500>::npos;
+	};
+	const cutil::str::string_switch<500> sw(keys); // built at runtime
+	for (size_t i = 0; i < keys.size(); ++i) {
+		ASSERT_EQ(sw(keys[i]), i);
+		ASSERT_EQ(sw(storage[i].substr(1)), position(storage[i].substr(1)));	// mostly not keys
+		ASSERT_EQ(sw(storage[i] + "x"), position(storage[i] + "x"));
+	}
+
+	std::array<std::string_view, 500> upper_keys;
+	std::vector<std::string> upper(storage);
+	for (auto& key : upper) {
+		for (char& c : key) {
+			c = static_cast<char>(c - 'a' + 'A');
+		}
+	}
+	std::copy(upper.begin(), upper.end(), upper_keys.begin());
+	const cutil::str::string_switch<500, true> ci(upper_keys);
+	for (size_t i = 0; i < keys.size(); ++i) {
+		ASSERT_EQ(ci(keys[i]), i);
+	}
+
+	std::array<std::string_view, 3> duplicated = {"a", "b", "a"};
+	EXPECT_THROW(cutil::str::string_switch<3>{duplicated}, std::invalid_argument);
+	std::array<std::string_view, 2> folded = {"Key", "kEY"};
+	EXPECT_THROW((cutil::str::string_switch<2, true>{folded}), std::invalid_argument);
+	EXPECT_NO_THROW(cutil::str::string_switch<2>{folded});
+}
@@ -1,6 +1,12 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <unordered_map>
+
 #ifdef CUTIL_CPP17_SUPPORTED
 #include <optional>
 #endif
@@ -8,6 +14,8 @@
 #include "ConsoleUtil/CppStringUtil.hpp"
 #include "ConsoleUtil/CppUtil.hpp"
 
+#include "alloc_counter.hpp"
+
 TEST(Compare, compare_ignore_case)
 {
     std::string str1 = "PoKeMoN!";
@@ -95,6 +103,214 @@ TEST(Compare, matches)
     EXPECT_EQ(false, cutil::str::matches("jon.doe@", check_mail));
 }
 
+TEST(Compare, multi_matcher)
+{
+    const cutil::str::multi_matcher matcher({"error", "fatal", "time", "timeout", ""});
+
+    EXPECT_EQ(5, matcher.pattern_count());
+    EXPECT_EQ(true, matcher.contains_any("[WARN] connection timeout"));
+    EXPECT_EQ(true, matcher.contains_any("fatal"));
+    EXPECT_EQ(false, matcher.contains_any("[INFO] all good"));
+    EXPECT_EQ(false, matcher.contains_any("FATAL"));
+    EXPECT_EQ(false, matcher.contains_any(""));
+
+    EXPECT_EQ(3, matcher.count("fatal error: timeout"));
+    EXPECT_EQ(0, matcher.count("nothing here"));
+
+    auto res = matcher.find_all("fatal error: timeout, time");
+    ASSERT_EQ(res.size(), 4);
+    EXPECT_EQ(res[0].pos, 0);
+    EXPECT_EQ(res[0].len, 5);
+    EXPECT_EQ(res[0].pattern, 1);
+    EXPECT_EQ(res[1].pos, 6);
+    EXPECT_EQ(res[1].pattern, 0);
+    EXPECT_EQ(res[2].pos, 13);
+    EXPECT_EQ(res[2].len, 7);
+    EXPECT_EQ(res[2].pattern, 3); // longest wins
+    EXPECT_EQ(res[3].pos, 22);
+    EXPECT_EQ(res[3].pattern, 2);
+
+    const cutil::str::multi_matcher empty_matcher;
+    EXPECT_EQ(false, empty_matcher.contains_any("abc"));
+    EXPECT_EQ(0, empty_matcher.count("abc"));
+}
+
+TEST(Compare, multi_matcher_shared_prefix)
+{
+    // "a" is a prefix of a much longer key that never completes: each 'a' is a match of its own,
+    // found without going back over the 5000 bytes the long key was following.
+    const cutil::str::multi_matcher matcher({"a", std::string(5000, 'a') + "b"});
+    const std::string text(100000, 'a');
+    EXPECT_EQ(100000u, matcher.count(text));
+    const auto res = matcher.find_all(text);
+    ASSERT_EQ(100000u, res.size());
+    EXPECT_EQ(99999u, res.back().pos);
+    EXPECT_EQ(0u, res.back().pattern);
+
+    const auto res2 = matcher.find_all("aa" + std::string(5000, 'a') + "ba");
+    ASSERT_EQ(4u, res2.size());
+    EXPECT_EQ(1u, res2[1].pos);
+    EXPECT_EQ(2u, res2[2].pos);
+    EXPECT_EQ(5001u, res2[2].len);
+    EXPECT_EQ(5003u, res2[3].pos);
+
+    // compare against the naive leftmost-longest loop, across the blocks `scan()` works in
+    std::mt19937 rng(7);
+    for (const size_t max_len : {3, 9, 6000})
+    {
+        std::vector<std::string> keys;
+        for (int i = 0; i < 12; ++i)
+        {
+            std::string key(1 + rng() % max_len, 'a');
+            for (char& c : key)
+            {
+                c = static_cast<char>('a' + rng() % 3);
+            }
+            keys.push_back(key);
+        }
+        std::string text2(50000, 'a');
+        for (char& c : text2)
+        {
+            c = static_cast<char>('a' + rng() % 3);
+        }
+        // plant some long keys so they do match
+        for (size_t pos = 0; pos + keys[0].size() < text2.size(); pos += 9000)
+        {
+            text2.replace(pos, keys[0].size(), keys[0]);
+        }
+        std::vector<std::pair<size_t, size_t>> expected;
+        for (size_t pos = 0; pos < text2.size();)
+        {
+            size_t best = 0;
+            size_t best_id = 0;
+            for (size_t id = 0; id < keys.size(); ++id)
+            {
+                if (keys[id].size() > best && text2.compare(pos, keys[id].size(), keys[id]) == 0)
+                {
+                    best = keys[id].size();
+                    best_id = id;
+                }
+            }
+            if (best == 0)
+            {
+                ++pos;
+                continue;
+            }
+            expected.emplace_back(pos, best_id);
+            pos += best;
+        }
+        std::vector<std::pair<size_t, size_t>> found;
+        for (const auto& m : cutil::str::multi_matcher(keys).find_all(text2))
+        {
+            found.emplace_back(m.pos, m.pattern);
+        }
+        EXPECT_EQ(expected, found) << max_len;
+    }
+}
+
+TEST(Compare, multi_matcher_ignore_case)
+{
+    const cutil::str::multi_matcher matcher({"Error", "FATAL"}, true);
+
+    EXPECT_EQ(true, matcher.contains_any("an ERROR occurred"));
+    EXPECT_EQ(true, matcher.contains_any("fatal"));
+    EXPECT_EQ(false, matcher.contains_any("err0r"));
+    EXPECT_EQ(2, matcher.count("FaTaL eRrOr"));
+
+    // compare against the naive loop on overlapping keywords
+    const std::vector<std::string> keywords = {"he", "she", "his", "hers"};
+    const cutil::str::multi_matcher matcher2(keywords, true);
+    for (const std::string line : {"USHERS", "ahishers", "xyz", "sHe", "h"})
+    {
+        bool expected = false;
+        for (const auto& kw : keywords)
+        {
+            expected = expected || cutil::str::contains(cutil::str::to_lower(line), kw);
+        }
+        EXPECT_EQ(expected, matcher2.contains_any(line)) << line;
+    }
+}
+
+TEST(Compare, glob_matcher)
+{
+    const cutil::str::glob_matcher logs("*.log");
+    EXPECT_EQ(true, cutil::str::matches("app.log", logs));
+    EXPECT_EQ(true, logs.matches(".log"));
+    EXPECT_EQ(false, logs.matches("app.log.1"));
+    EXPECT_EQ(false, logs.matches("app.LOG"));
+    EXPECT_EQ(true, cutil::str::glob_matcher("*.log", true).matches("app.LOG"));
+
+    const cutil::str::glob_matcher users("user-?\?-[a-z]*");
+    EXPECT_EQ(true, users.matches("user-01-bob"));
+    EXPECT_EQ(true, users.matches("user-ab-x"));
+    EXPECT_EQ(false, users.matches("user-1-bob"));
+    EXPECT_EQ(false, users.matches("user-01-Bob"));
+    EXPECT_EQ(true, cutil::str::glob_matcher("user-?\?-[a-z]*", true).matches("USER-01-Bob"));
+
+    EXPECT_EQ(true, cutil::str::glob_matcher("").matches(""));
+    EXPECT_EQ(false, cutil::str::glob_matcher("").matches("a"));
+    EXPECT_EQ(true, cutil::str::glob_matcher("**").matches(""));
+    EXPECT_EQ(true, cutil::str::glob_matcher("a*b*c").matches("abc"));
+    EXPECT_EQ(false, cutil::str::glob_matcher("a*b*c").matches("acb"));
+    EXPECT_EQ(true, cutil::str::glob_matcher("[!0-9]x").matches("ax"));
+    EXPECT_EQ(false, cutil::str::glob_matcher("[^0-9]x").matches("5x"));
+    EXPECT_EQ(true, cutil::str::glob_matcher("[]a]").matches("]"));				// ']' first in a class is a char
+    EXPECT_EQ(true, cutil::str::glob_matcher("\\*\\?[\\]]").matches("*?]"));	// escapes
+    EXPECT_EQ(true, cutil::str::glob_matcher("[abc").matches("[abc"));			// unclosed '[' is a char
+    EXPECT_EQ(true, cutil::str::glob_matcher("*" + std::string(100, '?') + "*x").matches(std::string(200, 'a') + "x")); // long segment
+
+    // no backtracking blowup: "a*a*a*...b" on "aaaa..."
+    std::string pathological;
+    for (int i = 0; i < 30; ++i) pathological += "a*";
+    EXPECT_EQ(false, cutil::str::glob_matcher(pathological + "b").matches(std::string(5000, 'a')));
+
+    // against a dynamic-programming reference, on random patterns
+    std::mt19937 gen(5);
+    const std::vector<std::string> atoms = {"a", "b", "A", "?", "*", "*", "[ab]", "[!a]", "[A-Z]"};
+    auto accepts = [](const std::string& atom, char c, bool icase) {
+        auto fold = [](char x) { return static_cast<char>(std::tolower(static_cast<unsigned char>(x))); };
+        if (atom == "?") return true;
+        if (atom == "[ab]") return c == 'a' || c == 'b' || (icase && (fold(c) == 'a' || fold(c) == 'b'));
+        if (atom == "[!a]") return icase ? fold(c) != 'a' : c != 'a';
+        if (atom == "[A-Z]") return std::isupper(static_cast<unsigned char>(c)) != 0 || (icase && std::islower(static_cast<unsigned char>(c)) != 0);
+        return icase ? fold(atom[0]) == fold(c) : atom[0] == c;
+    };
+    for (int round = 0; round < 5000; ++round) {
+        std::vector<std::string> pattern_atoms(gen() % 8);
+        std::string pattern;
+        for (auto& atom : pattern_atoms) {
+            atom = atoms[gen() % atoms.size()];
+            pattern += atom;
+        }
+        std::string text;
+        for (size_t i = 0, n = gen() % 10; i < n; ++i) {
+            text += "abAB"[gen() % 4];
+        }
+        const bool icase = gen() % 2 != 0;
+        // dp[i][j]: the first i atoms match the first j chars
+        std::vector<std::vector<char>> dp(pattern_atoms.size() + 1, std::vector<char>(text.size() + 1, 0));
+        dp[0][0] = 1;
+        for (size_t i = 1; i <= pattern_atoms.size(); ++i) {
+            for (size_t j = 0; j <= text.size(); ++j) {
+                if (pattern_atoms[i - 1] == "*") {
+                    dp[i][j] = dp[i - 1][j] || (j > 0 && dp[i][j - 1]);
+                } else {
+                    dp[i][j] = j > 0 && dp[i - 1][j - 1] && accepts(pattern_atoms[i - 1], text[j - 1], icase);
+                }
+            }
+        }
+        ASSERT_EQ(dp.back().back() != 0, cutil::str::glob_matcher(pattern, icase).matches(text)) << pattern << " " << text << " " << icase;
+    }
+
+#ifdef CUTIL_CPP17_SUPPORTED
+    const std::vector<std::string_view> names = {"a.log", "b.txt", "c.log", "log"};
+    EXPECT_EQ((std::vector<std::string_view>{"a.log", "c.log"}), logs.filter(names));
+    std::vector<std::string_view> kept;
+    logs.filter(cutil::span<const std::string_view>(names.data(), 1), kept);
+    EXPECT_EQ(1u, kept.size());
+#endif
+}
+
 /*
  * Parsing tests
  */
@@ -174,6 +390,234 @@ TEST(Parsing, neg_bool_to_string)
     EXPECT_EQ("0", cutil::str::to_string<bool>(false));
 }
 
+TEST(Parsing, to_string_same_as_stream)
+{
+    const auto stream = [](auto value){ std::ostringstream ss; ss << value; return ss.str(); };
+
+    for (long long v : {0LL, 1LL, -1LL, 9LL, 10LL, 123456789LL, -9223372036854775807LL - 1, 9223372036854775807LL})
+    {
+        EXPECT_EQ(stream(v), cutil::str::to_string(v));
+    }
+    EXPECT_EQ(stream(18446744073709551615ULL), cutil::str::to_string(18446744073709551615ULL));
+    EXPECT_EQ(stream(int8_t(-128)), cutil::str::to_string(int8_t(-128)));
+    for (long double v : {0.0L, 1.0L, 0.1L, 1.0L / 3, 1234567.0L, 1e-5L, -2.5e-300L})
+    {
+        EXPECT_EQ(stream(v), cutil::str::to_string(v));
+    }
+
+    EXPECT_EQ("(1, 2)", cutil::str::to_string(std::string("(1, 2)"))); // operator<<
+}
+
+TEST(Parsing, to_string_shortest_round_trip)
+{
+    EXPECT_EQ("0", cutil::str::to_string(0.0));
+    EXPECT_EQ("-0", cutil::str::to_string(-0.0));
+    EXPECT_EQ("0.1", cutil::str::to_string(0.1));
+    EXPECT_EQ("0.1", cutil::str::to_string(0.1f));
+    EXPECT_EQ("0.30000000000000004", cutil::str::to_string(0.1 + 0.2));
+    EXPECT_EQ("0.3333333333333333", cutil::str::to_string(1.0 / 3));
+    EXPECT_EQ("0.33333334", cutil::str::to_string(1.0f / 3));
+    EXPECT_EQ("1234567", cutil::str::to_string(1234567.0));
+    EXPECT_EQ("1e-05", cutil::str::to_string(1e-5));
+    EXPECT_EQ("0.001", cutil::str::to_string(1e-3));
+    EXPECT_EQ("1e-04", cutil::str::to_string(1e-4)); // shorter than "0.0001"
+    EXPECT_EQ("1e+22", cutil::str::to_string(1e22));
+    EXPECT_EQ("1152921504606846976", cutil::str::to_string(1152921504606846976.0)); // 2^60, exact digits of a large integer
+    EXPECT_EQ("-2.5e-300", cutil::str::to_string(-2.5e-300));
+    EXPECT_EQ("1.7976931348623157e+308", cutil::str::to_string(std::numeric_limits<double>::max()));
+    EXPECT_EQ("5e-324", cutil::str::to_string(std::numeric_limits<double>::denorm_min()));
+    EXPECT_EQ("1e-45", cutil::str::to_string(std::numeric_limits<float>::denorm_min()));
+    EXPECT_EQ("inf", cutil::str::to_string(std::numeric_limits<double>::infinity()));
+    EXPECT_EQ("-inf", cutil::str::to_string(-std::numeric_limits<float>::infinity()));
+    EXPECT_EQ("nan", cutil::str::to_string(std::numeric_limits<double>::quiet_NaN()));
+
+    char buf[4];
+    EXPECT_EQ(nullptr, cutil::str::float_to_chars(buf, buf + sizeof(buf), 0.125));
+    EXPECT_EQ(buf + 3, cutil::str::float_to_chars(buf, buf + sizeof(buf), 0.5));
+}
+
+TEST(Parsing, float_round_trip_random_bits)
+{
+    std::mt19937_64 gen(20240601);
+    char buf[cutil::str::float_chars_max];
+    for (int i = 0; i < 100000; ++i)
+    {
+        const uint64_t bits64 = gen();
+        double d;
+        std::memcpy(&d, &bits64, sizeof(d));
+        const uint32_t bits32 = static_cast<uint32_t>(bits64);
+        float f;
+        std::memcpy(&f, &bits32, sizeof(f));
+
+        if (std::isfinite(d))
+        {
+            const std::string str(buf, cutil::str::float_to_chars(buf, buf + sizeof(buf), d));
+            const double back = std::strtod(str.c_str(), nullptr);
+            ASSERT_EQ(0, std::memcmp(&back, &d, sizeof(d))) << str;
+            ASSERT_LE(str.size(), 24u) << str;
+        #ifdef CUTIL_CPP17_SUPPORTED
+            char expected[64];
+            ASSERT_EQ(std::string(expected, std::to_chars(expected, expected + sizeof(expected), d).ptr), str);
+        #endif
+        }
+        if (std::isfinite(f))
+        {
+            const std::string str(buf, cutil::str::float_to_chars(buf, buf + sizeof(buf), f));
+            const float back = std::strtof(str.c_str(), nullptr);
+            ASSERT_EQ(0, std::memcmp(&back, &f, sizeof(f))) << str;
+        #ifdef CUTIL_CPP17_SUPPORTED
+            char expected[64];
+            ASSERT_EQ(std::string(expected, std::to_chars(expected, expected + sizeof(expected), f).ptr), str);
+        #endif
+        }
+    }
+}
+
+TEST(Parsing, parse_float_same_as_strtod)
+{
+    std::mt19937_64 gen(777);
+    for (int i = 0; i < 100000; ++i)
+    {
+        char str[128];
+        if (i % 2 == 0) // every digit of a random bit pattern, exercises the halfway cases
+        {
+            const uint64_t bits = gen();
+            double v;
+            std::memcpy(&v, &bits, sizeof(v));
+            if (!std::isfinite(v))
+            {
+                continue;
+            }
+            std::snprintf(str, sizeof(str), "%.*g", static_cast<int>(gen() % 40 + 1), v);
+        }
+        else // random digits, more than 19 of them now and then, any exponent
+        {
+            int len = (gen() % 2) ? 0 : std::snprintf(str, sizeof(str), "-");
+            const int digits = static_cast<int>(gen() % 30 + 1);
+            for (int k = 0; k < digits; ++k)
+            {
+                str[len++] = static_cast<char>('0' + gen() % 10);
+                if (k == digits / 2 && gen() % 2)
+                {
+                    str[len++] = '.';
+                }
+            }
+            std::snprintf(str + len, sizeof(str) - len, "e%d", static_cast<int>(gen() % 700) - 350);
+        }
+        const char* last = str + std::strlen(str);
+
+        double d = 0;
+        const double expected_d = std::strtod(str, nullptr);
+        const cutil::str::parse_result rd = cutil::str::parse_float(str, last, d);
+        ASSERT_EQ(last, rd.ptr) << str;
+        if (std::isinf(expected_d) || (expected_d == 0 && rd.ec != std::errc()))
+        {
+            ASSERT_EQ(std::errc::result_out_of_range, rd.ec) << str;
+        }
+        else
+        {
+            ASSERT_EQ(std::errc(), rd.ec) << str;
+            ASSERT_EQ(0, std::memcmp(&d, &expected_d, sizeof(d))) << str;
+        }
+
+        float f = 0;
+        const float expected_f = std::strtof(str, nullptr);
+        const cutil::str::parse_result rf = cutil::str::parse_float(str, last, f);
+        if (rf.ec == std::errc())
+        {
+            ASSERT_EQ(0, std::memcmp(&f, &expected_f, sizeof(f))) << str;
+        }
+        else
+        {
+            ASSERT_TRUE(std::isinf(expected_f) || expected_f == 0) << str;
+        }
+    }
+}
+
+TEST(Parsing, parse_float_edge_cases)
+{
+    const auto parse = [](const char* str, double& value) {
+        const cutil::str::parse_result res = cutil::str::parse_float(str, str + std::strlen(str), value);
+        return std::make_pair(static_cast<int>(res.ptr - str), res.ec);
+    };
+    double v = -1;
+    EXPECT_EQ(std::make_pair(3, std::errc()), parse("-.5e", v)); // dangling exponent is not consumed
+    EXPECT_EQ(-0.5, v);
+    EXPECT_EQ(std::make_pair(2, std::errc()), parse("5.", v));
+    EXPECT_EQ(5.0, v);
+    EXPECT_EQ(std::make_pair(3, std::errc()), parse("1e5x", v));
+    EXPECT_EQ(1e5, v);
+    EXPECT_EQ(std::make_pair(9, std::errc()), parse("-Infinity", v));
+    EXPECT_TRUE(std::isinf(v) && v < 0);
+    EXPECT_EQ(std::make_pair(8, std::errc()), parse("nan(abc)", v));
+    EXPECT_TRUE(std::isnan(v));
+    EXPECT_EQ(std::make_pair(0, std::errc::invalid_argument), parse(".", v));
+    EXPECT_EQ(std::make_pair(0, std::errc::invalid_argument), parse("+1", v)); // like `std::from_chars()`
+    EXPECT_EQ(std::make_pair(0, std::errc::invalid_argument), parse(" 1", v));
+
+    v = 42;
+    EXPECT_EQ(std::make_pair(5, std::errc::result_out_of_range), parse("1e400", v));
+    EXPECT_EQ(std::make_pair(6, std::errc::result_out_of_range), parse("1e-400", v));
+    EXPECT_EQ(42, v); // untouched
+    EXPECT_EQ(std::make_pair(5, std::errc()), parse("0e999", v));
+    EXPECT_EQ(0, v);
+    EXPECT_EQ(std::make_pair(22, std::errc()), parse("1.7976931348623157e308", v));
+    EXPECT_EQ(std::numeric_limits<double>::max(), v);
+    EXPECT_EQ(std::make_pair(23, std::errc()), parse("2.4703282292062328e-324", v)); // just above half of the smallest subnormal
+    EXPECT_EQ(std::numeric_limits<double>::denorm_min(), v);
+    EXPECT_EQ(std::make_pair(37, std::errc()), parse("9007199254740993.00000000000000000001", v)); // halfway, plus a bit
+    EXPECT_EQ(9007199254740994.0, v);
+    EXPECT_EQ(std::make_pair(16, std::errc()), parse("9007199254740993", v)); // exactly halfway, rounds to even
+    EXPECT_EQ(9007199254740992.0, v);
+
+    const char* str = "2.5";
+    long double ld = 0;
+    EXPECT_EQ(str + 3, cutil::str::parse_float(str, str + 3, ld).ptr);
+    EXPECT_EQ(2.5L, ld);
+
+    EXPECT_EQ(0.5, cutil::str::to_number<double>("  +0.5"));
+    EXPECT_EQ(8.0, cutil::str::to_number<double>("0x1p3")); // hexadecimal is left to `std::strtod()`
+    EXPECT_EQ(0.1f, cutil::str::parse_string<float>(" 0.1"));
+#ifdef CUTIL_CPP17_SUPPORTED
+    EXPECT_EQ(0.1, cutil::str::to_number_opt<double>("0.1"));
+    EXPECT_EQ(std::nullopt, cutil::str::to_number_opt<double>("1e999"));
+#endif
+}
+
+TEST(Parsing, to_string_buffer)
+{
+    char buf[8];
+    EXPECT_EQ(4, cutil::str::to_string(-255, buf, sizeof(buf)));
+    EXPECT_STREQ("-255", buf);
+    EXPECT_EQ(1, cutil::str::to_string('d', buf, sizeof(buf)));
+    EXPECT_STREQ("d", buf);
+    EXPECT_EQ(5, cutil::str::to_string(5.245f, buf, sizeof(buf)));
+    EXPECT_STREQ("5.245", buf);
+    EXPECT_EQ(3, cutil::str::to_string(123, buf, 3)); // exact fit, not terminated
+    EXPECT_EQ(0, cutil::str::to_string(1234, buf, 3)); // too small
+}
+
+TEST(Parsing, parse_string_edge_cases)
+{
+    EXPECT_EQ(42, cutil::str::parse_string<int>("  42"));
+    EXPECT_EQ(42, cutil::str::parse_string<int>("+42"));
+    EXPECT_EQ(42, cutil::str::parse_string<int>("42abc"));
+    EXPECT_EQ(0, cutil::str::parse_string<int>("abc"));
+    EXPECT_EQ(0, cutil::str::parse_string<int>(""));
+    EXPECT_EQ(0, cutil::str::parse_string<int>("+-42"));
+    EXPECT_EQ(0u, cutil::str::parse_string<unsigned>("-42"));
+    EXPECT_EQ(std::numeric_limits<int16_t>::max(), cutil::str::parse_string<int16_t>("99999"));
+    EXPECT_EQ(std::numeric_limits<int16_t>::min(), cutil::str::parse_string<int16_t>("-99999"));
+    EXPECT_EQ(-32768, cutil::str::parse_string<int16_t>("-32768"));
+    EXPECT_EQ(12, cutil::str::parse_string<int>("1234", 2));
+    EXPECT_EQ(0.5, cutil::str::parse_string<double>(" 0.5 "));
+    EXPECT_EQ(-1e10, cutil::str::parse_string<double>("-1e10"));
+    EXPECT_EQ(2.5f, cutil::str::parse_string<float>("+2.5"));
+    EXPECT_EQ(false, cutil::str::parse_string<bool>("2"));
+    EXPECT_EQ('x', cutil::str::parse_string<char>("  x"));
+    EXPECT_EQ("abc", cutil::str::parse_string<std::string>("abc def"));
+}
+
 TEST(Parsing, string_to_short_int)
 {
     EXPECT_EQ(-255, cutil::str::parse_string<short int>("-255"));
@@ -196,6 +640,183 @@ TEST(Parsing, string_to_short_int)
 #endif
 }
 
+TEST(Parsing, parse_integer)
+{
+    int32_t i32 = 7;
+    std::string str = "-2147483648";
+    auto res = cutil::str::parse_integer(str.data(), str.data() + str.size(), i32);
+    EXPECT_EQ(res.ec, std::errc());
+    EXPECT_EQ(res.ptr, str.data() + str.size());
+    EXPECT_EQ(i32, std::numeric_limits<int32_t>::min());
+
+    str = "2147483648"; // overflow, value untouched, all digits consumed
+    res = cutil::str::parse_integer(str.data(), str.data() + str.size(), i32);
+    EXPECT_EQ(res.ec, std::errc::result_out_of_range);
+    EXPECT_EQ(res.ptr, str.data() + str.size());
+    EXPECT_EQ(i32, std::numeric_limits<int32_t>::min());
+
+    str = "123456789012abc"; // longer than 8 digits, stops at trailing characters
+    int64_t i64 = 0;
+    res = cutil::str::parse_integer(str.data(), str.data() + str.size(), i64);
+    EXPECT_EQ(res.ec, std::errc());
+    EXPECT_EQ(res.ptr, str.data() + 12);
+    EXPECT_EQ(i64, 123456789012);
+
+    for (const char* bad : {"", "-", "+1", " 1", "abc"})
+    {
+        str = bad;
+        res = cutil::str::parse_integer(str.data(), str.data() + str.size(), i64);
+        EXPECT_EQ(res.ec, std::errc::invalid_argument) << bad;
+        EXPECT_EQ(res.ptr, str.data()) << bad;
+    }
+
+    uint64_t u64 = 0;
+    EXPECT_EQ(std::errc(), cutil::str::parse_integer_exact("18446744073709551615", u64));
+    EXPECT_EQ(u64, 18446744073709551615ULL);
+    EXPECT_EQ(std::errc::result_out_of_range, cutil::str::parse_integer_exact("18446744073709551616", u64));
+    EXPECT_EQ(std::errc::result_out_of_range, cutil::str::parse_integer_exact("00000000000000000000000018446744073709551616", u64));
+    EXPECT_EQ(std::errc(), cutil::str::parse_integer_exact("000000000000000000000000000000001", u64));
+    EXPECT_EQ(u64, 1);
+    EXPECT_EQ(std::errc::invalid_argument, cutil::str::parse_integer_exact("-1", u64));
+    EXPECT_EQ(std::errc::invalid_argument, cutil::str::parse_integer_exact("12 ", u64));
+
+    uint8_t u8 = 0;
+    EXPECT_EQ(std::errc(), cutil::str::parse_integer_exact("ff", u8, 16));
+    EXPECT_EQ(u8, 255);
+    EXPECT_EQ(std::errc::result_out_of_range, cutil::str::parse_integer_exact("100", u8, 16));
+    int8_t i8 = 0;
+    EXPECT_EQ(std::errc(), cutil::str::parse_integer_exact("-10000000", i8, 2));
+    EXPECT_EQ(i8, -128);
+    EXPECT_EQ(std::errc(), cutil::str::parse_integer_exact("zz", i64, 36));
+    EXPECT_EQ(i64, 35 * 36 + 35);
+    EXPECT_EQ(std::errc::invalid_argument, cutil::str::parse_integer_exact("1", i64, 37));
+}
+
+TEST(Parsing, parse_integer_same_as_strtoll)
+{
+    std::mt19937_64 gen(12345);
+    for (int i = 0; i < 20000; ++i)
+    {
+        const int64_t v = static_cast<int64_t>(gen()) >> (gen() % 64);
+        std::string str = std::to_string(v);
+        if (i % 3 == 0)
+        {
+            str.insert(str[0] == '-' ? 1 : 0, std::string(gen() % 12, '0'));
+        }
+        int64_t i64 = 0;
+        ASSERT_EQ(std::errc(), cutil::str::parse_integer_exact(str, i64)) << str;
+        ASSERT_EQ(std::strtoll(str.c_str(), nullptr, 10), i64) << str;
+
+        int32_t i32 = 0;
+        const bool fits = v >= std::numeric_limits<int32_t>::min() && v <= std::numeric_limits<int32_t>::max();
+        ASSERT_EQ(fits ? std::errc() : std::errc::result_out_of_range, cutil::str::parse_integer_exact(str, i32)) << str;
+        if (fits)
+        {
+            ASSERT_EQ(v, i32) << str;
+        }
+    }
+}
+
+TEST(Parsing, to_number_errors)
+{
+    EXPECT_EQ(255, cutil::str::to_number<int>("  +255abc"));
+    EXPECT_EQ(255, cutil::str::to_number<long>("0xff", 16));
+    EXPECT_EQ(255, cutil::str::to_number<long long>("ff", 16));
+    EXPECT_EQ(-255, cutil::str::to_number<long long>("-0xFF", 16));
+    EXPECT_EQ(255, cutil::str::to_number<unsigned long>("0xff", 0));
+    EXPECT_EQ(8, cutil::str::to_number<unsigned long long>("010", 0));
+    EXPECT_EQ(0, cutil::str::to_number<int>("0x", 16));
+    EXPECT_THROW((void)cutil::str::to_number<int>("abc"), std::invalid_argument);
+    EXPECT_THROW((void)cutil::str::to_number<int>(""), std::invalid_argument);
+    EXPECT_THROW((void)cutil::str::to_number<int>("99999999999"), std::out_of_range);
+    EXPECT_THROW((void)cutil::str::to_number<uint8_t>("256"), std::out_of_range);
+    EXPECT_THROW((void)cutil::str::to_number<unsigned long>("-1"), std::out_of_range);
+    EXPECT_THROW((void)cutil::str::to_number<double>("x1.0"), std::invalid_argument);
+    EXPECT_THROW((void)cutil::str::to_number<float>("1e100"), std::out_of_range);
+
+    EXPECT_EQ(-1, cutil::str::to_number<long>("abc", -1L));
+    EXPECT_EQ(42, cutil::str::to_number<long>("42", -1L));
+    EXPECT_EQ(2.5, cutil::str::to_number<double>("2.5", -1.0));
+    EXPECT_EQ((std::pair<bool, int16_t>(false, 0)), cutil::str::to_number_pair<int16_t>("40000"));
+    EXPECT_EQ((std::pair<bool, int16_t>(true, -4000)), cutil::str::to_number_pair<int16_t>("-4000"));
+#ifdef CUTIL_CPP17_SUPPORTED
+    EXPECT_EQ(std::nullopt, cutil::str::to_number_opt<int32_t>("255abc")); // trailing characters
+    EXPECT_EQ(std::nullopt, cutil::str::to_number_opt<int32_t>(""));
+    EXPECT_EQ(255, cutil::str::to_number_opt<int32_t>("ff", 16));
+    EXPECT_EQ(255, cutil::str::to_number_opt_legacy<int32_t>("255abc"));
+#endif
+}
+
+#ifdef CUTIL_CPP17_SUPPORTED
+TEST(Parsing, parse_numbers)
+{
+    std::vector<double> values(4, -1.0);
+    auto res = cutil::str::parse_numbers<double>("1.5, 2,-3e4 ,\t0.25\r\n", ',', values);
+    EXPECT_TRUE(res.ok());
+    EXPECT_EQ(4u, res.fields);
+    EXPECT_EQ(4u, res.parsed);
+    EXPECT_EQ((std::vector<double>{1.5, 2.0, -3e4, 0.25}), values);
+
+    int32_t ints[3] = {-1, -1, -1};
+    std::errc errors[3];
+    res = cutil::str::parse_numbers<int32_t>("7|x|99999999999", '|', ints, errors);
+    EXPECT_FALSE(res.ok());
+    EXPECT_EQ(3u, res.fields);
+    EXPECT_EQ(1u, res.parsed);
+    EXPECT_EQ(1u, res.error_index);
+    EXPECT_EQ(std::errc::invalid_argument, res.ec);
+    EXPECT_EQ(std::errc(), errors[0]);
+    EXPECT_EQ(std::errc::invalid_argument, errors[1]);
+    EXPECT_EQ(std::errc::result_out_of_range, errors[2]);
+    EXPECT_EQ(7, ints[0]);
+    EXPECT_EQ(-1, ints[1]); // untouched
+    EXPECT_EQ(-1, ints[2]);
+
+    res = cutil::str::parse_numbers<int32_t>("1,2,3,4", ',', ints, errors);
+    EXPECT_EQ(4u, res.fields);
+    EXPECT_EQ(3u, res.parsed);
+    EXPECT_EQ(3u, res.error_index);
+    EXPECT_EQ(std::errc::value_too_large, res.ec); // more fields than room
+
+    EXPECT_EQ(0u, cutil::str::parse_numbers<int32_t>("", ',', ints).fields);
+    res = cutil::str::parse_numbers<int32_t>("1,,2,", ',', ints);
+    EXPECT_EQ(4u, res.fields);
+    EXPECT_EQ(1u, res.error_index); // empty field
+    EXPECT_EQ(std::errc::invalid_argument, cutil::str::parse_numbers<int32_t>("12abc", ',', ints).ec);
+}
+
+TEST(Parsing, parse_fields)
+{
+    const std::string line = "cpu.load, 1718000000 ,0.75";
+    auto rec = cutil::str::parse_fields<std::string_view, int64_t, double>(line, ',');
+    EXPECT_TRUE(rec.ok());
+    EXPECT_EQ(3u, rec.fields);
+    const auto [name, timestamp, value] = rec.values;
+    EXPECT_EQ("cpu.load", name);
+    EXPECT_EQ(line.data(), name.data()); // no copy
+    EXPECT_EQ(1718000000, timestamp);
+    EXPECT_EQ(0.75, value);
+
+    auto copied = cutil::str::parse_fields<std::string, uint8_t>("name\t300", '\t');
+    EXPECT_FALSE(copied.ok());
+    EXPECT_EQ("name", std::get<0>(copied.values));
+    EXPECT_EQ(std::errc(), copied.errors[0]);
+    EXPECT_EQ(std::errc::result_out_of_range, copied.errors[1]);
+    EXPECT_EQ(0, std::get<1>(copied.values));
+
+    auto missing = cutil::str::parse_fields<int, int, int>("1 2", ' ');
+    EXPECT_FALSE(missing.ok());
+    EXPECT_EQ(2u, missing.fields);
+    EXPECT_EQ(std::errc::invalid_argument, missing.errors[2]);
+
+    auto extra = cutil::str::parse_fields<int>("1;2;3", ';');
+    EXPECT_FALSE(extra.ok());
+    EXPECT_EQ(3u, extra.fields);
+    EXPECT_EQ(std::errc(), extra.errors[0]);
+    EXPECT_EQ(1, std::get<0>(extra.values));
+}
+#endif
+
 TEST(Parsing, string_to_u_short_int)
 {
     EXPECT_EQ(255, cutil::str::parse_string<unsigned short int>("255"));
@@ -257,6 +878,14 @@ TEST(Parsing, string_to_float)
     EXPECT_EQ(99999999999999.0f, cutil::str::to_number_opt_legacy<float>("99999999999999"));
     EXPECT_EQ(1e2f, cutil::str::to_number_opt_legacy<float>("1e2"));
 #endif
+    
+    double value = 1.0;
+    EXPECT_EQ(std::errc::invalid_argument, cutil::str::parse_float_exact("5.245f", value));
+    EXPECT_EQ(1.0, value);
+    EXPECT_EQ(std::errc::invalid_argument, cutil::str::parse_float_exact("", value));
+    EXPECT_EQ(std::errc::result_out_of_range, cutil::str::parse_float_exact("1e999", value));
+    EXPECT_EQ(std::errc(), cutil::str::parse_float_exact("-2.5e-3", value));
+    EXPECT_EQ(-2.5e-3, value);
 }
 
 TEST(Parsing, string_to_double)
@@ -414,6 +1043,327 @@ TEST(Splitting, split_any)
     EXPECT_EQ(res[2], "123");
 }
 
+#ifdef CUTIL_CPP17_SUPPORTED
+TEST(Splitting, intern_pool)
+{
+    cutil::str::intern_pool pool(64);
+    const auto get = pool.intern("GET");
+    const auto post = pool.intern("POST");
+    EXPECT_EQ(0u, get);
+    EXPECT_EQ(1u, post);
+    EXPECT_EQ(get, pool.intern(std::string("GET")));
+    EXPECT_EQ(2u, pool.size());
+    EXPECT_EQ(2u, pool.intern(std::string(1000, 'x'))); // own arena chunk
+    EXPECT_EQ(3u, pool.intern(""));
+
+    const std::string_view first = pool.view(get);
+    for (int i = 0; i < 10000; ++i) // grows the index and the arena
+    {
+        pool.intern("token" + std::to_string(i));
+    }
+    EXPECT_EQ(10004u, pool.size());
+    EXPECT_EQ(first.data(), pool.view(get).data()); // views never move
+    EXPECT_EQ(first.data(), pool.intern_view("GET").data());
+    EXPECT_STREQ("POST", pool.c_str(post));
+    EXPECT_EQ("token9999", pool.view(*pool.find("token9999")));
+    EXPECT_FALSE(pool.find("token10000").has_value());
+    EXPECT_EQ(10004u, pool.size());
+
+    pool.clear();
+    EXPECT_TRUE(pool.empty());
+    EXPECT_EQ(0u, pool.intern("POST"));
+}
+
+TEST(Splitting, intern_pool_move)
+{
+    cutil::str::intern_pool pool(256);
+    const auto get = pool.intern("GET");
+    const std::string_view get_view = pool.view(get);
+
+    cutil::str::intern_pool moved(std::move(pool));
+    EXPECT_EQ(get_view.data(), moved.view(get).data()); // views survive the move
+
+    // the moved-from pool is empty and must not write into the chunk it gave away
+    EXPECT_FALSE(pool.find("GET").has_value());
+    EXPECT_EQ(0u, pool.intern("XXXXXXXX"));
+    EXPECT_EQ("XXXXXXXX", pool.view(0));
+    EXPECT_EQ(1u, moved.intern("POST"));
+    EXPECT_EQ("GET", moved.view(get));
+    EXPECT_EQ("POST", moved.view(1));
+
+    pool = std::move(moved);
+    EXPECT_EQ("POST", pool.view(1));
+    EXPECT_EQ(0u, moved.intern("HEAD"));
+    EXPECT_EQ("GET", pool.view(get));
+    EXPECT_EQ("POST", pool.view(1));
+}
+
+TEST(Splitting, split_interned)
+{
+    cutil::str::intern_pool pool;
+    for (const std::string str : {"", "abcdef", "abcdef;", "abcdef;;", ";abcdef", "a;b;;a;c;b"})
+    {
+        std::vector<std::string> texts;
+        for (auto id : cutil::str::split_interned(str, ';', pool))
+        {
+            texts.emplace_back(pool.view(id));
+        }
+        EXPECT_EQ(cutil::str::split(str, ';'), texts) << str;
+    }
+    const auto ids = cutil::str::split_interned("x,y,x,x,y", ',', pool);
+    EXPECT_EQ(ids[0], ids[2]);
+    EXPECT_EQ(ids[0], ids[3]);
+    EXPECT_EQ(ids[1], ids[4]);
+    EXPECT_NE(ids[0], ids[1]);
+}
+
+TEST(Splitting, concurrent_intern_pool)
+{
+    cutil::str::concurrent_intern_pool pool;
+    std::vector<std::vector<cutil::str::concurrent_intern_pool::id_type>> ids(4);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < ids.size(); ++t)
+    {
+        threads.emplace_back([&pool, &ids, t]{
+            for (int i = 0; i < 5000; ++i)
+            {
+                ids[t].push_back(pool.intern("word" + std::to_string(i % 1000)));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(1000u, pool.size());
+    for (size_t t = 1; t < ids.size(); ++t)
+    {
+        EXPECT_EQ(ids[0], ids[t]);
+    }
+    EXPECT_EQ("word42", pool.view(ids[0][42]));
+    EXPECT_EQ(ids[0][42], *pool.find("word42"));
+    EXPECT_EQ(ids[0][7], cutil::str::split_interned("word7", ';', pool)[0]);
+}
+
+namespace {
+    size_t naive_edit_distance(const std::string& a, const std::string& b)
+    {
+        std::vector<size_t> row(b.size() + 1);
+        for (size_t j = 0; j <= b.size(); ++j) row[j] = j;
+        for (size_t i = 1; i <= a.size(); ++i) {
+            size_t diag = row[0];
+            row[0] = i;
+            for (size_t j = 1; j <= b.size(); ++j) {
+                const size_t up = row[j];
+                row[j] = std::min({row[j] + 1, row[j - 1] + 1, diag + (a[i - 1] != b[j - 1])});
+                diag = up;
+            }
+        }
+        return row[b.size()];
+    }
+}
+
+TEST(Fuzzy, edit_distance)
+{
+    EXPECT_EQ(3u, cutil::str::edit_distance("kitten", "sitting"));
+    EXPECT_EQ(2u, cutil::str::edit_distance("kitten", "sitting", 1));
+    EXPECT_EQ(0u, cutil::str::edit_distance("", ""));
+    EXPECT_EQ(5u, cutil::str::edit_distance("", "abcde"));
+    EXPECT_EQ(5u, cutil::str::edit_distance("abcde", "", static_cast<size_t>(-1)));
+    EXPECT_EQ(4u, cutil::str::edit_distance("a", "abcdefgh", 3)); // lengths alone rule it out
+
+    std::mt19937 gen(17);
+    for (int round = 0; round < 3000; ++round) {
+        // short and multi-block patterns, small alphabets so the strings are close
+        const size_t max_size = round % 3 == 0 ? 300 : 70;
+        std::string a, b;
+        for (size_t i = 0, n = gen() % max_size; i < n; ++i) a += "abc"[gen() % 3];
+        b = a;
+        for (size_t e = 0, n = gen() % 20; e < n && !b.empty(); ++e) { // a few random edits
+            const size_t pos = gen() % b.size();
+            switch (gen() % 3) {
+                case 0: b.erase(pos, 1); break;
+                case 1: b.insert(pos, 1, "abcd"[gen() % 4]); break;
+                default: b[pos] = "abcd"[gen() % 4]; break;
+            }
+        }
+        if (gen() % 4 == 0) std::swap(a, b);
+        const size_t expected = naive_edit_distance(a, b);
+        ASSERT_EQ(expected, cutil::str::edit_distance(a, b)) << a << " " << b;
+        const size_t bound = gen() % 25;
+        ASSERT_EQ(std::min(expected, bound + 1), cutil::str::edit_distance(a, b, bound)) << a << " " << b << " " << bound;
+    }
+}
+
+TEST(Fuzzy, closest_matches)
+{
+    const std::vector<std::string_view> commands = {"commit", "checkout", "cherry-pick", "clone", "chckout"};
+    const auto suggestions = cutil::str::closest_matches("chekout", commands, 2);
+    ASSERT_EQ(2u, suggestions.size());
+    EXPECT_EQ(1u, suggestions[0].index); // tie at distance 1, lower index first
+    EXPECT_EQ(1u, suggestions[0].distance);
+    EXPECT_EQ(4u, suggestions[1].index);
+    EXPECT_TRUE(cutil::str::closest_matches("chekout", commands, 0).empty());
+    EXPECT_TRUE(cutil::str::closest_matches("xyzzy", commands, 3, 2).empty());
+
+    // same as sorting all the distances, sequential and parallel
+    std::mt19937 gen(23);
+    std::vector<std::string> words;
+    for (int i = 0; i < 20000; ++i) {
+        std::string word;
+        for (size_t k = 0, n = 3 + gen() % (i % 50 == 0 ? 120 : 10); k < n; ++k) word += "abcde"[gen() % 5];
+        words.push_back(std::move(word));
+    }
+    const std::vector<std::string_view> views(words.begin(), words.end());
+    for (const std::string query : {"abcab", "eeee", "abcdeabcdeabcdeabcdeabcdeabcdeabcdeabcdeabcdeabcdeabcdeabcdeabcdeabcde"}) {
+        std::vector<std::pair<size_t, size_t>> all;
+        for (size_t i = 0; i < words.size(); ++i) {
+            all.emplace_back(naive_edit_distance(query, words[i]), i);
+        }
+        std::sort(all.begin(), all.end());
+        for (size_t k : {size_t(1), size_t(10), size_t(100)}) {
+            const auto seq = cutil::str::closest_matches(query, views, k);
+            const auto par = cutil::str::closest_matches_par(query, views, k);
+            ASSERT_EQ(k, seq.size());
+            ASSERT_EQ(k, par.size());
+            for (size_t i = 0; i < k; ++i) {
+                ASSERT_EQ(all[i].second, seq[i].index) << query << " " << k << " " << i;
+                ASSERT_EQ(all[i].first, seq[i].distance);
+                ASSERT_EQ(all[i].second, par[i].index);
+                ASSERT_EQ(all[i].first, par[i].distance);
+            }
+        }
+    }
+}
+
+TEST(CaseInsensitive, functors)
+{
+    auto lower = [](std::string s) { for (char& c : s) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c))); return s; };
+    std::mt19937 gen(42);
+    const char alphabet[] = "aAbBzZ@[`{09-_\xC3\xA9";
+    for (int round = 0; round < 20000; ++round) {
+        std::string a, b;
+        for (size_t i = 0, n = gen() % 20; i < n; ++i) a += alphabet[gen() % (sizeof(alphabet) - 1)];
+        for (size_t i = 0, n = gen() % 4 == 0 ? a.size() : gen() % 20; i < n; ++i) b += alphabet[gen() % (sizeof(alphabet) - 1)];
+        if (gen() % 3 == 0) { // same letters, other case
+            b = a;
+            for (char& c : b) if (gen() % 2) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        }
+        const std::string la = lower(a), lb = lower(b);
+        ASSERT_EQ(la == lb, cutil::str::ci_equal()(a, b)) << a << " " << b;
+        ASSERT_EQ(la < lb, cutil::str::ci_less()(a, b)) << a << " " << b;
+        ASSERT_EQ(la == lb, cutil::str::compare_ignore_case(a, b));
+        if (la == lb) {
+            ASSERT_EQ(cutil::str::ci_hash()(a), cutil::str::ci_hash()(b)) << a << " " << b;
+        }
+    }
+    EXPECT_NE(cutil::str::ci_hash()("abc"), cutil::str::ci_hash()("abd"));
+    EXPECT_NE(cutil::str::ci_hash()(""), cutil::str::ci_hash()(std::string_view("\0", 1)));
+
+    // heterogeneous lookups in the standard containers
+    std::map<std::string, int, cutil::str::ci_less> ordered{{"Accept", 1}, {"content-type", 2}};
+    EXPECT_EQ(2, ordered.find("Content-Type")->second);
+    EXPECT_EQ(1, ordered.find(std::string_view("ACCEPT"))->second);
+    std::unordered_map<std::string, int, cutil::str::ci_hash, cutil::str::ci_equal> hashed{{"Host", 3}};
+    EXPECT_EQ(3, hashed.at("HOST"));
+}
+
+TEST(CaseInsensitive, ci_flat_map)
+{
+    cutil::str::ci_flat_map<std::string> headers{{"Content-Type", "text/plain"}, {"Host", "a"}};
+    headers["HOST"] = "example.com";
+    EXPECT_EQ(2u, headers.size());
+    EXPECT_EQ("text/plain", headers.find("content-TYPE")->second);
+    EXPECT_EQ("example.com", headers.at(std::string("host")));
+    EXPECT_EQ("Host", headers.find("host")->first); // first spelling is kept
+    static_assert(std::is_const<std::remove_reference_t<decltype(headers.begin()->first)>>::value, "keys are read-only");
+    EXPECT_FALSE(headers.try_emplace("content-type", "x").second);
+    EXPECT_TRUE(headers.try_emplace("Accept", "*/*").second);
+    EXPECT_THROW(headers.at("Content-Length"), std::out_of_range);
+    EXPECT_EQ(headers.end(), headers.find("Content-Typ"));
+
+    std::vector<std::string> order;
+    for (const auto& entry : headers) order.push_back(entry.first);
+    EXPECT_EQ((std::vector<std::string>{"Content-Type", "Host", "Accept"}), order);
+
+    EXPECT_EQ(1u, headers.erase("HOST"));
+    EXPECT_EQ(0u, headers.erase("HOST"));
+    EXPECT_FALSE(headers.contains("host"));
+    EXPECT_EQ("*/*", headers.at("accept"));
+    EXPECT_EQ("Accept", (headers.begin() + 1)->first);
+
+    // copies are independent maps with their own index
+    cutil::str::ci_flat_map<std::string> copy(headers);
+    copy["x-extra"] = "1";
+    EXPECT_EQ(2u, headers.size());
+    EXPECT_EQ(3u, copy.size());
+    EXPECT_EQ("text/plain", copy.at("CONTENT-TYPE"));
+    cutil::str::ci_flat_map<std::string> assigned{{"Old", "gone"}};
+    assigned = copy;
+    EXPECT_FALSE(assigned.contains("old"));
+    EXPECT_EQ("1", assigned.at("X-Extra"));
+    EXPECT_EQ("*/*", assigned.at("accept"));
+    assigned = headers;
+    EXPECT_EQ(2u, assigned.size());
+    EXPECT_FALSE(assigned.contains("x-extra"));
+    EXPECT_EQ("1", copy.at("X-EXTRA"));
+
+    // growth
+    cutil::str::ci_flat_map<int> many;
+    for (int i = 0; i < 3000; ++i) {
+        many.insert_or_assign("Key-" + std::to_string(i), i);
+    }
+    for (int i = 0; i < 3000; ++i) {
+        many.insert_or_assign("KEY-" + std::to_string(i), -i);
+    }
+    ASSERT_EQ(3000u, many.size());
+    for (int i = 0; i < 3000; i += 7) {
+        ASSERT_EQ(-i, many.at("key-" + std::to_string(i)));
+    }
+    many.clear();
+    EXPECT_TRUE(many.empty());
+    EXPECT_FALSE(many.contains("key-1"));
+}
+#endif
+
+#ifdef _CUTIL_STRINGUTIL_USE_PMR
+TEST(Splitting, pmr_overloads)
+{
+    // everything has to come out of the buffer, the null upstream throws otherwise
+    alignas(std::max_align_t) char buffer[16 * 1024];
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer), std::pmr::null_memory_resource());
+    namespace pmr = cutil::str::pmr;
+
+    const std::string long_token(40, 'x'); // past the small string buffer
+    for (const std::string& str : std::vector<std::string>{"", "abcdef", "abcdef;", "abcdef;;", ";abcdef", "a;b;;" + long_token})
+    {
+        const auto tokens = pmr::split(str, ';', &arena);
+        EXPECT_EQ(cutil::str::split(str, ';'), std::vector<std::string>(tokens.begin(), tokens.end())) << str;
+        EXPECT_EQ(&arena, tokens.get_allocator().resource());
+    }
+    const auto by_string = pmr::split("abc;;;def>=" + long_token, ";;", &arena);
+    EXPECT_EQ(cutil::str::split("abc;;;def>=" + long_token, ";;"), std::vector<std::string>(by_string.begin(), by_string.end()));
+    const auto any = pmr::split_any("abc,def|ghi jkl", ",| ", &arena);
+    EXPECT_EQ(cutil::str::split_any("abc,def|ghi jkl", ",| "), std::vector<std::string>(any.begin(), any.end()));
+    const auto rgx = pmr::regex_split("abc,abcd;abce.abcf?", "[,;\\.\\?]+", &arena);
+    EXPECT_EQ(cutil::str::regex_split("abc,abcd;abce.abcf?", "[,;\\.\\?]+"), std::vector<std::string>(rgx.begin(), rgx.end()));
+
+    EXPECT_EQ("hello strutil", pmr::to_lower("HeLlo StRUTIL", &arena));
+    EXPECT_EQ("HELLO STRUTIL", pmr::to_upper("HeLlo StRUTIL", &arena));
+    EXPECT_EQ("HeLlo StRUTIL", pmr::trim_copy("    HeLlo StRUTIL      ", &arena));
+    EXPECT_EQ("HeLlo StRUTIL  ", pmr::trim_left_copy("   HeLlo StRUTIL  ", &arena));
+    EXPECT_EQ("  HeLlo StRUTIL", pmr::trim_right_copy("  HeLlo StRUTIL    ", &arena));
+    EXPECT_EQ("", pmr::trim_copy("   ", &arena));
+
+    const auto kept = pmr::drop_empty_copy(std::vector<std::string>{"t1", "", long_token, ""}, &arena);
+    EXPECT_EQ((std::vector<std::string>{"t1", long_token}), std::vector<std::string>(kept.begin(), kept.end()));
+    const auto joined = pmr::join(kept, ", ", &arena);
+    EXPECT_EQ("t1, " + long_token, std::string_view(joined));
+    EXPECT_EQ(&arena, joined.get_allocator().resource());
+    EXPECT_EQ("", pmr::join(std::vector<std::string>{}, ",", &arena));
+}
+#endif
+
 TEST(Regexsplitting, regex_split)
 {
     std::vector<std::string> res;
@@ -496,6 +1446,127 @@ TEST(SplittingSet, join)
     EXPECT_EQ(str2, cutil::str::join(tokens2, "|"));
 }
 
+TEST(SplittingVector, join_string_like)
+{
+    std::vector<const char*> tokens1 = { "Col1", "Col2", "Col3" };
+    EXPECT_EQ("Col1, Col2, Col3", cutil::str::join(tokens1, ", "));
+
+    std::vector<std::string> empty;
+    EXPECT_EQ("", cutil::str::join(empty, ","));
+    EXPECT_EQ("abc", cutil::str::join(std::vector<std::string>{"abc"}, ","));
+    EXPECT_EQ(",,", cutil::str::join(std::vector<std::string>{"", "", ""}, ","));
+
+#ifdef CUTIL_CPP17_SUPPORTED
+    std::vector<std::string_view> tokens2 = { "a", "bb", "ccc" };
+    EXPECT_EQ("a->bb->ccc", cutil::str::join(tokens2, "->"));
+#endif
+}
+
+TEST(SplittingVector, join_projection)
+{
+    std::vector<std::pair<std::string, int>> items = { {"a", 1}, {"b", -20}, {"c", 300} };
+
+    EXPECT_EQ("a;b;c", cutil::str::join(items, ";", [](const std::pair<std::string, int>& p){ return p.first; }));
+    EXPECT_EQ("1;-20;300", cutil::str::join(items, ";", [](const std::pair<std::string, int>& p){ return p.second; }));
+    EXPECT_EQ("a|b|c", cutil::str::join(items, "|", [](const std::pair<std::string, int>& p){ return p.first[0]; }));
+
+    std::vector<double> values = { 0.5, -2.25, 1e20 };
+    EXPECT_EQ("0.5 -2.25 1e+20", cutil::str::join(values, " ", [](double v){ return v; }));
+}
+
+TEST(SplittingVector, join_append)
+{
+    std::string line = "keys: ";
+    std::vector<std::string> tokens = { "abc", "def", "ghi" };
+    cutil::str::join_append(line, tokens, ", ");
+    EXPECT_EQ("keys: abc, def, ghi", line);
+
+    cutil::str::join_append(line, std::vector<std::string>{}, ", ");
+    EXPECT_EQ("keys: abc, def, ghi", line);
+
+    std::string nums = "[";
+    cutil::str::join_append(nums, std::vector<unsigned>{1, 2, 3}, ",", [](unsigned v){ return v * 10; });
+    nums += "]";
+    EXPECT_EQ("[10,20,30]", nums);
+}
+
+TEST(StringBuilder, append_chain)
+{
+    struct point { int x, y; };
+    cutil::str::string_builder sb;
+    // console style macros are string literals: `sb << FRed << "error " << CRst`
+    sb << "\033[31m" << "error " << "\033[0m" << 404 << ": " << 0.5 << ' ' << true << ' ' << -7ll << ' ' << std::string("s");
+    sb.append("xyz", 2).append(3, '-');
+    EXPECT_EQ("\033[31merror \033[0m404: 0.5 1 -7 sxy---", sb.str());
+    EXPECT_EQ(cutil::str::to_string(1.0 / 3) + cutil::str::to_string(2.5f) + cutil::str::to_string(1e300) + cutil::str::to_string(3.25L),
+              cutil::str::string_builder().append(1.0 / 3).append(2.5f).append(1e300).append(3.25L).str());
+    EXPECT_EQ("A", (cutil::str::string_builder() << static_cast<unsigned char>('A')).str()); // chars are chars, like to_string()
+
+    const char* before = sb.c_str();
+    const size_t size = sb.size();
+    std::string released = sb.release();
+    EXPECT_EQ(before, released.data()); // moved out, not copied (the text is past the small string buffer)
+    EXPECT_EQ(size, released.size());
+    EXPECT_TRUE(sb.empty());
+
+    // the released buffer can be handed back
+    const size_t capacity = released.capacity();
+    cutil::str::string_builder reused(std::move(released));
+    EXPECT_TRUE(reused.empty());
+    EXPECT_EQ(capacity, reused.capacity());
+
+    // geometric growth: few reallocations for many small appends
+    cutil::str::string_builder grown;
+    size_t reallocations = 0;
+    for (int i = 0; i < 100000; ++i) {
+        const size_t old = grown.capacity();
+        grown << i << ',';
+        reallocations += grown.capacity() != old;
+    }
+    EXPECT_LT(reallocations, 30u);
+    EXPECT_EQ("0,1,2,", grown.str().substr(0, 6));
+}
+
+TEST(StringBuilder, exact_size)
+{
+    EXPECT_EQ(0u, cutil::str::string_builder::measure());
+    EXPECT_EQ(14u, cutil::str::string_builder::measure("abc", 'd', 12345, std::string("xy"), 0.5));
+
+    cutil::str::string_builder sb(4);
+    sb.append_all("line ", 12, ", column ", 7, '.', std::string(40, 'x'));
+    EXPECT_EQ("line 12, column 7." + std::string(40, 'x'), sb.str());
+    EXPECT_LT(sb.capacity(), sb.size() + 64); // grown once, to the bound of the chain
+
+    const std::string dir(30, 'd'), file(30, 'f');
+    std::string long_path;
+    EXPECT_EQ(1u, count_allocations([&] { long_path = cutil::str::concat(dir, '/', file, '.', 1.5); })); // measured exactly
+    EXPECT_EQ(dir + '/' + file + ".1.5", long_path);
+    EXPECT_GE(long_path.capacity(), long_path.size());
+
+    const std::string path = cutil::str::concat("/tmp", '/', std::string("file"), '_', 42u, ".txt");
+    EXPECT_EQ("/tmp/file_42.txt", path);
+
+    std::vector<std::pair<int, std::string>> rows;
+    std::string expected;
+    for (int i = 0; i < 500; ++i) {
+        rows.emplace_back(i * 31, cutil::str::repeat("n", i % 17));
+        expected += std::to_string(i * 31) + ',' + rows.back().second + '\n';
+    }
+    int passes = 0;
+    std::string csv;
+    EXPECT_EQ(1u, count_allocations([&] {
+        csv = cutil::str::string_builder::build_exact([&](cutil::str::string_builder& out) {
+            ++passes;
+            for (const auto& row : rows) {
+                out << row.first << ',' << row.second << '\n';
+            }
+        });
+    }));
+    EXPECT_EQ(2, passes);
+    EXPECT_EQ(expected, csv);
+    EXPECT_GE(csv.capacity(), csv.size());
+}
+
 TEST(SplittingDropEmptyVector, drop_empty)
 {
     std::vector<std::string> tokens = { "t1", "t2", "", "t4", "" };
@@ -560,6 +1631,49 @@ TEST(TestDropDuplicateCopy, drop_duplicate_copy)
     EXPECT_EQ(std::equal(str2.cbegin(), str2.cend(), str3.cbegin()), true);
 }
 
+TEST(TestDropDuplicate, drop_duplicate_stable)
+{
+    std::vector<std::string> str1 = { "t1", "t2", "", "t4", "", "t1"};
+    const auto copy = cutil::str::drop_duplicate_stable_copy(str1);
+    EXPECT_EQ((std::vector<size_t>{0, 1, 2, 3}), cutil::str::unique_indices(str1));
+    cutil::str::drop_duplicate_stable(str1);
+
+    const std::vector<std::string> expected = { "t1", "t2", "", "t4"};
+    EXPECT_EQ(expected, str1);
+    EXPECT_EQ(expected, copy);
+
+    std::vector<int> ints = {5, 3, 5, 1, 3, 3, 9, 1};
+    cutil::str::drop_duplicate_stable(ints);
+    EXPECT_EQ((std::vector<int>{5, 3, 1, 9}), ints);
+
+    std::vector<std::string> ci = {"Abc", "abc", "x", "ABC"}; // custom hash and equality
+    cutil::str::drop_duplicate_stable(ci
+        , [](const std::string& s){ return std::hash<std::string>()(cutil::str::to_lower(s)); }
+        , [](const std::string& a, const std::string& b){ return cutil::str::compare_ignore_case(a, b); });
+    EXPECT_EQ((std::vector<std::string>{"Abc", "x"}), ci);
+}
+
+TEST(TestDropDuplicate, drop_duplicate_stable_par)
+{
+    std::mt19937_64 gen(99);
+    std::vector<std::string> values;
+    for (int i = 0; i < 200000; ++i)
+    {
+        values.push_back("key" + std::to_string(gen() % 50000));
+    }
+    std::vector<std::string> expected = values;
+    cutil::str::drop_duplicate_stable(expected);
+    EXPECT_LE(expected.size(), 50000u);
+
+    cutil::str::drop_duplicate_stable_par(values);
+    EXPECT_EQ(expected, values);
+
+    std::vector<std::string> sorted = expected;
+    cutil::str::drop_duplicate(sorted); // same set as the sort-based version
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(sorted, expected);
+}
+
 /*
  * Text manipulation tests
  */
@@ -697,6 +1811,89 @@ TEST(TextManip, replace_all_target_empty)
     EXPECT_EQ("This is $name and that is also $name.", str1);
 }
 
+TEST(TextManip, replace_all_length_change)
+{
+    std::string str1 = "aaa";
+    EXPECT_EQ(true, cutil::str::replace_all(str1, "a", "aa"));
+    EXPECT_EQ("aaaaaa", str1);
+
+    std::string str2 = "a--b--c--";
+    EXPECT_EQ(true, cutil::str::replace_all(str2, "--", "-"));
+    EXPECT_EQ("a-b-c-", str2);
+
+    std::string str3 = "xyxyx";
+    EXPECT_EQ(true, cutil::str::replace_all(str3, "xyx", ""));
+    EXPECT_EQ("yx", str3);
+}
+
+TEST(TextManip, replace_all_multi)
+{
+    std::string str1 = "<a href=\"x\">&</a>";
+    bool res = cutil::str::replace_all_multi(str1, {{"&", "&amp;"}, {"<", "&lt;"}, {">", "&gt;"}, {"\"", "&quot;"}});
+
+    EXPECT_EQ(true, res);
+    EXPECT_EQ("&lt;a href=&quot;x&quot;&gt;&amp;&lt;/a&gt;", str1);
+
+    // leftmost-longest, replaced text is not scanned again
+    std::string str2 = "abcd bc ab";
+    cutil::str::replace_all_multi(str2, {{"bc", "1"}, {"abcd", "2"}, {"ab", "3"}, {"b", "ab"}});
+    EXPECT_EQ("2 1 3", str2);
+
+    std::string str3 = "$name is $name_full";
+    cutil::str::replace_all_multi(str3, {{"$name", "Jon"}, {"$name_full", "Jon Doe"}});
+    EXPECT_EQ("Jon is Jon Doe", str3);
+
+    // duplicated keys, first one wins; empty keys are ignored
+    std::string str4 = "aXa";
+    cutil::str::replace_all_multi(str4, {{"", "!"}, {"a", "1"}, {"a", "2"}});
+    EXPECT_EQ("1X1", str4);
+
+    // keys using every byte value: 256 byte classes besides the "in no key" one
+    std::vector<std::pair<std::string, std::string>> every_byte;
+    std::string str5, expected5;
+    for (int c = 0; c < 256; ++c) {
+        every_byte.emplace_back(std::string(1, static_cast<char>(c)), std::to_string(c) + ",");
+        str5 += static_cast<char>(255 - c);
+        expected5 += std::to_string(255 - c) + ",";
+    }
+    EXPECT_EQ(true, cutil::str::replace_all_multi(str5, every_byte));
+    EXPECT_EQ(expected5, str5);
+}
+
+TEST(TextManip, replace_all_multi_long_key)
+{
+    // a short match must not wait for the longest key's length before it is emitted,
+    // this used to reread 10000 bytes per 'a' and take seconds.
+    const std::string long_key(10000, 'c');
+    std::string str1(200000, 'a');
+    EXPECT_EQ(true, cutil::str::replace_all_multi(str1, {{"a", "b"}, {long_key, "L"}}));
+    EXPECT_EQ(std::string(200000, 'b'), str1);
+
+    // the long key still wins where it fully occurs, a partial prefix of it is kept as-is
+    std::string str2 = "a" + long_key + "a" + long_key.substr(1) + "a";
+    cutil::str::replace_all_multi(str2, {{"a", "b"}, {long_key, "L"}});
+    EXPECT_EQ("bLb" + long_key.substr(1) + "b", str2);
+
+    // the long key extends the short one: after it fails, the bytes it followed are not read again
+    const std::string shared_key = std::string(5000, 'a') + "b";
+    std::string str3(100000, 'a');
+    EXPECT_EQ(true, cutil::str::replace_all_multi(str3, {{"a", "c"}, {shared_key, "L"}}));
+    EXPECT_EQ(std::string(100000, 'c'), str3);
+
+    std::string str4 = "a" + shared_key + "a";
+    cutil::str::replace_all_multi(str4, {{"a", "c"}, {shared_key, "L"}});
+    EXPECT_EQ("cLc", str4);
+}
+
+TEST(TextManip, no_replace_all_multi)
+{
+    std::string str1 = "This is $name.";
+    EXPECT_EQ(false, cutil::str::replace_all_multi(str1, {{"$nam$", "Jon"}, {"%name", "Doe"}}));
+    EXPECT_EQ("This is $name.", str1);
+    EXPECT_EQ(false, cutil::str::replace_all_multi(str1, {}));
+    EXPECT_EQ("This is $name.", str1);
+}
+
 TEST(TextSortAscending, sorting_ascending)
 {
     std::vector<std::string> str1 = {"ABC", "abc", "bcd", "", "-", "  ", "123", "-100"};
@@ -715,6 +1912,47 @@ TEST(TextSortDescending, sorting_descending)
     EXPECT_EQ(std::equal(str1.cbegin(), str1.cend(), str2.cbegin()), true);
 }
 
+TEST(TextSortAscending, sorting_same_as_std_sort)
+{
+    std::mt19937_64 gen(7);
+    const std::string prefixes[] = {"", "http://example.com/", "aaaaaaaa", std::string("a\0b", 3)};
+    for (size_t n : {0u, 1u, 40u, 3000u, 150000u}) // the last one takes the radix bucket path
+    {
+        std::vector<std::string> strs;
+        for (size_t i = 0; i < n; ++i)
+        {
+            std::string str = prefixes[gen() % 4];
+            const size_t len = gen() % 20;
+            for (size_t k = 0; k < len; ++k)
+            {
+                str.push_back(static_cast<char>(gen() % 4 == 0 ? gen() % 256 : 'a' + gen() % 3)); // NULs and bytes >= 0x80 too
+            }
+            strs.push_back(str);
+        }
+        if (n > 10)
+        {
+            strs[3] = strs[5]; // duplicates
+            strs[4] = strs[5];
+        }
+        std::vector<std::string> expected = strs;
+        std::sort(expected.begin(), expected.end());
+        std::vector<std::string> ascending = strs;
+        cutil::str::sorting_ascending(ascending);
+        EXPECT_EQ(expected, ascending) << n;
+
+        std::reverse(expected.begin(), expected.end());
+        std::vector<std::string> descending = strs;
+        cutil::str::sorting_descending(descending);
+        EXPECT_EQ(expected, descending) << n;
+
+    #ifdef CUTIL_CPP17_SUPPORTED
+        std::vector<std::string_view> views(strs.begin(), strs.end());
+        cutil::str::sorting_descending(views);
+        EXPECT_TRUE(std::equal(views.begin(), views.end(), expected.begin(), expected.end())) << n;
+    #endif
+    }
+}
+
 TEST(TextReverseInplace, reverse_inplace)
 {
     std::vector<std::string> str1 = {"bcd", "abc", "ABC", "123", "-100", "-", "  ", ""};
@@ -746,3 +1984,37 @@ TEST(TextReverseCopy, filename)
     EXPECT_EQ("abcdefg", cutil::str::sanitize_filename_copy(" a<b>:c>\\d\"e/f|g:** ? "));
     EXPECT_EQ("a_b__c__d_e_f_g___ _", cutil::str::sanitize_filename_copy(" a<b>:c>\\d\"e/f|g:** ? ", '_'));
 }
+
+TEST(TextReverseCopy, sanitize_filenames)
+{
+    // against the two-pass reference: remove or replace, then trim
+    const auto reference = [](std::string str, char replace) {
+        const std::string invalid_chars = "<>:\"/\\|?*";
+        if (replace == '\0') {
+            str.erase(std::remove_if(str.begin(), str.end(), [&](char c){ return invalid_chars.find(c) != std::string::npos; }), str.end());
+        } else {
+            std::replace_if(str.begin(), str.end(), [&](char c){ return invalid_chars.find(c) != std::string::npos; }, replace);
+        }
+        cutil::str::trim(str);
+        return str;
+    };
+    std::mt19937 gen(5);
+    const std::string alphabet = "ab. \t\r<>:\"/\\|?*";
+    std::vector<std::string> names;
+    for (int i = 0; i < 5000; ++i) {
+        std::string name;
+        for (size_t k = gen() % 12; k > 0; --k) {
+            name.push_back(alphabet[gen() % alphabet.size()]);
+        }
+        names.push_back(name);
+    }
+    for (char replace : {'\0', '_', ' '}) {
+        std::vector<std::string> batch = names;
+        cutil::str::sanitize_filenames(batch, replace);
+        for (size_t i = 0; i < names.size(); ++i) {
+            ASSERT_EQ(reference(names[i], replace), batch[i]) << names[i];
+            ASSERT_EQ(batch[i], cutil::str::sanitize_filename_copy(names[i], replace));
+        }
+    }
+}
+